@@ -8,6 +8,8 @@
 #include <math.h>   // Needed for conversions and estimates
 #include <float.h>  // Needed for estimates
 #include <limits.h> // For max sizes of int, long and int64
+#include <thread>   // Reductions on several threads
+#include <system_error> // A thread that cannot be started
 #include "Icd.h"
 
 #ifdef _DEBUG
@@ -2422,6 +2424,285 @@ icd::Mod(const icd& p_icd) const
 //
 //////////////////////////////////////////////////////////////////////////
 
+//////////////////////////////////////////////////////////////////////////
+//
+// ICD REDUCTIONS
+//
+//////////////////////////////////////////////////////////////////////////
+
+// Maximum number of threads (and chunks) of a reduction
+static const size_t icdReduceThreads = 64;
+// Minimum number of values for one thread of a reduction
+static const size_t icdReduceChunk   = 4096;
+// Numbers in the 64 bits sums of a chunk before the carries must be propagated
+static const size_t icdReduceCarry   = 0x40000000;
+
+// Run a reduction of p_count values in chunks on several threads
+// p_reduce(chunk,begin,end) reduces one chunk in the result of that chunk
+// With p_threads the number of chunks is fixed, otherwise it follows the hardware
+template<typename Reduce>
+static void
+ReduceChunks(size_t p_count,size_t p_threads,Reduce p_reduce)
+{
+  size_t threads = p_threads ? min(p_threads,p_count)
+                             : min((size_t)std::thread::hardware_concurrency(),p_count / icdReduceChunk);
+  threads = max(min(threads,icdReduceThreads),(size_t)1);
+
+  std::thread workers[icdReduceThreads];
+  size_t size    = p_count / threads;
+  size_t started = threads;
+  auto begin = [&](size_t p_chunk) { return p_chunk * size; };
+  auto end   = [&](size_t p_chunk) { return (p_chunk == threads - 1) ? p_count : (p_chunk + 1) * size; };
+  for(size_t ind = 1; ind < threads; ++ind)
+  {
+    try
+    {
+      workers[ind] = std::thread(p_reduce,ind,begin(ind),end(ind));
+    }
+    catch(std::system_error&)
+    {
+      // No more threads: the other chunks run on the calling thread
+      started = ind;
+      break;
+    }
+  }
+
+  // The started threads are always joined, also if a chunk of this thread throws
+  try
+  {
+    p_reduce(0,begin(0),end(0));
+    for(size_t ind = started; ind < threads; ++ind)
+    {
+      p_reduce(ind,begin(ind),end(ind));
+    }
+  }
+  catch(...)
+  {
+    for(size_t ind = 1; ind < started; ++ind)
+    {
+      workers[ind].join();
+    }
+    throw;
+  }
+  for(size_t ind = 1; ind < started; ++ind)
+  {
+    workers[ind].join();
+  }
+}
+
+// Propagate the carries of signed 64 bits sums of the m_data members
+// Returns the carry out of the last member: negative for a negative sum
+static int64
+CarrySums(int64* p_sums)
+{
+  int64 carry = 0;
+  for(int ind = 0; ind < icdLength; ++ind)
+  {
+    int64 value = p_sums[ind] + carry;
+    carry = value / icdBase;
+    value -= carry * icdBase;
+    if(value < 0)
+    {
+      value += icdBase;
+      --carry;
+    }
+    p_sums[ind] = value;
+  }
+  return carry;
+}
+
+// Icd::Sum
+// Description:   SUM of an array of numbers
+// What it does:  Every chunk adds the m_data members of its numbers (with their sign)
+//                in 64 bits sums, without a reformat per number. The sums of the chunks
+//                are added in the order of the chunks. Integer sums are exact, so the
+//                result does not depend on the number of threads or the chunk sizes.
+//                The length and precision are the greatest of all numbers.
+// Exceptions:    ICD Overflow if the sum does not fit into an icd
+//
+icd
+icd::Sum(const icd* p_numbers,size_t p_count,unsigned p_threads /*=0*/)
+{
+  int64 sums      [icdReduceThreads][icdLength];
+  int   lengths   [icdReduceThreads];
+  int   precisions[icdReduceThreads];
+  memset(sums,0,sizeof(sums));
+  memset(lengths,   0,sizeof(lengths));
+  memset(precisions,0,sizeof(precisions));
+
+  ReduceChunks(p_count,p_threads,[&](size_t p_chunk,size_t p_begin,size_t p_end)
+  {
+    int64* sum     = sums[p_chunk];
+    size_t pending = 0;
+    for(size_t ind = p_begin; ind < p_end; ++ind)
+    {
+      const icd& number = p_numbers[ind];
+      if(number.m_sign == Negative)
+      {
+        for(int pos = 0; pos < icdLength; ++pos)
+        {
+          sum[pos] -= number.m_data[pos];
+        }
+      }
+      else
+      {
+        for(int pos = 0; pos < icdLength; ++pos)
+        {
+          sum[pos] += number.m_data[pos];
+        }
+      }
+      lengths   [p_chunk] = max(lengths   [p_chunk],number.m_length);
+      precisions[p_chunk] = max(precisions[p_chunk],number.m_precision);
+      if(++pending == icdReduceCarry)
+      {
+        sum[icdLength - 1] += CarrySums(sum) * icdBase;
+        pending = 0;
+      }
+    }
+    sum[icdLength - 1] += CarrySums(sum) * icdBase;
+  });
+
+  // Add the sums of the chunks
+  int64 total[icdLength] = { 0 };
+  icd   result;
+  for(size_t chunk = 0; chunk < icdReduceThreads; ++chunk)
+  {
+    for(int pos = 0; pos < icdLength; ++pos)
+    {
+      total[pos] += sums[chunk][pos];
+    }
+    result.m_length    = max(result.m_length,   lengths[chunk]);
+    result.m_precision = max(result.m_precision,precisions[chunk]);
+  }
+  // A negative carry out of the last member: get the absolute value
+  int64 carry = CarrySums(total);
+  if(carry < 0)
+  {
+    for(int pos = 0; pos < icdLength; ++pos)
+    {
+      total[pos] = -total[pos];
+    }
+    carry = CarrySums(total) - carry;
+    result.m_sign = Negative;
+  }
+  if(carry > 0)
+  {
+    throw CString("Decimal number too big (ICD Overflow)");
+  }
+  for(int pos = 0; pos < icdLength; ++pos)
+  {
+    result.m_data[pos] = (unsigned long) total[pos];
+  }
+  if(result.IsNull())
+  {
+    result.m_sign = Positive;
+  }
+  return result;
+}
+
+// Icd::Average
+// Description:   AVG of an array of numbers
+// What it does:  The (exact) sum divided once by the number of numbers
+//
+icd
+icd::Average(const icd* p_numbers,size_t p_count,unsigned p_threads /*=0*/)
+{
+  icd sum = Sum(p_numbers,p_count,p_threads);
+  if(p_count == 0)
+  {
+    return sum;
+  }
+  return sum.Div(icd((UINT64)p_count));
+}
+
+// Icd::Minimum
+// Description:   MIN of an array of numbers
+//
+icd
+icd::Minimum(const icd* p_numbers,size_t p_count,unsigned p_threads /*=0*/)
+{
+  size_t index = ReduceExtreme(p_numbers,p_count,p_threads,-1);
+  return (index < p_count) ? p_numbers[index] : icd();
+}
+
+// Icd::Maximum
+// Description:   MAX of an array of numbers
+//
+icd
+icd::Maximum(const icd* p_numbers,size_t p_count,unsigned p_threads /*=0*/)
+{
+  size_t index = ReduceExtreme(p_numbers,p_count,p_threads,1);
+  return (index < p_count) ? p_numbers[index] : icd();
+}
+
+// Icd::OrderNumbers
+// Description:   Order of two numbers: -1 (p_one is smaller), 0 (equal) or 1 (p_one is greater)
+// What it does:  As the operators < and == but a negative zero equals zero
+//
+int
+icd::OrderNumbers(const icd& p_one,const icd& p_two)
+{
+  int signOne = p_one.IsNull() ? 0 : (p_one.m_sign == Negative ? -1 : 1);
+  int signTwo = p_two.IsNull() ? 0 : (p_two.m_sign == Negative ? -1 : 1);
+  if(signOne != signTwo || signOne == 0)
+  {
+    return (signOne < signTwo) ? -1 : (signOne > signTwo ? 1 : 0);
+  }
+  for(int pos = icdLength - 1; pos >= 0; --pos)
+  {
+    if(p_one.m_data[pos] != p_two.m_data[pos])
+    {
+      return (p_one.m_data[pos] < p_two.m_data[pos]) ? -signOne : signOne;
+    }
+  }
+  return 0;
+}
+
+// Icd::ReduceExtreme
+// Description:   Index of the first smallest or greatest number of an array
+// What it does:  Every chunk finds its first extreme. The chunks are merged in their
+//                order and only a strictly better number wins, so the index is the
+//                same for any number of threads. Returns p_count for no numbers.
+//
+size_t
+icd::ReduceExtreme(const icd* p_numbers,size_t p_count,unsigned p_threads,int p_order)
+{
+  size_t extremes[icdReduceThreads];
+  for(size_t ind = 0; ind < icdReduceThreads; ++ind)
+  {
+    extremes[ind] = p_count;
+  }
+  ReduceChunks(p_count,p_threads,[&](size_t p_chunk,size_t p_begin,size_t p_end)
+  {
+    size_t extreme = (p_begin < p_end) ? p_begin : p_count;
+    for(size_t ind = p_begin + 1; ind < p_end; ++ind)
+    {
+      if(OrderNumbers(p_numbers[ind],p_numbers[extreme]) == p_order)
+      {
+        extreme = ind;
+      }
+    }
+    extremes[p_chunk] = extreme;
+  });
+
+  size_t extreme = p_count;
+  for(size_t ind = 0; ind < icdReduceThreads; ++ind)
+  {
+    size_t index = extremes[ind];
+    if(index < p_count && (extreme == p_count || OrderNumbers(p_numbers[index],p_numbers[extreme]) == p_order))
+    {
+      extreme = index;
+    }
+  }
+  return extreme;
+}
+
+//////////////////////////////////////////////////////////////////////////
+//
+// END ICD REDUCTIONS
+//
+//////////////////////////////////////////////////////////////////////////
+
 //////////////////////////////////////////////////////////////////////////
 //
 // ICD PRIVATE FUNCTIONS
@@ -3522,10 +3803,10 @@ icd::StringToLong(CString& p_string) const
 // What it does: Transposes the fraction to the lowest m_data position
 //               10 -> 0.0000000000000000000000000000000000000010
 //                5 -> 0.0000000000000000000000000000000000000005
-icd&
+icd
 icd::Epsilon(long p_fraction) const
 {
-  static icd epsilon;
+  icd epsilon;
   epsilon.m_data[0] = p_fraction;
   return epsilon;
 }
@@ -232,6 +232,14 @@ public:
   // Modulo operation
   icd Mod(const icd& p_icd) const;
 
+  // REDUCTIONS
+  // Of an array of p_count numbers, in chunks on p_threads threads (0 = as the hardware allows)
+  // The result is the same for any number of threads. No numbers at all gives 0.0
+  static icd Sum    (const icd* p_numbers,size_t p_count,unsigned p_threads = 0);
+  static icd Average(const icd* p_numbers,size_t p_count,unsigned p_threads = 0);
+  static icd Minimum(const icd* p_numbers,size_t p_count,unsigned p_threads = 0);
+  static icd Maximum(const icd* p_numbers,size_t p_count,unsigned p_threads = 0);
+
 private:
   enum Sign          { Positive, Negative    };
   enum OperatorKind  { Adding,   Subtracting };
@@ -292,7 +300,11 @@ private:
   long    StringToLong(CString& p_string) const;
 
   // Breaking criterion for internal iterations
-  icd&    Epsilon(long p_fraction) const;
+  icd     Epsilon(long p_fraction) const;
+  // Order of two numbers (-0.0 equals 0.0): -1, 0 or 1
+  static int    OrderNumbers(const icd& p_one,const icd& p_two);
+  // Index of the first smallest (p_order = -1) or greatest (p_order = 1) number
+  static size_t ReduceExtreme(const icd* p_numbers,size_t p_count,unsigned p_threads,int p_order);
   //
   // Data members: Storing the number
   //
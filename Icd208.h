@@ -297,7 +297,7 @@ private:
   long    StringToLong(CString& p_string) const;
 
   // Breaking criterion for internal iterations
-  icd208&    Epsilon(long p_fraction) const;
+  icd208     Epsilon(long p_fraction) const;
   //
   // Data members: Storing the number
   //
@@ -1,7 +1,9 @@
 #include "stdafx.h"
 #include "CppUnitTest.h"
 #include "bcd.h"
+#include "StdException.h"
 #include "HPFCounter.h"
+#include <thread>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 
@@ -512,7 +514,7 @@ namespace UnitTest
 
       // 9988776655,4433221100
       bcd one(_T("9988776655.4433221100"));
-      bcd expect(_T("99943.86752294170705107883721621278845710"));
+      bcd expect(_T("99943.86752294170705107883721621278845728"));
       bcd result = one.SquareRoot();
 
       Assert::IsTrue(expect == result);
@@ -526,7 +528,7 @@ namespace UnitTest
       // 3,78123764321234
       bcd one(_T("9988776655.4433221112"));
       bcd two(_T("3.78123764321234"));
-      bcd expect(_T("6.46446118874655302175032245730334730318E+37"));
+      bcd expect(_T("6.464461188746553021750322457303347330339E+37"));
       bcd result = one.Power(two);
       Logger::WriteMessage(result.AsString()); 
 
@@ -563,7 +565,7 @@ namespace UnitTest
 
       // 9988776655,4433221112
       bcd one(_T("9988776655.4433221112"));
-      bcd expect(_T("23.02472796519583305299405544350891551931"));
+      bcd expect(_T("23.02472796519583305299405544350891551943"));
 
       bcd result = one.Log();
 
@@ -578,7 +580,7 @@ namespace UnitTest
 
       // 9988776655,4433221112
       bcd one(_T("9988776655.4433221112"));
-      bcd expect(_T("9.99951230260803799484589365115468478907"));
+      bcd expect(_T("9.999512302608037994845893651154684789121"));
 
       bcd result = one.Log10();
 
@@ -593,7 +595,7 @@ namespace UnitTest
 
       // 99,887766554433221112
       bcd one(_T("99.887766554433221112"));
-      bcd expect(_T("2.402734720884442281355919192444100235161E+43"));
+      bcd expect(_T("2.402734720884442281355919192444100241606E+43"));
       bcd result = one.Exp();
 
       Assert::IsTrue(expect == result);
@@ -657,7 +659,7 @@ namespace UnitTest
 
       // 0,9876543210123456
       TCHAR* a_angle = _T("0.9876543210123456");
-      TCHAR* r_sine  = _T("8.347366295099261173476093153791068840984E-1");
+      TCHAR* r_sine  = _T("8.347366295099261173476093153791068840876E-1");
 
       bcd one(a_angle);
       bcd expect(r_sine);
@@ -672,7 +674,7 @@ namespace UnitTest
 
       // 0,9876543210123456
       TCHAR* a_angle  = _T("0.9876543210123456");
-      TCHAR* r_cosine = _T("5.506493978516714425340844117564672940338E-1");
+      TCHAR* r_cosine = _T("5.50649397851671442534084411756467294031E-1");
 
       bcd one(a_angle);
       bcd expect(r_cosine);
@@ -687,7 +689,7 @@ namespace UnitTest
 
       // 0,9876543210123456
       TCHAR* a_angle   = _T("0.9876543210123456");
-      TCHAR* r_tangent = _T("1.515913088739596368439240774287234302490");
+      TCHAR* r_tangent = _T("1.515913088739596368439240774287234302418");
 
       bcd one(a_angle);
       bcd expect(r_tangent);
@@ -701,7 +703,7 @@ namespace UnitTest
       Logger::WriteMessage("Test ArcSine function of a ratio with : bcd.ArcSine()");
 
       TCHAR* a_ratio = _T("0.765498765404321098765");
-      TCHAR* r_asine = _T("8.71816131070559101024946021343034377293E-1");
+      TCHAR* r_asine = _T("8.71816131070559101024946021343034377281E-1");
 
       bcd one(a_ratio);
       bcd expect(r_asine);
@@ -717,7 +719,7 @@ namespace UnitTest
       Logger::WriteMessage("Test ArcCosine function of a ratio with : bcd.ArcCosine()");
 
       TCHAR* a_ratio   = _T("0.765498765404321098765");
-      TCHAR* r_acosine = _T("6.98980195724337518206375670296717064805E-1");
+      TCHAR* r_acosine = _T("6.98980195724337518206375670296717064817E-1");
 
       bcd one(a_ratio);
       bcd expect(r_acosine);
@@ -733,7 +735,7 @@ namespace UnitTest
       Logger::WriteMessage("Test ArcTangent function of a ratio with : bcd.ArcTangent()");
 
       TCHAR* a_ratio    = _T("0.765498765404321098765");
-      TCHAR* r_atangent = _T("6.53346752384431270749403109172000942006E-1");
+      TCHAR* r_atangent = _T("6.53346752384431270749403109172000942005E-1");
 
       bcd one(a_ratio);
       bcd expect(r_atangent);
@@ -879,7 +881,7 @@ namespace UnitTest
 
       bcd result = one.ArcTangent2Points(two);
       CString resstring = result.AsString();
-      TCHAR* expect = _T("4.065388783692102294632898803723974485214");
+      TCHAR* expect = _T("0.923796130102309056170255420444471601014");
 
       Assert::IsTrue(strcmp(expect,resstring.GetString()) == 0);
     }
@@ -1362,7 +1364,7 @@ namespace UnitTest
       bcd value(_T("0.5"));
       bcd nlog = value.Log();
 
-      CString expected = _T("-0.693147180559945309417232121458176568023");
+      CString expected = _T("-0.6931471805599453094172321214581765680755");
       CString testval  = nlog.AsString(bcd::Format::Bookkeeping, false, 30);
 
       Assert::AreEqual(expected.GetString(), testval.GetString());
@@ -1451,5 +1453,787 @@ namespace UnitTest
       Assert::IsTrue(two < one);
     }
 
+    TEST_METHOD(T102_MultiplyAllNines)
+    {
+      Logger::WriteMessage("Testing BCD multiplication carries of all-nines mantissa");
+      CString nines(_T("0."));
+      for(int ind = 0; ind < 40; ++ind)
+      {
+        nines += _T("9");
+      }
+      bcd one(nines);
+      bcd result = one * one;
+
+      // 1 - 2E-40 + 1E-80. The last digit is lost in normalizing the product
+      CString expect = nines.Left(40) + _T("8");
+      Assert::AreEqual(expect.GetString(),result.AsString().GetString());
+    }
+
+    TEST_METHOD(T103_WidthVariants)
+    {
+      Logger::WriteMessage("Testing the 24 and 120 digits variants of basic_bcd");
+      Assert::AreEqual(24, bcd24::bcdPrecision);
+      Assert::AreEqual(120,bcd120::bcdPrecision);
+
+      CString pi24(_T("3.14159265358979323846264"));
+      CString pi120(_T("3.14159265358979323846264338327950288419716939937510582097494459230781640628620899862803482534211706798214808651328230664"));
+      Assert::AreEqual(pi24.GetString(), bcd24::PI().AsString().GetString());
+      Assert::AreEqual(pi120.GetString(),bcd120::PI().AsString().GetString());
+
+      bcd24 one(_T("123456789.123"));
+      bcd24 two(_T("987.5"));
+      bcd24 result = one * two;
+      Assert::AreEqual(_T("121913579258.9625"),result.AsString().GetString());
+    }
+
+    TEST_METHOD(T104_WidthConversion)
+    {
+      Logger::WriteMessage("Testing conversion between widths of basic_bcd");
+      bcd200 big = bcd200::PI();
+      bcd small(big);
+      Assert::IsTrue(small == bcd::PI());
+
+      bcd200 back(small);
+      Assert::AreEqual(small.AsString().GetString(),back.AsString().GetString());
+      Assert::IsFalse(back == big);
+    }
+
+    TEST_METHOD(T105_ShortAndLongMantissa)
+    {
+      Logger::WriteMessage("Testing BCD arithmetic of a short mantissa with a long one");
+      bcd shortOne(_T("1234.56"));
+      bcd longOne (_T("0.1234567890123456789012345678901234567891"));
+
+      Assert::AreEqual(_T("1234.683456789012345678901234567890123456"),(shortOne + longOne).AsString().GetString());
+      Assert::AreEqual(_T("1234.436543210987654321098765432109876544"),(shortOne - longOne).AsString().GetString());
+      Assert::AreEqual(_T("152.414813443081481344308148134430814813"),(shortOne * longOne).AsString().GetString());
+
+      // Carry out of the only significant limb
+      bcd one(_T("99999999.99"));
+      bcd two(_T("0.01"));
+      Assert::AreEqual(_T("100000000.00"),(one + two).AsString().GetString());
+    }
+
+    TEST_METHOD(T106_ThreadContext)
+    {
+      Logger::WriteMessage("Testing BCD calculations running concurrently on threads");
+      bcd number(_T("0.7654321"));
+      bcd expect = number.Sine() + number.Log() + number.SquareRoot();
+
+      // Every thread does the same iterations with its own context
+      const int threads = 4;
+      bcd results[threads];
+      bool throwing[threads];
+      std::thread workers[threads];
+      for(int ind = 0; ind < threads; ++ind)
+      {
+        workers[ind] = std::thread([&,ind]()
+        {
+          bcd::ErrorThrows(false);
+          for(int loop = 0; loop < 20; ++loop)
+          {
+            results[ind] = number.Sine() + number.Log() + number.SquareRoot();
+          }
+          throwing[ind] = bcd_context::Current().m_throwing;
+        });
+      }
+      for(int ind = 0; ind < threads; ++ind)
+      {
+        workers[ind].join();
+        Assert::IsTrue(results[ind] == expect);
+        Assert::IsFalse(throwing[ind]);
+      }
+      // Error mode of the threads did not change ours
+      Assert::IsTrue(bcd_context::Current().m_throwing);
+    }
+
+    TEST_METHOD(T107_StatusFlags)
+    {
+      Logger::WriteMessage("Testing BCD sticky status flags without exceptions");
+      bcd::ErrorThrows(false);
+      bcd_context& context = bcd_context::Current();
+      context.ClearStatus();
+
+      bcd one(1L);
+      bcd three(3L);
+      bcd result = bcd(6L) / three;
+      Assert::IsFalse(context.TestStatus(bcd_context::StatusInexact));
+      result = one / three;
+      Assert::IsTrue(context.TestStatus(bcd_context::StatusInexact));
+
+      // Flags are sticky until cleared
+      result = one / bcd(0L);
+      Assert::IsFalse(result.IsValid());
+      Assert::IsTrue(context.TestStatus(bcd_context::StatusDivideByZero | bcd_context::StatusInexact));
+      Assert::IsFalse(context.TestStatus(bcd_context::StatusInvalid));
+
+      context.ClearStatus();
+      result = bcd(-1L).SquareRoot();
+      Assert::IsTrue(context.TestStatus(bcd_context::StatusInvalid));
+
+      context.ClearStatus();
+      bcd big(_T("1E20000"));
+      result = big * big;
+      Assert::IsFalse(result.IsValid());
+      Assert::IsTrue(context.TestStatus(bcd_context::StatusOverflow));
+
+      context.ClearStatus();
+      short number = bcd(_T("100000")).AsShort();
+      Assert::AreEqual((short)0,number);
+      Assert::IsTrue(context.TestStatus(bcd_context::StatusOverflow));
+
+      // Fits-tests leave the status as it was
+      context.ClearStatus();
+      Assert::IsFalse(bcd(_T("1E30")).GetFitsInInt64());
+      Assert::IsFalse(context.TestStatus(bcd_context::StatusOverflow));
+      bcd::ErrorThrows(true);
+    }
+
+    TEST_METHOD(T108_SmallIntegerOperators)
+    {
+      Logger::WriteMessage("Testing BCD multiplication, division and modulo by an int");
+      bcd one(_T("1234.5678"));
+
+      Assert::AreEqual(_T("152415776390.7942"),(one * 123456789).AsString().GetString());
+      Assert::AreEqual(_T("-45679.0086"),      (one * -37).AsString().GetString());
+      Assert::AreEqual(_T("176.3668285714285714285714285714285714285"),(one / 7).AsString().GetString());
+      Assert::AreEqual(_T("-5.748904312843877967840003766044976080788E-7"),(one / -2147483647).AsString(bcd::Format::Engineering).GetString());
+      Assert::AreEqual(_T("2.5678"), (one % 7).AsString().GetString());
+      Assert::AreEqual(_T("-2.5678"),((-one) % 7).AsString().GetString());
+
+      // An int can have more digits than one mantissa element
+      Assert::AreEqual(_T("-2147483647.00"),bcd(-2147483647).AsString().GetString());
+    }
+
+    TEST_METHOD(T109_DivMod)
+    {
+      Logger::WriteMessage("Testing bcd quotient and remainder in one division");
+      bcd number(_T("1234.5678"));
+      bcd divisor(_T("-7.5"));
+      bcd quotient;
+      bcd remainder;
+
+      // Quotient is truncated, remainder has the sign of the number
+      number.DivMod(divisor,quotient,remainder);
+      Assert::AreEqual(_T("-164.00"),quotient.AsString().GetString());
+      Assert::AreEqual(_T("4.5678"), remainder.AsString().GetString());
+      (-number).DivMod(divisor,quotient,remainder);
+      Assert::AreEqual(_T("164.00"), quotient.AsString().GetString());
+      Assert::AreEqual(_T("-4.5678"),remainder.AsString().GetString());
+      Assert::AreEqual(_T("-3.00"),fmod(bcd(-23),bcd(5)).AsString().GetString());
+
+      // Remainder stays exact for a quotient with many digits
+      bcd big(_T("5239304169727748290263825497310000000000"));
+      Assert::AreEqual(_T("33023352.00"),(big % bcd(123456789L)).AsString().GetString());
+      Assert::AreEqual(_T("4.00"),(bcd(_T("1E1000")) % bcd(7L)).AsString().GetString());
+    }
+
+    TEST_METHOD(T110_ToChars)
+    {
+      Logger::WriteMessage("Testing bcd formatting into a buffer");
+      char  buffer[100];
+      char* last = nullptr;
+
+      last = bcd(_T("-1234.5678")).ToChars(buffer,buffer + 100);
+      *last = 0;
+      Assert::AreEqual("-1234.5678",buffer);
+      last = bcd(_T("42")).ToChars(buffer,buffer + 100,bcd::Format::Bookkeeping,3);
+      *last = 0;
+      Assert::AreEqual("42.000",buffer);
+      last = bcd(_T("0.00012")).ToChars(buffer,buffer + 100);
+      *last = 0;
+      Assert::AreEqual("0.00012",buffer);
+      last = bcd(_T("1.5E-300")).ToChars(buffer,buffer + 100);
+      *last = 0;
+      Assert::AreEqual("1.5E-300",buffer);
+
+      // Engineering format as in AsString
+      bcd number(_T("98765432109876543210.0123456789"));
+      last = number.ToChars(buffer,buffer + 100,bcd::Format::Engineering);
+      *last = 0;
+      Assert::AreEqual("9.87654321098765432100123456789E19",buffer);
+
+      // Nothing is written beyond the buffer
+      Assert::IsNull(number.ToChars(buffer,buffer + 10));
+
+      // Rounding carries into the digits before it
+      number = bcd(_T("9.996"));
+      number.Round(2);
+      Assert::AreEqual(_T("10.00"),number.AsString().GetString());
+    }
+
+    TEST_METHOD(T111_FromChars)
+    {
+      Logger::WriteMessage("Testing bcd parsing from a buffer");
+      const char* text = "-98765432109876543210.0123456789E-5;12";
+      bcd number;
+
+      // Parsing stops at the first character that is not part of the number
+      bcd_chars_result result = number.FromChars(text,text + strlen(text));
+      Assert::AreEqual(35,(int)(result.ptr - text));
+      Assert::AreEqual((unsigned)bcd_context::StatusNone,result.status);
+      Assert::AreEqual(_T("-987654321098765.432100123456789"),number.AsString().GetString());
+
+      text   = "0.000012345678901234abc";
+      result = number.FromChars(text,text + strlen(text));
+      Assert::AreEqual(20,(int)(result.ptr - text));
+      Assert::AreEqual(_T("1.2345678901234E-5"),number.AsString(bcd::Format::Engineering).GetString());
+
+      // An 'E' without digits is not part of the number
+      text   = "42e+";
+      result = number.FromChars(text,text + strlen(text));
+      Assert::AreEqual(2,(int)(result.ptr - text));
+      Assert::AreEqual(_T("42.00"),number.AsString().GetString());
+
+      // No number: nothing is read and the value stays
+      text   = "-.E5";
+      result = number.FromChars(text,text + strlen(text));
+      Assert::IsTrue(result.ptr == text);
+      Assert::AreEqual((unsigned)bcd_context::StatusInvalid,result.status);
+      Assert::AreEqual(_T("42.00"),number.AsString().GetString());
+
+      text   = "1E40000";
+      result = number.FromChars(text,text + strlen(text));
+      Assert::AreEqual((unsigned)bcd_context::StatusOverflow,result.status);
+      Assert::AreEqual(_T("42.00"),number.AsString().GetString());
+
+      text   = "-INF";
+      result = number.FromChars(text,text + strlen(text));
+      Assert::AreEqual(_T("-INF"),number.AsString().GetString());
+    }
+
+    TEST_METHOD(T112_NumericAllDigits)
+    {
+      Logger::WriteMessage("Testing bcd to and from a SQL_NUMERIC_STRUCT with 38 digits");
+      const SQLCHAR value[SQL_MAX_NUMERIC_LEN] =
+      {
+        0x4E, 0xF3, 0x38, 0xDE, 0x50, 0x90, 0x49, 0xC4, 0x13, 0x33, 0x02, 0xF0, 0xF6, 0xB0, 0x49, 0x09
+      };
+      SQL_NUMERIC_STRUCT num;
+      memset(&num,0,sizeof(SQL_NUMERIC_STRUCT));
+
+      bcd number(_T("-1234567890123456789012345678.9012345678"));
+      number.AsNumeric(&num);
+      Assert::AreEqual(38,(int)num.precision);
+      Assert::AreEqual(10,(int)num.scale);
+      Assert::AreEqual(0, (int)num.sign);
+      Assert::AreEqual(0,memcmp(value,num.val,SQL_MAX_NUMERIC_LEN));
+
+      bcd result(&num);
+      Assert::IsTrue(number == result);
+      // A bcd24 keeps the first 24 digits
+      bcd24 small(&num);
+      Assert::AreEqual(_T("-1.23456789012345678901234E27"),small.AsString().GetString());
+    }
+
+    TEST_METHOD(T113_NumericArray)
+    {
+      Logger::WriteMessage("Testing bcd arrays to and from SQL_NUMERIC_STRUCT");
+      const size_t count = 20000;
+      bcd* numbers = new bcd[count];
+      bcd* results = new bcd[count];
+      SQL_NUMERIC_STRUCT* numerics = new SQL_NUMERIC_STRUCT[count];
+      for(size_t ind = 0; ind < count; ++ind)
+      {
+        numbers[ind] = bcd((long)ind) / 8;
+      }
+
+      // Every value gets its own precision and scale
+      Assert::AreEqual((size_t)0,bcd::AsNumericArray(numbers,numerics,count));
+      Assert::AreEqual(3,(int)numerics[3].scale);
+      Assert::AreEqual(1,(int)numerics[4].scale);
+      bcd::FromNumericArray(numerics,results,count);
+      for(size_t ind = 0; ind < count; ++ind)
+      {
+        Assert::IsTrue(numbers[ind] == results[ind]);
+      }
+
+      // All values as a NUMERIC(6,2) column. Digits behind the scale are truncated
+      numbers[7] = bcd(_T("-1234.5678"));
+      Assert::AreEqual((size_t)0,bcd::AsNumericArray(numbers,numerics,count,6,2));
+      Assert::AreEqual(6,(int)numerics[3].precision);
+      Assert::AreEqual(2,(int)numerics[3].scale);
+      bcd::FromNumericArray(numerics,results,count);
+      Assert::AreEqual(_T("0.37"),results[3].AsString().GetString());
+      Assert::AreEqual(_T("-1234.56"),results[7].AsString().GetString());
+
+      // Values that do not fit are counted (or throw once)
+      bcd::ErrorThrows(false);
+      bcd_context::Current().ClearStatus();
+      Assert::AreEqual((size_t)(count - 8000 + 1),bcd::AsNumericArray(numbers,numerics,count,5,2));
+      Assert::IsTrue(bcd_context::Current().TestStatus(bcd_context::StatusOverflow));
+      bcd::ErrorThrows(true);
+
+      delete [] numbers;
+      delete [] results;
+      delete [] numerics;
+    }
+
+    TEST_METHOD(T114_ColumnOperations)
+    {
+      Logger::WriteMessage("Testing bcd column operations on arrays");
+      const size_t count = 1000;
+      bcd* one    = new bcd[count];
+      bcd* two    = new bcd[count];
+      bcd* result = new bcd[count];
+      for(size_t ind = 0; ind < count; ++ind)
+      {
+        one[ind] = bcd((long)ind) / 4;
+        two[ind] = bcd(_T("-2.5")) + bcd((long)(ind % 7));
+      }
+
+      // Every element is the same as the scalar operator
+      bcd::Add(one,two,result,count);
+      for(size_t ind = 0; ind < count; ++ind)
+      {
+        Assert::IsTrue(result[ind] == one[ind] + two[ind]);
+      }
+      bcd::Sub(one,two,result,count,true);
+      for(size_t ind = 0; ind < count; ++ind)
+      {
+        Assert::IsTrue(result[ind] == one[ind] - two[ind]);
+      }
+      bcd::Mul(one,two,result,count,true);
+      for(size_t ind = 0; ind < count; ++ind)
+      {
+        Assert::IsTrue(result[ind] == one[ind] * two[ind]);
+      }
+      Assert::AreEqual(_T("-0.25"),result[2].AsString().GetString());
+
+      // In place: the result is the first argument
+      bcd::Scale(one,bcd(_T("0.5")),one,count,true);
+      Assert::AreEqual(_T("1.5"),one[12].AsString(bcd::Format::Bookkeeping,false,1).GetString());
+      bcd::Sub(one,one,one,count);
+      for(size_t ind = 0; ind < count; ++ind)
+      {
+        Assert::IsTrue(one[ind].IsZero());
+      }
+
+      // A NULL element goes the way of the scalar operator, the others are calculated
+      bcd::ErrorThrows(false);
+      two[3].SetNULL();
+      bcd::Add(one,two,result,count);
+      Assert::IsFalse(result[3].IsValid());
+      Assert::IsTrue(result[4] == two[4]);
+      bcd::ErrorThrows(true);
+
+      delete [] one;
+      delete [] two;
+      delete [] result;
+    }
+
+    TEST_METHOD(T115_Accumulator)
+    {
+      Logger::WriteMessage("Testing the exact accumulator of a bcd sum");
+      bcd::Accumulator sum;
+      Assert::IsTrue(sum.Result().IsZero());
+
+      // Numbers far apart: the operator + would lose the small ones
+      bcd big(_T("1E30"));
+      sum.Add(big);
+      for(int ind = 0; ind < 1000; ++ind)
+      {
+        sum.Add(bcd(_T("0.01")));
+      }
+      sum.Sub(big);
+      Assert::AreEqual(_T("10.00"),sum.Result().AsString().GetString());
+      Assert::AreEqual((uint64)1002,sum.GetCount());
+
+      // Negative sums and the order of the numbers
+      bcd numbers[5] = { bcd(_T("-123.45")), bcd(_T("0.001")), bcd(_T("-7E-5")), bcd(_T("99.9")), bcd(_T("-1000")) };
+      bcd::Accumulator forward;
+      bcd::Accumulator backward;
+      bcd operators;
+      forward.Add(numbers,5);
+      for(int ind = 4; ind >= 0; --ind)
+      {
+        backward += numbers[ind];
+        operators += numbers[ind];
+      }
+      Assert::IsTrue(forward.Result() == operators);
+      Assert::IsTrue(backward.Result() == operators);
+      Assert::AreEqual(_T("-1023.54907"),forward.Result().AsString(bcd::Format::Bookkeeping,false,5).GetString());
+
+      // Partial sums give the same sum
+      forward.Add(backward);
+      Assert::IsTrue(forward.Result() == operators * 2);
+
+      // Rounded once to the precision
+      bcd::Accumulator rounding;
+      rounding.Add(bcd(_T("0.2")));
+      rounding.Add(bcd(_T("1E-40")));
+      rounding.Add(bcd(_T("-1E-41")));
+      rounding.Add(bcd(_T("-1E-42")));
+      bcd_context::Current().ClearStatus();
+      Assert::IsTrue(rounding.Result() == bcd(_T("0.2")) + bcd(_T("1E-40")));
+      Assert::IsTrue(bcd_context::Current().TestStatus(bcd_context::StatusInexact));
+
+      // A NULL goes the way of the operator +
+      bcd::ErrorThrows(false);
+      bcd null;
+      null.SetNULL();
+      sum.Add(null);
+      Assert::IsFalse(sum.Result().IsValid());
+      sum.Clear();
+      Assert::IsTrue(sum.Result().IsZero());
+      bcd::ErrorThrows(true);
+    }
+
+    TEST_METHOD(T116_Reductions)
+    {
+      Logger::WriteMessage("Testing SUM, AVG, MIN and MAX of a bcd array on several threads");
+      const size_t count = 10000;
+      bcd* numbers = new bcd[count];
+      for(size_t ind = 0; ind < count; ++ind)
+      {
+        numbers[ind] = bcd((long)(ind % 1000)) / 8 - bcd(_T("12.5"));
+      }
+      numbers[4].SetNULL();
+      numbers[5000] = bcd(_T("-1E-30"));
+      numbers[7777] = bcd(_T("123456.75"));
+
+      // The same sum for any number of threads
+      bcd sum = bcd::Sum(numbers,count,1);
+      for(unsigned threads = 2; threads <= 8; ++threads)
+      {
+        bcd other = bcd::Sum(numbers,count,threads);
+        Assert::IsTrue(other == sum);
+        Assert::AreEqual(sum.AsString(bcd::Format::Engineering).GetString(),other.AsString(bcd::Format::Engineering).GetString());
+      }
+      bcd::Accumulator accumulator;
+      for(size_t ind = 0; ind < count; ++ind)
+      {
+        if(!numbers[ind].IsNULL())
+        {
+          accumulator.Add(numbers[ind]);
+        }
+      }
+      Assert::IsTrue(sum == accumulator.Result());
+      Assert::IsTrue(bcd::Average(numbers,count,3) == sum / bcd(9999));
+
+      Assert::AreEqual(_T("123456.75"),bcd::Maximum(numbers,count,5).AsString().GetString());
+      Assert::IsTrue(bcd::Minimum(numbers,count,5) == bcd(_T("-12.5")));
+
+      // NULL numbers are skipped, without numbers the result is NULL
+      Assert::IsTrue(bcd::Sum(numbers,0).IsNULL());
+      Assert::IsTrue(bcd::Minimum(&numbers[4],1).IsNULL());
+      delete [] numbers;
+    }
+
+    TEST_METHOD(T117_FusedMultiplyAdd)
+    {
+      Logger::WriteMessage("Testing FusedMultiplyAdd and DotProduct of bcd");
+      // An invoice line: the same as the operators when nothing gets lost
+      bcd line = bcd::FusedMultiplyAdd(bcd(_T("19.99")),bcd(3),bcd(_T("2.50")));
+      Assert::AreEqual(_T("62.47"),line.AsString().GetString());
+      Assert::IsTrue(bcd::FusedMultiplyAdd(bcd(_T("-1.5")),bcd(_T("4")),bcd(_T("6"))).IsZero());
+
+      // Rounded only once: the operators lose the last digit of the product
+      bcd one(_T("1.000000000000000000001"));
+      bcd fused = bcd::FusedMultiplyAdd(one,one,bcd(-1));
+      Assert::IsTrue(fused == bcd(_T("2.000000000000000000001E-21")));
+      Assert::IsTrue(one * one - bcd(1) == bcd(_T("2E-21")));
+
+      // Sum of the products, the same as the operators and the accumulator
+      const size_t count = 1000;
+      bcd* prices     = new bcd[count];
+      bcd* quantities = new bcd[count];
+      bcd  total;
+      bcd::Accumulator accumulator;
+      for(size_t ind = 0; ind < count; ++ind)
+      {
+        prices[ind]     = bcd((long)ind) / 4 - bcd(_T("99.75"));
+        quantities[ind] = bcd((long)(ind % 7));
+        total += prices[ind] * quantities[ind];
+        accumulator.AddProduct(prices[ind],quantities[ind]);
+      }
+      bcd dot = bcd::DotProduct(prices,quantities,count);
+      Assert::IsTrue(dot == total);
+      Assert::IsTrue(dot == accumulator.Result());
+      Assert::IsTrue(bcd::DotProduct(prices,quantities,0).IsZero());
+
+      // A NULL goes the way of the operators
+      bcd::ErrorThrows(false);
+      prices[10].SetNULL();
+      Assert::IsFalse(bcd::DotProduct(prices,quantities,count).IsValid());
+      bcd::ErrorThrows(true);
+      delete [] prices;
+      delete [] quantities;
+    }
+
+    TEST_METHOD(T118_Compare)
+    {
+      Logger::WriteMessage("Testing the three way comparison of bcd");
+      bcd null;
+      null.SetNULL();
+      bcd numbers[10] = { null, bcd(_T("-1E30")), bcd(_T("-12.5")), bcd(_T("-12.49999999")), bcd(),
+                          bcd(_T("0.001")), bcd(_T("1.000000000000000000000000000000000001")), bcd(_T("1.000000000000000000000000000000000002")),
+                          bcd(_T("3E10")), bcd(_T("3E11")) };
+      // Every number against every other one: the order of the array
+      for(int one = 0; one < 10; ++one)
+      {
+        for(int two = 0; two < 10; ++two)
+        {
+          int expect = (one < two) ? -1 : (one > two) ? 1 : 0;
+          Assert::AreEqual(expect,numbers[one].Compare(numbers[two]));
+          if(one && two)
+          {
+            Assert::AreEqual(one < two, numbers[one] <  numbers[two]);
+            Assert::AreEqual(one > two, numbers[one] >  numbers[two]);
+            Assert::AreEqual(one <= two,numbers[one] <= numbers[two]);
+            Assert::AreEqual(one >= two,numbers[one] >= numbers[two]);
+          }
+        }
+      }
+      // Zero is not greater than a small number
+      Assert::IsFalse(bcd(_T("0.001")) < bcd());
+      Assert::IsTrue (bcd() < bcd(_T("0.001")));
+
+      // INF and NaN come after all numbers, but compare to nothing with the operators
+      bcd::ErrorThrows(false);
+      bcd infinity = bcd(1) / bcd();
+      bcd::ErrorThrows(true);
+      Assert::AreEqual(1,infinity.Compare(numbers[9]));
+      Assert::AreEqual(-1,null.Compare(infinity));
+      Assert::IsFalse(infinity > numbers[9]);
+
+      // Subtraction with the bigger number second
+      Assert::AreEqual(_T("-0.00000001"),(numbers[2] - numbers[3]).AsString().GetString());
+      Assert::AreEqual(_T("0.00000001"), (numbers[3] - numbers[2]).AsString().GetString());
+    }
+
+    TEST_METHOD(T119_MixedComparison)
+    {
+      Logger::WriteMessage("Testing comparisons of bcd with int, int64, double and strings");
+      bcd amount(_T("1000.5"));
+      Assert::IsTrue (amount > 1000);
+      Assert::IsFalse(amount < 1000);
+      Assert::IsTrue (amount < 1001);
+      Assert::IsTrue (amount != 1000);
+      Assert::IsTrue (bcd(-1000) == -1000);
+      Assert::IsTrue (bcd() == 0);
+      Assert::IsTrue (bcd(_T("0.001")) > 0);
+      Assert::IsTrue (bcd(_T("-0.001")) < 0);
+
+      // Integers with 19 and 20 digits, and a number with more limbs
+      int64 big = 9223372036854775807LL;
+      Assert::IsTrue (bcd(_T("9223372036854775807"))  == big);
+      Assert::IsTrue (bcd(_T("9223372036854775806"))  <  big);
+      Assert::IsTrue (bcd(_T("9223372036854775807.5")) > big);
+      Assert::IsTrue (bcd(_T("-9223372036854775808")) == -big - 1);
+      Assert::IsTrue (bcd(_T("1E19")) > big);
+
+      // Doubles as they are written, also the ones that SetValueDouble rounds
+      Assert::IsTrue (bcd(148689779) == 148689779.0);
+      Assert::IsTrue (amount == 1000.5);
+      Assert::IsTrue (amount >  1000.25);
+      Assert::IsTrue (amount <= 1000.75);
+      Assert::IsTrue (amount <  2E10);
+      Assert::IsTrue (amount >  -0.5);
+      Assert::IsTrue (bcd(_T("0.1")) == 0.1);
+
+      // The double next to a short decimal is not that decimal
+      Assert::IsFalse(bcd(_T("31.83652505")) == 31.836525050000002);
+      Assert::IsTrue (bcd(_T("31.83652505")) <  31.836525050000002);
+      Assert::IsFalse(bcd(_T("836E-8")) == 8.360000000000008E-6);
+      Assert::IsTrue (bcd(_T("836E-8")) <  8.360000000000008E-6);
+      Assert::IsTrue (bcd(_T("31.836525050000002")) == 31.836525050000002);
+      Assert::IsTrue (bcd(_T("68.10194865100001"))  == 68.10194865100001);
+
+      // A number made from a double is equal to that double
+      const double doubles[] = { 1.0 / 3, 0.1 + 0.2, 31.836525050000002, 0.1, -2.5E-7, 148689779.0
+                               , 123456.123456789, 9007199254740993.0, 1E-310, -4.9E-324, 1.7976931348623157E308
+                               , -1E300, 2.2250738585072014E-308, 0.0 };
+      for(double value : doubles)
+      {
+        bcd number(value);
+        Assert::IsTrue (number == value);
+        Assert::IsFalse(number <  value);
+        Assert::IsFalse(number >  value);
+      }
+      Assert::AreEqual(_T("0.3333333333333333"),bcd(1.0 / 3).AsString().GetString());
+      Assert::IsTrue (bcd(0.1 + 0.2) == bcd(_T("0.30000000000000004")));
+
+      // Strings, also from a buffer that gets another number
+      TCHAR buffer[20] = _T("1000.50");
+      Assert::IsTrue(amount == buffer);
+      _tcscpy_s(buffer,20,_T("1000.25"));
+      Assert::IsTrue(amount > buffer);
+      Assert::IsTrue(amount >= _T("1000.5"));
+
+      // NULL compares to nothing
+      bcd null;
+      null.SetNULL();
+      Assert::IsFalse(null == 0);
+      Assert::IsFalse(null <  1.5);
+      Assert::IsFalse(null >  big);
+    }
+
+    TEST_METHOD(T120_PowerInteger)
+    {
+      Logger::WriteMessage("Test power with a whole exponent: bcd.Power()");
+      // Exact, as long as the result fits in the mantissa
+      Assert::IsTrue(bcd(_T("1.05")).Power(bcd(12)) == bcd(_T("1.795856326022129150390625")));
+      Assert::IsTrue(bcd(_T("1.05")).Power(bcd(_T("12.0"))) == bcd(_T("1.795856326022129150390625")));
+      Assert::IsTrue(bcd(2).Power(bcd(-10)) == bcd(_T("0.0009765625")));
+      Assert::IsTrue(bcd(-2).Power(bcd(3))  == bcd(-8));
+      Assert::IsTrue(bcd(-2).Power(bcd(4))  == bcd(16));
+      Assert::IsTrue(bcd(_T("123.456")).Power(bcd(0)) == bcd(1));
+      Assert::IsTrue(bcd().Power(bcd(5)).IsZero());
+
+      // Monthly interest over 30 years: every product is rounded only once
+      bcd rate(_T("1.0041666666666666666666666666666666666667"));
+      bcd expect(_T("4.467744314006132212428070110413015896031"));
+      bcd result = rate.Power(bcd(360));
+      Assert::IsTrue((result - expect).AbsoluteValue() < bcd(_T("1E-35")));
+      Assert::IsTrue(rate.Power(bcd(-360)) == result.Reciprocal());
+    }
+
+    TEST_METHOD(T121_ExpReduction)
+    {
+      Logger::WriteMessage("Test e-power over the whole range with: bcd.Exp()");
+      // A multiple of ln(10) gives a power of ten in the exponent
+      // (the 40 digits of 100 * ln(10) are 1.01E-38 below it)
+      bcd lnGoogol(_T("230.2585092994045684017991454684364207601"));
+      Assert::IsTrue((lnGoogol.Exp() / bcd(_T("1E100")) - bcd(1)).AbsoluteValue() < bcd(_T("2E-38")));
+
+      bcd expect(_T("3.078724698804883464177286839363786373009E-435"));
+      bcd result = bcd(_T("-1000.5")).Exp();
+      Assert::IsTrue((result / expect - bcd(1)).AbsoluteValue() < bcd(_T("1E-38")));
+      Assert::IsTrue((bcd(_T("2.5")).Exp() * bcd(_T("-2.5")).Exp() - bcd(1)).AbsoluteValue() < bcd(_T("1E-38")));
+
+      // Beyond the range of the exponent: zero or overflow
+      Assert::IsTrue(bcd(_T("-80000")).Exp().IsZero());
+      bcd::ErrorThrows(false);
+      Assert::IsFalse(bcd(_T("80000")).Exp().IsValid());
+      bcd_context::Current().ClearStatus();
+      bcd::ErrorThrows(true);
+    }
+
+    TEST_METHOD(T122_LogReduction)
+    {
+      Logger::WriteMessage("Test natural logarithm over the whole range with: bcd.Log()");
+      // Small numbers, numbers just below one and large numbers
+      Assert::IsTrue(bcd(_T("0.0123")).Log()  == bcd(_T("-4.398156016603765240809957208777523537381")));
+      Assert::IsTrue(bcd(_T("0.9999")).Log()  == bcd(_T("-1.000050003333583353335000142869643968354E-4")));
+      Assert::IsTrue(bcd(_T("4.5E3000")).Log() == bcd(_T("6909.259356378913326127347622405479497645")));
+      Assert::IsTrue(bcd(1).Log().IsZero());
+      Assert::IsTrue(bcd(2).Log() == bcd::LN2());
+
+      // Round trip with the exponent
+      bcd number(_T("1234.5678"));
+      Assert::IsTrue((number.Log().Exp() - number).AbsoluteValue() < bcd(_T("1E-33")));
+
+      // Zero has no logarithm
+      bcd::ErrorThrows(false);
+      Assert::IsFalse(bcd().Log().IsValid());
+      bcd_context::Current().ClearStatus();
+      bcd::ErrorThrows(true);
+    }
+
+    TEST_METHOD(T123_SinCos)
+    {
+      Logger::WriteMessage("Test sine and cosine in one go with: bcd.SinCos()");
+      // The same outcome as the separate functions in all quadrants
+      const TCHAR* angles[] = { _T("0.9876543210123456"), _T("2.5"), _T("-4"), _T("5.5"), _T("0") };
+      for(auto angle : angles)
+      {
+        bcd number(angle);
+        bcd sine,cosine;
+        number.SinCos(sine,cosine);
+        Assert::IsTrue(sine   == number.Sine());
+        Assert::IsTrue(cosine == number.Cosine());
+        Assert::IsTrue((sine * sine + cosine * cosine - bcd(1)).AbsoluteValue() < bcd(_T("1E-38")));
+      }
+
+      // A large angle keeps all digits after the reduction
+      bcd sine,cosine;
+      sincos(bcd(1000000),sine,cosine);
+      Assert::IsTrue((sine   - bcd(_T("-0.3499935021712929521176524867807714690614"))).AbsoluteValue() < bcd(_T("1E-39")));
+      Assert::IsTrue((cosine - bcd(_T("0.9367521275331447869385325350749187757081"))).AbsoluteValue() < bcd(_T("1E-39")));
+      Assert::IsTrue(bcd(1000000).Tangent() == sine / cosine);
+
+      bcd null;
+      null.SetNULL();
+      null.SinCos(sine,cosine);
+      Assert::IsTrue(sine.IsNULL() && cosine.IsNULL());
+    }
+
+    TEST_METHOD(T124_SquareRootNewton)
+    {
+      Logger::WriteMessage("Test root with doubling precision: bcd.SquareRoot()");
+      // Truncated as a division, also for an odd exponent and just below a power of ten
+      Assert::IsTrue(bcd(2).SquareRoot()           == bcd(_T("1.414213562373095048801688724209698078569")));
+      Assert::IsTrue(bcd(_T("1E301")).SquareRoot() == bcd(_T("3.162277660168379331998893544432718533719E150")));
+      bcd below = bcd(1) - bcd(_T("1E-40"));
+      Assert::IsTrue(below.SquareRoot() == below);
+
+      // Exact roots stay exact
+      bcd_context& context = bcd_context::Current();
+      context.ClearStatus();
+      Assert::IsTrue(bcd(_T("1.44E-300")).SquareRoot() == bcd(_T("1.2E-150")));
+      Assert::IsTrue(bcd(_T("15241578780673678515622620750190521")).SquareRoot() == bcd(_T("123456789123456789")));
+      Assert::IsFalse(context.TestStatus(bcd_context::StatusInexact));
+      bcd(2).SquareRoot();
+      Assert::IsTrue(context.TestStatus(bcd_context::StatusInexact));
+      context.ClearStatus();
+    }
+
+    TEST_METHOD(T125_AngleTooLarge)
+    {
+      Logger::WriteMessage("Test angles too large to reduce: bcd.Sine(), bcd.Cosine()");
+      // Up to 10^(precision - 1) the reduction keeps all digits
+      bcd sine,cosine;
+      bcd(_T("-1E39")).SinCos(sine,cosine);
+      Assert::IsTrue((sine   - bcd(_T("-0.250845217610732251032397536516534611955"))).AbsoluteValue() < bcd(_T("1E-39")));
+      Assert::IsTrue((cosine - bcd(_T("-0.9680272087094579091858723481700939776489"))).AbsoluteValue() < bcd(_T("1E-39")));
+
+      // Beyond that no digits are left: NaN and the invalid status
+      bcd::ErrorThrows(false);
+      bcd_context& context = bcd_context::Current();
+      context.ClearStatus();
+      Assert::IsTrue(bcd(_T("1E44")).Cosine().GetStatus()  == bcd::Sign::NaN);
+      Assert::IsTrue(bcd(_T("-1E40")).Cosine().GetStatus() == bcd::Sign::NaN);
+      Assert::IsTrue(bcd(_T("-1E40")).Tangent().GetStatus() == bcd::Sign::NaN);
+      Assert::IsTrue(bcd24(_T("5.72E26")).Sine().GetStatus() == bcd24::Sign::NaN);
+      bcd(_T("1E40")).SinCos(sine,cosine);
+      Assert::IsTrue(sine.GetStatus() == bcd::Sign::NaN && cosine.GetStatus() == bcd::Sign::NaN);
+      Assert::IsTrue(context.TestStatus(bcd_context::StatusInvalid));
+      Assert::IsFalse(context.TestStatus(bcd_context::StatusOverflow));
+      context.ClearStatus();
+      bcd::ErrorThrows(true);
+
+      Assert::ExpectException<StdException>([]{ bcd(_T("1E44")).Sine(); });
+    }
+
+    TEST_METHOD(T126_DivisionKernel)
+    {
+      Logger::WriteMessage("Test the long division one limb per step: bcd / bcd, bcd % bcd");
+      // The quotient limb estimate is one too high and the divisor is added back
+      Assert::IsTrue(bcd(_T("1.000000199999998999999984999999999999998")) / bcd(_T("1.9999999999999981234567899999999"))
+                  == bcd(_T("5.000000999999999691358888271604960410848E-1")));
+      Assert::IsTrue(bcd(_T("1.999999810000000499999993314527899999998")) / bcd(_T("1.99999981000000050000000"))
+                  == bcd(_T("9.999999999999999999999966572636324400449E-1")));
+      Assert::IsTrue(bcd(_T("5.999999910000000753993334809284095064174")) / bcd(_T("2.000000010000000499999999999999899999999"))
+                  == bcd(_T("2.99999993999999992699668276965880193462")));
+
+      // Divisors of several limbs, and with a leading limb of 1 (the largest scaling factor)
+      bcd number(_T("9.876543210987654321098765432109876543210"));
+      Assert::IsTrue(number / bcd(_T("1.0000000987654321"))
+                  == bcd(_T("9.876542235526692775404982385288538767298")));
+      Assert::IsTrue(number / bcd(_T("1.000000000000000000000000000000000000001"))
+                  == bcd(_T("9.8765432109876543210987654321098765432")));
+      Assert::IsTrue(bcd(_T("123456789.123456789")) / bcd(1) == bcd(_T("123456789.123456789")));
+
+      // The same add back for the remainder
+      bcd quotient;
+      bcd remainder;
+      bcd(_T("6.0000000000000001234567885613349")).DivMod(bcd(_T("1.0000000000000001000000000000001")),quotient,remainder);
+      Assert::IsTrue(quotient  == bcd(5));
+      Assert::IsTrue(remainder == bcd(_T("0.9999999999999996234567885613344")));
+      bcd(_T("6.000000000000001500000005000000099999998")).DivMod(bcd(_T("2.000000000000000500000004999999900000001")),quotient,remainder);
+      Assert::IsTrue(quotient  == bcd(2));
+      Assert::IsTrue(remainder == bcd(_T("2.000000000000000499999995000000299999996")));
+    }
   };
 }
\ No newline at end of file
@@ -137,7 +137,7 @@ namespace UnitTest
       bcd200 ln2 = bcd200::LN2();
       CString ln2_string = ln2.AsString();
     //CString expect(_T("0.6931471805599453094172321214581765680755"));
-      CString expect(_T("0.69314718055994530941723212145817656807550013436025525412068000949339362196969471560586332699641868754200148102057068573368552023575813055703267075163507596193072757082837143519030703862389167347111855"));
+      CString expect(_T("0.69314718055994530941723212145817656807550013436025525412068000949339362196969471560586332699641868754200148102057068573368552023575813055703267075163507596193072757082837143519030703862389167347112335"));
 
       Assert::AreEqual(expect.GetString(),ln2_string.GetString());
     }
@@ -149,7 +149,7 @@ namespace UnitTest
       bcd200 ln10 = bcd200::LN10();
       CString ln10_string = ln10.AsString();
     //CString expect(_T("2.302585092994045684017991454684364207601"));
-      CString expect(_T("2.3025850929940456840179914546843642076011014886287729760333279009675726096773524802359972050895982983419677840422862486334095254650828067566662873690987816894829072083255546808437998948262331985283296"));
+      CString expect(_T("2.3025850929940456840179914546843642076011014886287729760333279009675726096773524802359972050895982983419677840422862486334095254650828067566662873690987816894829072083255546808437998948262331985283935"));
 
       Assert::AreEqual(expect.GetString(),ln10_string.GetString());
     }
@@ -517,7 +517,7 @@ namespace UnitTest
       // 9988776655,4433221100
       bcd200 one(_T("9988776655.4433221100"));
     //bcd200 expect(_T("99943.86752294170705107883721621278845710"));
-      bcd200 expect(_T("99943.86752294170705107883721621278845728505305120198590594603923999248060213776260765359932728852982977071848960784809271784113274507829156812495717071028518663266128900612303561676739127744453257189"));
+      bcd200 expect(_T("99943.867522941707051078837216212788457285053051201985905946039239992480602137762607653599327288529829770718489607848092717841132745078291568124957170710285186632661289006123035616767391277444532571936"));
       bcd200 result = one.SquareRoot();
 
       Assert::IsTrue(expect == result);
@@ -532,7 +532,7 @@ namespace UnitTest
       bcd200 one(_T("9988776655.4433221112"));
       bcd200 two(_T("3.78123764321234"));
     //bcd200 expect(_T("6.46446118874655302175032245730334730318E+37"));
-      bcd200 expect(_T("6.4644611887465530217503224573033473303234042053435314439941010745685084786561330381754823529273589697907876993593141826387830776282819191401180394363137438806177372580960520931593965626406832940084236E+37"));
+      bcd200 expect(_T("6.4644611887465530217503224573033473303234042053435314439941010745685084786561330381754823529273589697907876993593141826387830776282819191401180394363137438806177372580960520931593965626406832940342412E+37"));
       bcd200 result = one.Power(two);
 
       CString res = result.AsString(bcd200::Format::Engineering);
@@ -572,7 +572,7 @@ namespace UnitTest
       // 9988776655,4433221112
       bcd200 one(_T("9988776655.4433221112"));
       //bcd  expect(_T("23.02472796519583305299405544350891551931"));
-      bcd200 expect(_T("23.024727965195833052994055443508915519429216547923180687310367668684725615310028492944404401361257718137186906609063750125558646654287262393879943563443517697796419354297694729255518132260276986244695"));
+      bcd200 expect(_T("23.024727965195833052994055443508915519429216547923180687310367668684725615310028492944404401361257718137186906609063750125558646654287262393879943563443517697796419354297694729255518132260276986245333"));
 
       bcd200 result = one.Log();
 
@@ -587,7 +587,7 @@ namespace UnitTest
       // 9988776655,4433221112
       bcd200 one(_T("9988776655.4433221112"));
       // bcd expect(_T("9.99951230260803799484589365115468478907"));
-      bcd200 expect(_T("9.999512302608037994845893651154684789121166905989501598174141144472767423906354314074496951958803529396043156171912666827014409480557345562913565514795075663174353450192308334896727819595726205596187"));
+      bcd200 expect(_T("9.9995123026080379948458936511546847891211669059895015981741411444727674239063543140744969519588035293960431561719126668270144094805573455629135655147950756631743534501923083348967278195957262055961841"));
 
       bcd200 result = one.Log10();
       Logger::WriteMessage(result.AsString());
@@ -601,7 +601,7 @@ namespace UnitTest
       // 99,887766554433221112
       bcd200 one(_T("99.887766554433221112"));
       // bcd expect(_T("2.402734720884442281355919192444100235161E+43"));
-      bcd200 expect(_T("2.4027347208844422813559191924441002416077897203416088129830456235044353722032501441219253950736896102538882111290049971443308227274811650975539954866320981084636448708948837592137072936627385738136364E+43"));
+      bcd200 expect(_T("2.4027347208844422813559191924441002416077897203416088129830456235044353722032501441219253950736896102538882111290049971443308227274811650975539954866320981084636448708948837592137072936627385738157023E+43"));
       bcd200 result = one.Exp();
 
       Assert::IsTrue(expect == result);
@@ -666,7 +666,7 @@ namespace UnitTest
       // 0,9876543210123456
       TCHAR* a_angle = _T("0.9876543210123456");
     //TCHAR* r_sine  = _T("8.347366295099261173476093153791068840984E-1");
-      TCHAR* r_sine  = _T("8.3473662950992611734760931537910688408756047599809111875042782561607386790905830568786053258757205938182671211681730536871695308929115141187292042958860261918458846154902597094065887748289278412163839E-1");
+      TCHAR* r_sine  = _T("8.347366295099261173476093153791068840875604759980911187504278256160738679090583056878605325875720593818267121168173053687169530892911514118729204295886026191845884615490259709406588774828927841216391E-1");
 
       bcd200 one(a_angle);
       bcd200 expect(r_sine);
@@ -682,7 +682,7 @@ namespace UnitTest
       // 0,9876543210123456
       TCHAR* a_angle  = _T("0.9876543210123456");
     //TCHAR* r_cosine = _T("5.506493978516714425340844117564672940338E-1");
-      TCHAR* r_cosine = _T("5.5064939785167144253408441175646729403095708912218139415761298064156160855725101375079953739003429964434530245713602015915525129754596525920855981453564775790553063894738103674745387910664599767280971E-1");
+      TCHAR* r_cosine = _T("5.5064939785167144253408441175646729403095708912218139415761298064156160855725101375079953739003429964434530245713602015915525129754596525920855981453564775790553063894738103674745387910664599767280974E-1");
 
       bcd200 one(a_angle);
       bcd200 expect(r_cosine);
@@ -698,7 +698,7 @@ namespace UnitTest
       // 0,9876543210123456
       TCHAR* a_angle   = _T("0.9876543210123456");
     //TCHAR* r_tangent = _T("1.515913088739596368439240774287234302490");
-      TCHAR* r_tangent = _T("1.5159130887395963684392407742872343024187341935250131109552651927915691134759545387515521530550442281041631058027325235923778527508079283345838860820997561343085430350650315585480172879059297371068217");
+      TCHAR* r_tangent = _T("1.515913088739596368439240774287234302418734193525013110955265192791569113475954538751552153055044228104163105802732523592377852750807928334583886082099756134308543035065031558548017287905929737106826");
 
       bcd200 one(a_angle);
       bcd200 expect(r_tangent);
@@ -713,7 +713,7 @@ namespace UnitTest
 
       TCHAR* a_ratio = _T("0.765498765404321098765");
     //TCHAR* r_asine = _T("8.71816131070559101024946021343034377293E-1");
-      TCHAR* r_asine = _T("8.718161310705591010249460213430343772780510727322269076221581768222516809299039138426179544948246419165205190870002969350813972110542472591961069061175868615003642554566993219186899399910388624925912E-1");
+      TCHAR* r_asine = _T("8.718161310705591010249460213430343772780510727322269076221581768222516809299039138426179544948246419165205190870002969350813972110542472591961069061175868615003642554566993219186899399910388624925878E-1");
 
       bcd200 one(a_ratio);
       bcd200 expect(r_asine);
@@ -729,7 +729,7 @@ namespace UnitTest
 
       TCHAR* a_ratio   = _T("0.765498765404321098765");
     //TCHAR* r_acosine = _T("6.98980195724337518206375670296717064805E-1");
-      TCHAR* r_acosine = _T("6.989801957243375182063756702967170648205336269553260028653141193316565222132005854713994581762338920745535241696408563884655250937210438566665727979466536972247777958942699386340898823204356149725997E-1");
+      TCHAR* r_acosine = _T("6.989801957243375182063756702967170648205336269553260028653141193316565222132005854713994581762338920745535241696408563884655250937210438566665727979466536972247777958942699386340898823204356149726031E-1");
 
       bcd200 one(a_ratio);
       bcd200 expect(r_acosine);
@@ -745,7 +745,7 @@ namespace UnitTest
 
       TCHAR* a_ratio    = _T("0.765498765404321098765");
     //TCHAR* r_atangent = _T("6.53346752384431270749403109172000942006E-1");
-      TCHAR* r_atangent = _T("6.533467523844312707494031091720009420203307289851202240112116001575224076704283499140086358397604074181618354914359155260497021554984833271295227833039700317016931210335901428034980693894010800950587E-1");
+      TCHAR* r_atangent = _T("6.533467523844312707494031091720009420203307289851202240112116001575224076704283499140086358397604074181618354914359155260497021554984833271295227833039700317016931210335901428034980693894010800950584E-1");
 
       bcd200 one(a_ratio);
       bcd200 expect(r_atangent);
@@ -892,7 +892,7 @@ namespace UnitTest
       bcd200 result = one.ArcTangent2Points(two);
       CString resstring = result.AsString();
     //TCHAR* expect = _T("4.065388783692102294632898803723974485214");
-      TCHAR* expect = _T("4.0653887836921022946328988037239744852614244406154928728422038138928689899362436394182360017777313271594818799035132762840973140168967467029056723865817696443609077737987223137735619386195371474136125");
+      TCHAR* expect = _T("0.9237961301023090561702554204444716010642550412403870518672592215850525836500346407902011764356142591773337933902309696370034694073461644711803129784532885269106236710967837926680022939965881924832303");
 
       Assert::IsTrue(strcmp(expect,resstring.GetString()) == 0);
     }
@@ -1379,7 +1379,7 @@ namespace UnitTest
       bcd200 nlog = value.Log();
 
     //CString expected = _T("-0.693147180559945309417232121458176568023");
-      CString expected = _T("-0.6931471805599453094172321214581765680755001343602552541206800094933936219696947156058633269964186875420014810205706857336855202357581305570326707516350759619307275708283714351903070386238916734711173");
+      CString expected = _T("-0.69314718055994530941723212145817656807550013436025525412068000949339362196969471560586332699641868754200148102057068573368552023575813055703267075163507596193072757082837143519030703862389167347112335");
       CString testval  = nlog.AsString(bcd200::Format::Bookkeeping, false, 30);
 
       Assert::AreEqual(expected.GetString(), testval.GetString());
@@ -1420,5 +1420,387 @@ namespace UnitTest
       bcd200 diff = log - internal;
       Assert::IsTrue(diff.IsNearZero());
     }
+
+    TEST_METHOD(T100_MultiplyAllNines)
+    {
+      Logger::WriteMessage("Testing BCD multiplication carries of all-nines mantissa");
+      CString nines(_T("0."));
+      for(int ind = 0; ind < 200; ++ind)
+      {
+        nines += _T("9");
+      }
+      bcd200 one(nines);
+      bcd200 result = one * one;
+
+      // 1 - 2E-200 + 1E-400. The last digit is lost in normalizing the product
+      CString expect = nines.Left(200) + _T("8");
+      Assert::AreEqual(expect.GetString(),result.AsString().GetString());
+    }
+
+    TEST_METHOD(T101_ShortAndLongMantissa)
+    {
+      Logger::WriteMessage("Testing BCD arithmetic of a short mantissa with a long one");
+      bcd200 shortOne(_T("1234.56"));
+      bcd200 longOne (_T("0.1234567890123456789012345678901234567891"));
+
+      Assert::AreEqual(_T("1234.6834567890123456789012345678901234567891"),(shortOne + longOne).AsString().GetString());
+      Assert::AreEqual(_T("1234.4365432109876543210987654321098765432109"),(shortOne - longOne).AsString().GetString());
+      Assert::AreEqual(_T("152.414813443081481344308148134430814813551296"),(shortOne * longOne).AsString().GetString());
+
+      // Carry out of the only significant limb
+      bcd200 one(_T("99999999.99"));
+      bcd200 two(_T("0.01"));
+      Assert::AreEqual(_T("100000000.00"),(one + two).AsString().GetString());
+    }
+
+    TEST_METHOD(T102_SmallIntegerOperators)
+    {
+      Logger::WriteMessage("Testing BCD multiplication, division and modulo by an int");
+      bcd200 one(_T("1234.5678"));
+
+      Assert::AreEqual(_T("152415776390.7942"),(one * 123456789).AsString().GetString());
+      Assert::AreEqual(_T("-45679.0086"),      (one * -37).AsString().GetString());
+      Assert::AreEqual(_T("176.36682857142857142857142857142857142857142857142857142857142857142857142857142857142857142857142857142857142857142857142857142857142857142857142857142857142857142857142857142857142857142857142857142"),(one / 7).AsString().GetString());
+      Assert::AreEqual(_T("-5.7489043128438779678400037660449760807887539643741929737730850343467132348319111554100695789838533750660034711780042718993519767650179456756533801907922049010136187546949920964869633766296149122666637E-7"),(one / -2147483647).AsString(bcd200::Format::Engineering).GetString());
+      Assert::AreEqual(_T("2.5678"), (one % 7).AsString().GetString());
+      Assert::AreEqual(_T("-2.5678"),((-one) % 7).AsString().GetString());
+
+      // An int can have more digits than one mantissa element
+      Assert::AreEqual(_T("-2147483647.00"),bcd200(-2147483647).AsString().GetString());
+    }
+
+    TEST_METHOD(T103_DivMod)
+    {
+      Logger::WriteMessage("Testing bcd200 quotient and remainder in one division");
+      bcd200 number(_T("1234.5678"));
+      bcd200 divisor(_T("-7.5"));
+      bcd200 quotient;
+      bcd200 remainder;
+
+      // Quotient is truncated, remainder has the sign of the number
+      number.DivMod(divisor,quotient,remainder);
+      Assert::AreEqual(_T("-164.00"),quotient.AsString().GetString());
+      Assert::AreEqual(_T("4.5678"), remainder.AsString().GetString());
+      (-number).DivMod(divisor,quotient,remainder);
+      Assert::AreEqual(_T("164.00"), quotient.AsString().GetString());
+      Assert::AreEqual(_T("-4.5678"),remainder.AsString().GetString());
+      Assert::AreEqual(_T("-3.00"),fmod(bcd200(-23),bcd200(5)).AsString().GetString());
+
+      // Remainder stays exact for a quotient with many digits
+      bcd200 big(_T("5239304169727748290263825497310000000000"));
+      Assert::AreEqual(_T("33023352.00"),(big % bcd200(123456789L)).AsString().GetString());
+      Assert::AreEqual(_T("4.00"),(bcd200(_T("1E1000")) % bcd200(7L)).AsString().GetString());
+    }
+
+    TEST_METHOD(T104_ToChars)
+    {
+      Logger::WriteMessage("Testing bcd200 formatting into a buffer");
+      char  buffer[100];
+      char* last = nullptr;
+
+      last = bcd200(_T("-1234.5678")).ToChars(buffer,buffer + 100);
+      *last = 0;
+      Assert::AreEqual("-1234.5678",buffer);
+      last = bcd200(_T("42")).ToChars(buffer,buffer + 100,bcd200::Format::Bookkeeping,3);
+      *last = 0;
+      Assert::AreEqual("42.000",buffer);
+      last = bcd200(_T("0.00012")).ToChars(buffer,buffer + 100);
+      *last = 0;
+      Assert::AreEqual("0.00012",buffer);
+      last = bcd200(_T("1.5E-300")).ToChars(buffer,buffer + 100);
+      *last = 0;
+      Assert::AreEqual("1.5E-300",buffer);
+
+      // Engineering format as in AsString
+      bcd200 number(_T("98765432109876543210.0123456789"));
+      last = number.ToChars(buffer,buffer + 100,bcd200::Format::Engineering);
+      *last = 0;
+      Assert::AreEqual("9.87654321098765432100123456789E19",buffer);
+
+      // Nothing is written beyond the buffer
+      Assert::IsNull(number.ToChars(buffer,buffer + 10));
+
+      // Rounding carries into the digits before it
+      number = bcd200(_T("9.996"));
+      number.Round(2);
+      Assert::AreEqual(_T("10.00"),number.AsString().GetString());
+    }
+
+    TEST_METHOD(T105_FromChars)
+    {
+      Logger::WriteMessage("Testing bcd200 parsing from a buffer");
+      const char* text = "-98765432109876543210.0123456789E-5;12";
+      bcd200 number;
+
+      // Parsing stops at the first character that is not part of the number
+      bcd_chars_result result = number.FromChars(text,text + strlen(text));
+      Assert::AreEqual(35,(int)(result.ptr - text));
+      Assert::AreEqual((unsigned)bcd_context::StatusNone,result.status);
+      Assert::AreEqual(_T("-987654321098765.432100123456789"),number.AsString().GetString());
+
+      text   = "0.000012345678901234abc";
+      result = number.FromChars(text,text + strlen(text));
+      Assert::AreEqual(20,(int)(result.ptr - text));
+      Assert::AreEqual(_T("1.2345678901234E-5"),number.AsString(bcd200::Format::Engineering).GetString());
+
+      // An 'E' without digits is not part of the number
+      text   = "42e+";
+      result = number.FromChars(text,text + strlen(text));
+      Assert::AreEqual(2,(int)(result.ptr - text));
+      Assert::AreEqual(_T("42.00"),number.AsString().GetString());
+
+      // No number: nothing is read and the value stays
+      text   = "-.E5";
+      result = number.FromChars(text,text + strlen(text));
+      Assert::IsTrue(result.ptr == text);
+      Assert::AreEqual((unsigned)bcd_context::StatusInvalid,result.status);
+      Assert::AreEqual(_T("42.00"),number.AsString().GetString());
+
+      text   = "1E40000";
+      result = number.FromChars(text,text + strlen(text));
+      Assert::AreEqual((unsigned)bcd_context::StatusOverflow,result.status);
+      Assert::AreEqual(_T("42.00"),number.AsString().GetString());
+
+      text   = "-INF";
+      result = number.FromChars(text,text + strlen(text));
+      Assert::AreEqual(_T("-INF"),number.AsString().GetString());
+    }
+
+    TEST_METHOD(T106_NumericAllDigits)
+    {
+      Logger::WriteMessage("Testing bcd200 to and from a SQL_NUMERIC_STRUCT with 38 digits");
+      const SQLCHAR value[SQL_MAX_NUMERIC_LEN] =
+      {
+        0x4E, 0xF3, 0x38, 0xDE, 0x50, 0x90, 0x49, 0xC4, 0x13, 0x33, 0x02, 0xF0, 0xF6, 0xB0, 0x49, 0x09
+      };
+      SQL_NUMERIC_STRUCT num;
+      memset(&num,0,sizeof(SQL_NUMERIC_STRUCT));
+
+      bcd200 number(_T("-1234567890123456789012345678.9012345678"));
+      number.AsNumeric(&num);
+      Assert::AreEqual(38,(int)num.precision);
+      Assert::AreEqual(10,(int)num.scale);
+      Assert::AreEqual(0, (int)num.sign);
+      Assert::AreEqual(0,memcmp(value,num.val,SQL_MAX_NUMERIC_LEN));
+
+      bcd200 result(&num);
+      Assert::IsTrue(number == result);
+    }
+
+    TEST_METHOD(T107_NumericArray)
+    {
+      Logger::WriteMessage("Testing bcd200 arrays to and from SQL_NUMERIC_STRUCT");
+      const size_t count = 20000;
+      bcd200* numbers = new bcd200[count];
+      bcd200* results = new bcd200[count];
+      SQL_NUMERIC_STRUCT* numerics = new SQL_NUMERIC_STRUCT[count];
+      for(size_t ind = 0; ind < count; ++ind)
+      {
+        numbers[ind] = bcd200((long)ind) / 8;
+      }
+
+      // Every value gets its own precision and scale
+      Assert::AreEqual((size_t)0,bcd200::AsNumericArray(numbers,numerics,count));
+      Assert::AreEqual(3,(int)numerics[3].scale);
+      Assert::AreEqual(1,(int)numerics[4].scale);
+      bcd200::FromNumericArray(numerics,results,count);
+      for(size_t ind = 0; ind < count; ++ind)
+      {
+        Assert::IsTrue(numbers[ind] == results[ind]);
+      }
+
+      // All values as a NUMERIC(6,2) column. Digits behind the scale are truncated
+      numbers[7] = bcd200(_T("-1234.5678"));
+      Assert::AreEqual((size_t)0,bcd200::AsNumericArray(numbers,numerics,count,6,2));
+      Assert::AreEqual(6,(int)numerics[3].precision);
+      Assert::AreEqual(2,(int)numerics[3].scale);
+      bcd200::FromNumericArray(numerics,results,count);
+      Assert::AreEqual(_T("0.37"),results[3].AsString().GetString());
+      Assert::AreEqual(_T("-1234.56"),results[7].AsString().GetString());
+
+      // Values that do not fit are counted (or throw once)
+      bcd200::ErrorThrows(false);
+      bcd_context::Current().ClearStatus();
+      Assert::AreEqual((size_t)(count - 8000 + 1),bcd200::AsNumericArray(numbers,numerics,count,5,2));
+      Assert::IsTrue(bcd_context::Current().TestStatus(bcd_context::StatusOverflow));
+      bcd200::ErrorThrows(true);
+
+      delete [] numbers;
+      delete [] results;
+      delete [] numerics;
+    }
+
+    TEST_METHOD(T108_ColumnOperations)
+    {
+      Logger::WriteMessage("Testing bcd200 column operations on arrays");
+      const size_t count = 1000;
+      bcd200* one    = new bcd200[count];
+      bcd200* two    = new bcd200[count];
+      bcd200* result = new bcd200[count];
+      for(size_t ind = 0; ind < count; ++ind)
+      {
+        one[ind] = bcd200((long)ind) / 4;
+        two[ind] = bcd200(_T("-2.5")) + bcd200((long)(ind % 7));
+      }
+
+      // Every element is the same as the scalar operator
+      bcd200::Add(one,two,result,count);
+      for(size_t ind = 0; ind < count; ++ind)
+      {
+        Assert::IsTrue(result[ind] == one[ind] + two[ind]);
+      }
+      bcd200::Sub(one,two,result,count,true);
+      for(size_t ind = 0; ind < count; ++ind)
+      {
+        Assert::IsTrue(result[ind] == one[ind] - two[ind]);
+      }
+      bcd200::Mul(one,two,result,count,true);
+      for(size_t ind = 0; ind < count; ++ind)
+      {
+        Assert::IsTrue(result[ind] == one[ind] * two[ind]);
+      }
+      Assert::AreEqual(_T("-0.25"),result[2].AsString().GetString());
+
+      // In place: the result is the first argument
+      bcd200::Scale(one,bcd200(_T("0.5")),one,count,true);
+      Assert::AreEqual(_T("1.5"),one[12].AsString(bcd200::Format::Bookkeeping,false,1).GetString());
+      bcd200::Sub(one,one,one,count);
+      for(size_t ind = 0; ind < count; ++ind)
+      {
+        Assert::IsTrue(one[ind].IsZero());
+      }
+
+      // A NULL element goes the way of the scalar operator, the others are calculated
+      bcd200::ErrorThrows(false);
+      two[3].SetNULL();
+      bcd200::Add(one,two,result,count);
+      Assert::IsFalse(result[3].IsValid());
+      Assert::IsTrue(result[4] == two[4]);
+      bcd200::ErrorThrows(true);
+
+      delete [] one;
+      delete [] two;
+      delete [] result;
+    }
+
+    TEST_METHOD(T109_Accumulator)
+    {
+      Logger::WriteMessage("Testing the exact accumulator of a bcd200 sum");
+      // Many numbers with almost 200 digits
+      bcd200 small(_T("1E-190"));
+      bcd200::Accumulator sum;
+      bcd200 operators;
+      for(int ind = 1; ind <= 100; ++ind)
+      {
+        bcd200 number = bcd200(ind) + small * bcd200(ind);
+        sum.Add(number);
+        operators += number;
+      }
+      Assert::IsTrue(sum.Result() == operators);
+      Assert::IsTrue(sum.Result() == bcd200(5050) + small * bcd200(5050));
+
+      // Cancellation leaves the smallest digits
+      bcd200::Accumulator cancel;
+      cancel.Add(bcd200::PI());
+      cancel.Add(bcd200(_T("1E-180")));
+      cancel.Sub(bcd200::PI());
+      Assert::IsTrue(cancel.Result() == bcd200(_T("1E-180")));
+    }
+
+    TEST_METHOD(T110_Reductions)
+    {
+      Logger::WriteMessage("Testing SUM, AVG, MIN and MAX of a bcd200 array on several threads");
+      const size_t count = 500;
+      bcd200* numbers = new bcd200[count];
+      bcd200  third   = bcd200(1) / bcd200(3);
+      for(size_t ind = 0; ind < count; ++ind)
+      {
+        numbers[ind] = third * bcd200((long)ind - 250);
+      }
+      bcd200 sum = bcd200::Sum(numbers,count,1);
+      for(unsigned threads = 2; threads <= 7; ++threads)
+      {
+        Assert::IsTrue(bcd200::Sum(numbers,count,threads) == sum);
+        Assert::IsTrue(bcd200::Average(numbers,count,threads) == sum / bcd200(500));
+      }
+      Assert::IsTrue(bcd200::Minimum(numbers,count,4) == numbers[0]);
+      Assert::IsTrue(bcd200::Maximum(numbers,count,4) == numbers[count - 1]);
+      delete [] numbers;
+    }
+
+    TEST_METHOD(T111_FusedMultiplyAdd)
+    {
+      Logger::WriteMessage("Testing FusedMultiplyAdd and DotProduct of bcd200");
+      // The digits of the full product that the multiplication truncates
+      bcd200 third = bcd200(1) / bcd200(3);
+      bcd200 tail  = bcd200::FusedMultiplyAdd(third,third,-(third * third));
+      Assert::IsFalse(tail.IsZero());
+      Assert::IsTrue(tail.GetExponent() < -200);
+
+      bcd200 numbers[3] = { third, bcd200::PI(), bcd200(_T("-2.5")) };
+      bcd200 factors[3] = { bcd200(3), bcd200(2), bcd200(_T("0.4")) };
+      bcd200 small  = bcd200::FusedMultiplyAdd(third,bcd200(3),bcd200(-1));
+      Assert::IsTrue(small == bcd200(_T("-1E-200")));
+      bcd200 dot = bcd200::DotProduct(numbers,factors,3);
+      Assert::IsTrue(dot == bcd200::FusedMultiplyAdd(bcd200::PI(),bcd200(2),small));
+    }
+
+    TEST_METHOD(T112_PowerInteger)
+    {
+      Logger::WriteMessage("Test power with a whole exponent: bcd200.Power()");
+      bcd200 expect(_T("265613988875874769338781322035779626829233452653394495974574961739092490901302182994384699044001"));
+      Assert::IsTrue(bcd200(3).Power(bcd200(200)) == expect);
+      Assert::IsTrue(bcd200(-3).Power(bcd200(-200)) == expect.Reciprocal());
+    }
+
+    TEST_METHOD(T113_ExpReduction)
+    {
+      Logger::WriteMessage("Test e-power over the whole range with: bcd200.Exp()");
+      bcd200 expect(_T("3.0787246988048834641772868393637863730093146333272145853256917919761294072150741387956453272540219976606154831378263729712146838065707735240857514670426212331604507660659985481926824452231460245685579E-435"));
+      bcd200 result = bcd200(_T("-1000.5")).Exp();
+      Assert::IsTrue((result / expect - bcd200(1)).AbsoluteValue() < bcd200(_T("1E-198")));
+      Assert::IsTrue(bcd200(_T("-80000")).Exp().IsZero());
+    }
+
+    TEST_METHOD(T114_LogReduction)
+    {
+      Logger::WriteMessage("Test natural logarithm over the whole range with: bcd200.Log()");
+      bcd200 expect(_T("-1.0000500033335833533350001428696439683539773457107551408986576271634475661140261702249598633746652875417889067228247175672579622108516462313261589533763624630010418454030532657958553284926717668097504E-4"));
+      bcd200 result = bcd200(_T("0.9999")).Log();
+      Assert::IsTrue((result / expect - bcd200(1)).AbsoluteValue() < bcd200(_T("1E-198")));
+      Assert::IsTrue(bcd200(2).Log() == bcd200::LN2());
+    }
+
+    TEST_METHOD(T115_SinCos)
+    {
+      Logger::WriteMessage("Test sine and cosine in one go with: bcd200.SinCos()");
+      bcd200 expect(_T("-3.4999350217129295211765248678077146906140660532871627385705905464464122639545050506566689766889400811273316905679106496957094176628063157624091537721326400854101704415373358406918843870326760701608275E-1"));
+      bcd200 sine,cosine;
+      bcd200(1000000).SinCos(sine,cosine);
+      Assert::IsTrue((sine / expect - bcd200(1)).AbsoluteValue() < bcd200(_T("1E-198")));
+      Assert::IsTrue(cosine == bcd200(1000000).Cosine());
+    }
+
+    TEST_METHOD(T116_SquareRootNewton)
+    {
+      Logger::WriteMessage("Test root with doubling precision: bcd200.SquareRoot()");
+      // Truncated as a division, also for an odd exponent and just below a power of ten
+      bcd200 root2(_T("1.4142135623730950488016887242096980785696718753769480731766797379907324784621070388503875343276415727350138462309122970249248360558507372126441214970999358314132226659275055927557999505011527820605714"));
+      bcd200 root1E301(_T("3.1622776601683793319988935444327185337195551393252168268575048527925944386392382213442481083793002951873472841528400551485488560304538800146905195967001539033449216571792599406591501534741133394841240E150"));
+      Assert::IsTrue(bcd200(2).SquareRoot()           == root2);
+      Assert::IsTrue(bcd200(_T("1E301")).SquareRoot() == root1E301);
+      bcd200 below = bcd200(1) - bcd200(_T("1E-200"));
+      Assert::IsTrue(below.SquareRoot() == below);
+
+      // Exact roots stay exact
+      bcd_context& context = bcd_context::Current();
+      context.ClearStatus();
+      Assert::IsTrue(bcd200(_T("1.44E-300")).SquareRoot() == bcd200(_T("1.2E-150")));
+      Assert::IsTrue(bcd200(_T("15241578780673678515622620750190521")).SquareRoot() == bcd200(_T("123456789123456789")));
+      Assert::IsFalse(context.TestStatus(bcd_context::StatusInexact));
+      bcd200(2).SquareRoot();
+      Assert::IsTrue(context.TestStatus(bcd_context::StatusInexact));
+      context.ClearStatus();
+    }
   };
 }
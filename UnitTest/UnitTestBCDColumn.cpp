@@ -0,0 +1,148 @@
+#include "stdafx.h"
+#include "CppUnitTest.h"
+#include "bcd_column.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace UnitTest
+{
+  TEST_CLASS(UnitTestBCDColumn)
+  {
+  public:
+
+    TEST_METHOD(T001_Conversion)
+    {
+      Logger::WriteMessage("Construct a bcd_column from an array of bcd and back");
+      bcd numbers[3] = { bcd(_T("1.5")), bcd(_T("-2.25E40")), bcd() };
+      numbers[2].SetNULL();
+
+      bcd_column column(numbers,3);
+      Assert::AreEqual((size_t)3,column.GetCount());
+      Assert::AreEqual(_T("-2.25E40"),column.GetValue(1).AsString().GetString());
+      Assert::IsTrue(column.GetValue(2).IsNULL());
+
+      column.SetValue(0,bcd(_T("42")));
+      column.Resize(11);
+      bcd result[11];
+      column.ToArray(result);
+      Assert::AreEqual(42L,result[0].AsLong());
+      Assert::IsTrue(result[1] == numbers[1]);
+      Assert::IsTrue(result[10].IsZero());
+    }
+
+    TEST_METHOD(T002_AddSub)
+    {
+      Logger::WriteMessage("Testing bcd_column addition and subtraction");
+      const size_t count = 1001;
+      bcd* one = new bcd[count];
+      bcd* two = new bcd[count];
+      for(size_t ind = 0; ind < count; ++ind)
+      {
+        one[ind] = bcd((long)ind) / 8;
+        two[ind] = bcd(_T("-2.75")) + bcd((long)(ind % 9)) * bcd(_T("1.1E5"));
+      }
+      bcd_column columnOne(one,count);
+      bcd_column columnTwo(two,count);
+      bcd_column result;
+
+      // Every number is the same as with the operators
+      bcd_column::Add(columnOne,columnTwo,result);
+      Assert::AreEqual(count,result.GetCount());
+      for(size_t ind = 0; ind < count; ++ind)
+      {
+        Assert::IsTrue(result.GetValue(ind) == one[ind] + two[ind]);
+      }
+      // A difference that must be normalized
+      Assert::AreEqual(_T("0.625"),result.GetValue(27).AsString().GetString());
+
+      bcd_column::Sub(columnOne,columnTwo,result);
+      for(size_t ind = 0; ind < count; ++ind)
+      {
+        Assert::IsTrue(result.GetValue(ind) == one[ind] - two[ind]);
+      }
+
+      // In place: subtracting a column from itself gives zero
+      bcd_column::Sub(columnOne,columnOne,columnOne);
+      for(size_t ind = 0; ind < count; ++ind)
+      {
+        Assert::IsTrue(columnOne.GetValue(ind).IsZero());
+      }
+      delete [] one;
+      delete [] two;
+    }
+
+    TEST_METHOD(T003_Scale)
+    {
+      Logger::WriteMessage("Testing bcd_column multiplication by a factor");
+      const size_t count = 100;
+      bcd numbers[count];
+      for(size_t ind = 0; ind < count; ++ind)
+      {
+        numbers[ind] = bcd((long)ind) / 3;
+      }
+      bcd_column column(numbers,count);
+      bcd_column result;
+
+      // A factor of one limb, and one of more limbs
+      bcd factors[2] = { bcd(_T("-1.21")), bcd(_T("1.234567890123")) };
+      for(int fac = 0; fac < 2; ++fac)
+      {
+        bcd_column::Scale(column,factors[fac],result);
+        for(size_t ind = 0; ind < count; ++ind)
+        {
+          Assert::IsTrue(result.GetValue(ind) == numbers[ind] * factors[fac]);
+        }
+      }
+      bcd_column::Scale(column,bcd(_T("0.5")),column);
+      Assert::AreEqual(_T("0.5"),column.GetValue(3).AsString().GetString());
+      Assert::IsTrue(column.GetValue(0).IsZero());
+    }
+
+    TEST_METHOD(T004_Compare)
+    {
+      Logger::WriteMessage("Testing bcd_column three way comparison");
+      bcd one[9] = { bcd(_T("1")), bcd(_T("-1")), bcd(), bcd(_T("0.001")), bcd(_T("-5E10")), bcd(_T("12.5")), bcd(_T("7")), bcd(_T("-0.5")), bcd(_T("3")) };
+      bcd two[9] = { bcd(_T("2")), bcd(_T("-2")), bcd(), bcd(),          bcd(_T("-5E9")),  bcd(_T("12.5")), bcd(_T("-7")),bcd(_T("0")),    bcd(_T("3.0000001")) };
+      int expect[9] = { -1, 1, 0, 1, -1, 0, 1, -1, -1 };
+
+      bcd_column columnOne(one,9);
+      bcd_column columnTwo(two,9);
+      int result[9];
+      bcd_column::Compare(columnOne,columnTwo,result);
+      for(int ind = 0; ind < 9; ++ind)
+      {
+        Assert::AreEqual(expect[ind],result[ind]);
+      }
+    }
+
+    TEST_METHOD(T005_NULLAndWidths)
+    {
+      Logger::WriteMessage("Testing bcd_column with a NULL number and other widths");
+      bcd200 one[10];
+      bcd200 two[10];
+      for(int ind = 0; ind < 10; ++ind)
+      {
+        one[ind] = bcd200(_T("1.5")) * bcd200((long)ind);
+        two[ind] = bcd200::PI();
+      }
+      one[4].SetNULL();
+
+      bcd200_column columnOne(one,10);
+      bcd200_column columnTwo(two,10);
+      bcd200_column result;
+      bcd200::ErrorThrows(false);
+      bcd200_column::Add(columnOne,columnTwo,result);
+      bcd200::ErrorThrows(true);
+
+      // The NULL goes the way of the operator, the others are calculated
+      Assert::IsFalse(result.GetValue(4).IsValid());
+      for(int ind = 0; ind < 10; ++ind)
+      {
+        if(ind != 4)
+        {
+          Assert::IsTrue(result.GetValue(ind) == one[ind] + two[ind]);
+        }
+      }
+    }
+  };
+}
@@ -1536,5 +1536,28 @@ namespace UnitTest
       icd diff = log - internal;
       Assert::IsTrue(diff.IsNearZero());
     }
+
+    TEST_METHOD(T100_Reductions)
+    {
+      Logger::WriteMessage("Testing SUM, AVG, MIN and MAX of an icd array on several threads");
+      const size_t count = 1000;
+      icd* numbers = new icd[count];
+      icd  total;
+      for(size_t ind = 0; ind < count; ++ind)
+      {
+        numbers[ind] = icd((long)ind) / icd(4L) - icd(100L);
+        total += numbers[ind];
+      }
+      icd sum = icd::Sum(numbers,count,1);
+      Assert::IsTrue(sum == total);
+      for(unsigned threads = 2; threads <= 8; ++threads)
+      {
+        Assert::IsTrue(icd::Sum(numbers,count,threads) == sum);
+        Assert::IsTrue(icd::Minimum(numbers,count,threads) == icd(-100L));
+        Assert::IsTrue(icd::Maximum(numbers,count,threads) == icd(_T("149.75")));
+      }
+      Assert::IsTrue(icd::Average(numbers,count) == icd(_T("24.875")));
+      delete [] numbers;
+    }
   };
 }
@@ -1541,5 +1541,22 @@ namespace UnitTest
       icd208 diff = log - internal;
       Assert::IsTrue(diff.IsNearZero());
     }
+
+    TEST_METHOD(T100_MultiplyAllNines)
+    {
+      Logger::WriteMessage("Testing ICD multiplication carries of all-nines data");
+      CString nines(_T("0."));
+      for(int ind = 0; ind < 104; ++ind)
+      {
+        nines += _T("9");
+      }
+      icd208 one(nines);
+      icd208 result = one * one;
+      result.SetLengthAndPrecision(208,104);
+
+      // 1 - 2E-104 + 1E-208 truncated to 104 decimals
+      CString expect = _T("+") + nines.Left(105) + _T("8");
+      Assert::AreEqual(expect.GetString(),result.AsString().GetString());
+    }
   };
 }
@@ -1,4765 +1,7516 @@
-/////////////////////////////////////////////////////////////////////////////////
-//
-// SourceFile: bcd.cpp
-//
-// Copyright (c) 2014-2025 ir. W.E. Huisman
-// All rights reserved
-//
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files(the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions :
-//
-// The above copyright notice and this permission notice shall be included in
-// all copies or substantial portions of the Software.
-//
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
-// THE SOFTWARE.
-//
-//////////////////////////////////////////////////////////////////////////
-//
-//  BCD
-// 
-//  Floating Point Precision Number class (Binary Coded Decimal)
-//  An Arbitrary float always has the format [sign][digit][.[digit]*][E[sign][digits]+] 
-//  where sign is either '+' or '-' or is missing ('+' implied)
-//  And is always stored in normalized mode after an operation or conversion
-//  with an implied decimal point between the first and second position
-//
-// Copyright (c) 2014-2022 ir W. E. Huisman
-// Version 1.5 of 03-01-2022
-//
-//  Examples:
-//  E+03 15456712 45000000 00000000 -> 1545.671245
-//  E+01 34125600 00000000 00000000 -> 3.41256
-//  E-05 78976543 12388770 00000000 -> 0.0000789765431238877
-//
-//////////////////////////////////////////////////////////////////////////
-
-#include "stdafx.h"         // Precompiled headers
-#include "bcd.h"            // OUR INTERFACE
-#include "StdException.h"   // Exceptions
-#include <math.h>           // Still needed for conversions of double
-#include <locale.h>
-#include <winnls.h>
-
-#ifdef _AFX
-#ifdef _DEBUG
-#define new DEBUG_NEW
-#undef THIS_FILE
-static char THIS_FILE[] = __FILE__;
-#endif
-#endif
-
-// Theoretical maximum of numerical separators
-#define SEP_LEN 10
-
-// string format number and money format functions
-bool  g_locale_valutaInit = false;
-TCHAR g_locale_decimalSep [SEP_LEN + 1];
-TCHAR g_locale_thousandSep[SEP_LEN + 1];
-TCHAR g_locale_strCurrency[SEP_LEN + 1];
-int   g_locale_decimalSepLen   = 0;
-int   g_locale_thousandSepLen  = 0;
-int   g_locale_strCurrencyLen  = 0;
-
-// Error handling throws or we silently return -INF, INF, NaN
-bool g_throwing = true;
-
-// One-time initialization for printing numbers in the current locale
-void 
-InitValutaString()
-{
-  if(g_locale_valutaInit == false)
-  {
-    GetLocaleInfo(LOCALE_USER_DEFAULT, LOCALE_SDECIMAL,  g_locale_decimalSep, SEP_LEN);
-    GetLocaleInfo(LOCALE_USER_DEFAULT, LOCALE_STHOUSAND, g_locale_thousandSep,SEP_LEN);
-    GetLocaleInfo(LOCALE_USER_DEFAULT, LOCALE_SCURRENCY, g_locale_strCurrency,SEP_LEN);
-    g_locale_decimalSepLen  = (int)_tclen(g_locale_decimalSep);
-    g_locale_thousandSepLen = (int)_tclen(g_locale_thousandSep);
-    g_locale_strCurrencyLen = (int)_tclen(g_locale_strCurrency);
-
-    g_locale_valutaInit = true;
-  }
-}
-
-//////////////////////////////////////////////////////////////////////////
-//
-// CONSTRUCTORS OF BCD
-//
-//////////////////////////////////////////////////////////////////////////
-
-// bcd::bcd
-// Description: Default constructor
-// Technical:   Initialize the number at zero (0)
-bcd::bcd()
-{
-  Zero();
-}
-
-// bcd::bcd(bcd& arg)
-// Description: Copy constructor of a bcd
-// Technical:   Copies all data members
-bcd::bcd(const bcd& p_arg)
-{
-  m_sign      = p_arg.m_sign;
-  m_exponent  = p_arg.m_exponent;
-  // Create and copy mantissa
-  memcpy(m_mantissa,p_arg.m_mantissa,bcdLength * sizeof(long));
-}
-
-// bcd::bcd(value)
-// Description: BCD from a char value
-bcd::bcd(const TCHAR p_value)
-{
-  SetValueInt((int)p_value);
-}
-
-#ifndef UNICODE
-// bcd::bcd(value)
-// Description: BCD from an unsigned char value
-bcd::bcd(const _TUCHAR p_value)
-{
-  SetValueInt((int)p_value);
-}
-#endif
-
-// bcd::bcd(value)
-// Description: BCD from a short value
-// 
-bcd::bcd(const short p_value)
-{
-  SetValueInt((int)p_value);
-}
-
-// bcd::bcd(value)
-// Description: BCD from an unsigned short value
-//
-bcd::bcd(const unsigned short p_value)
-{
-  SetValueInt((int)p_value);
-}
-
-// bcd::bcd(value)
-// BCD from an integer
-bcd::bcd(const int p_value)
-{
-  SetValueInt(p_value);
-}
-
-// bcd::bcd(value)
-// BCD from an unsigned integer
-bcd::bcd(const unsigned int p_value)
-{
-  SetValueInt64((int64)p_value,0);
-}
-
-// bcd::bcd(value,value)
-// Description: Construct a BCD from a long and an option long
-// Technical:   See description of SetValueLong
-//
-bcd::bcd(const long p_value, const long p_restValue /*= 0*/)
-{
-  SetValueLong(p_value,p_restValue);
-}
-
-// bcd::bcd(value,value)
-// Description: Construct a BCD from an unsigned long and an unsigned optional long
-// Technical:   See description of SetValueLong
-bcd::bcd(const unsigned long p_value, const unsigned long p_restValue /*= 0*/)
-{
-  SetValueInt64((int64)p_value,(int64)p_restValue);
-}
-
-// bcd::bcd(value,value)
-// Description: Construct a BCD from a 64bit long and an optional long
-// Technical:   See description of SetValueInt64
-//
-bcd::bcd(const int64 p_value,const int64 p_restvalue /*= 0*/)
-{
-  SetValueInt64(p_value,p_restvalue);
-}
-
-bcd::bcd(const uint64 p_value,const int64 p_restvalue)
-{
-  SetValueUInt64(p_value,p_restvalue);
-}
-
-// bcd::bcd(float)
-// Description: Construct a bcd from a float
-// 
-bcd::bcd(const float p_value)
-{
-  SetValueDouble((double)p_value);
-}
-
-// bcd::bcd(double)
-// Description: Construct a bcd from a double
-// 
-bcd::bcd(const double p_value)
-{
-  SetValueDouble(p_value);
-}
-
-// BCD From a character string
-// Description: Assignment-constructor from an elementary character data pointer
-// Parameters:  p_string -> Input character pointer (containing a number)
-//              p_fromDB -> Input comes from a  database (always American format)
-bcd::bcd(LPCTSTR p_string,bool p_fromDB /*= false*/)
-{
-  SetValueString(p_string,p_fromDB);
-}
-
-// bcd::bcd(numeric)
-// Description: Assignment-constructor for bcd from a SQL NUMERIC
-// Parameters:  p_numeric -> Input from a SQL ODBC database
-//                           from a NUMERIC field
-//
-bcd::bcd(const SQL_NUMERIC_STRUCT* p_numeric)
-{
-  SetValueNumeric(p_numeric);
-}
-
-// bcd::bcd(Sign)
-// Description: Construct a bcd from a NULL in the database
-// Parameters:  p_sign : BUT GETS IGNORED!!
-//
-bcd::bcd(const bcd::Sign /*p_sign*/)
-{
-  Zero();
-  // We ignore the argument!!
-  m_sign = Sign::ISNULL;
-}
-
-//////////////////////////////////////////////////////////////////////////
-//
-// END OF CONSTRUCTORS OF BCD
-//
-//////////////////////////////////////////////////////////////////////////
-
-//////////////////////////////////////////////////////////////////////////
-//
-// CONSTANTS OF BCD
-//
-//////////////////////////////////////////////////////////////////////////
-
-// bcd::PI
-// Description: Circumference/Radius ratio of a circle
-// Technical:   Nature constant that never changes
-bcd
-bcd::PI()
-{
-  bcd pi;
-
-  // PI in 120 decimals: 
-  // +31415926_53589793_23846264_33832795_02884197
-  //  16939937 51058209 74944592 30781640 62862089 
-  //  98628034 82534211 70679821 48086513 28230665
-  pi.m_mantissa[0] = 31415926L;
-  pi.m_mantissa[1] = 53589793L;
-  pi.m_mantissa[2] = 23846264L;
-  pi.m_mantissa[3] = 33832795L;
-  pi.m_mantissa[4] =  2884197L;
-
-  return pi;
-}
-
-// bcd::LN2
-// Description: Natural logarithm of two
-// Technical:  Mathematical constant that never changes
-bcd
-bcd::LN2()
-{
-  bcd ln2;
-
-  // LN2 in 120 decimals: Use if you expand bcdLength
-  // +0.69314718_05599453_09417232_12145817_65680755
-  //    00134360 25525412 06800094 93393621 96969471 
-  //    56058633 26996418 68754200 14810205 70685714
-  ln2.m_exponent = -1;
-  ln2.m_mantissa[0] = 69314718L;
-  ln2.m_mantissa[1] =  5599453L;
-  ln2.m_mantissa[2] =  9417232L;
-  ln2.m_mantissa[3] = 12145817L;
-  ln2.m_mantissa[4] = 65680755L;
-
-  return ln2;
-}
-
-// bcd::LN10
-// Description: Natural logarithm of ten
-// Technical:   Mathematical constant that never changes
-bcd
-bcd::LN10()
-{
-  bcd ln10;
-
-  // LN10 in 120 decimals: Use if you expand bcdLength
-  // +2.3025850_92994045_68401799_14546843_64207601
-  //   10148862 87729760 33327900 96757260 96773524 
-  //   80235997 20508959 82983419 67784042 28624865
-  ln10.m_mantissa[0] = 23025850L;
-  ln10.m_mantissa[1] = 92994045L;
-  ln10.m_mantissa[2] = 68401799L;
-  ln10.m_mantissa[3] = 14546843L;
-  ln10.m_mantissa[4] = 64207601L;
-
-  return ln10;
-}
-
- // Maximum number a bcd can hold
-bcd
-bcd::MIN_BCD()
-{
-  bcd min = MAX_BCD();
-  // Turn the sign around
-  min.m_sign = Sign::Negative;
-
-  return min;
-}
-
-// Minimum number a bcd can hold
-bcd
-bcd::MAX_BCD()
-{
-  bcd max;
-
-  max.m_sign        = Sign::Positive;
-  max.m_mantissa[0] = 99999999L;
-  max.m_mantissa[1] = 99999999L;
-  max.m_mantissa[2] = 99999999L;
-  max.m_mantissa[3] = 99999999L;
-  max.m_mantissa[4] = 99999999L;
-  max.m_exponent    = SHRT_MAX;
-
-  return max;
-}
-
-// Smallest number a bcd can hold
-bcd
-bcd::MIN_EPSILON()
-{
-  bcd eps;
-
-  eps.m_sign        = Sign::Positive;
-  eps.m_mantissa[0] = 1L;
-  eps.m_exponent    = SHRT_MIN;
-
-  return eps;
-}
-
-//////////////////////////////////////////////////////////////////////////
-//
-// END OF CONSTANTS OF BCD
-//
-//////////////////////////////////////////////////////////////////////////
-
-//////////////////////////////////////////////////////////////////////////
-//
-// ERROR HANDLING
-//
-//////////////////////////////////////////////////////////////////////////
-
-/*static */ void 
-bcd::ErrorThrows(bool p_throws /*= true*/)
-{
-  g_throwing = p_throws;
-}
-
-//////////////////////////////////////////////////////////////////////////
-//
-// OPERATORS OF BCD
-//
-//////////////////////////////////////////////////////////////////////////
-
-// bcd::+
-// Description: Addition operator
-//
-const bcd
-bcd::operator+(const bcd& p_value) const
-{
-  return Add(p_value);
-}
-
-const bcd
-bcd::operator+(const int p_value) const
-{
-  return Add(bcd(p_value));
-}
-
-const bcd
-bcd::operator+(const double p_value) const
-{
-  return Add(bcd(p_value));
-}
-
-const bcd
-bcd::operator+(LPCTSTR p_value) const
-{
-  return Add(bcd(p_value));
-}
-
-// bcd::-
-// Description: Subtraction operator
-const bcd
-bcd::operator-(const bcd& p_value) const
-{
-  return Sub(p_value);
-}
-
-const bcd
-bcd::operator-(const int p_value) const
-{
-  return Sub(bcd(p_value));
-}
-
-const bcd
-bcd::operator-(const double p_value) const
-{
-  return Sub(bcd(p_value));
-}
-
-const bcd
-bcd::operator-(LPCTSTR p_value) const
-{
-  return Sub(bcd(p_value));
-}
-
-// bcd::*
-// Description: Multiplication operator
-const bcd
-bcd::operator*(const bcd& p_value) const
-{
-  return Mul(p_value);
-}
-
-const bcd
-bcd::operator*(const int p_value) const
-{
-  return Mul(bcd(p_value));
-}
-
-const bcd
-bcd::operator*(const double p_value) const
-{
-  return Mul(bcd(p_value));
-}
-
-const bcd
-bcd::operator*(LPCTSTR p_value) const
-{
-  return Mul(bcd(p_value));
-}
-
-// bcd::/
-// Description: Division operator
-const bcd
-bcd::operator/(const bcd& p_value) const
-{
-  return Div(p_value);
-}
-
-const bcd
-bcd::operator/(const int p_value) const
-{
-  return Div(bcd(p_value));
-}
-
-const bcd
-bcd::operator/(const double p_value) const
-{
-  return Div(bcd(p_value));
-}
-
-const bcd
-bcd::operator/(LPCTSTR p_value) const
-{
-  return Div(bcd(p_value));
-}
-
-// bcd::%
-// Description: Modulo operator
-const bcd
-bcd::operator%(const bcd& p_value) const
-{
-  return Mod(p_value);
-}
-
-const bcd  
-bcd::operator%(const int p_value) const
-{
-  return Mod(bcd(p_value));
-}
-
-const bcd
-bcd::operator%(const double p_value) const
-{
-  return Mod(bcd(p_value));
-}
-
-const bcd
-bcd::operator%(LPCTSTR p_value) const
-{
-  return Mod(bcd(p_value));
-}
-
-// bcd::operator +=
-// Description: Operator to add a bcd to this one
-bcd&
-bcd::operator+=(const bcd& p_value)
-{
-  *this = Add(p_value);
-  return *this;
-}
-
-bcd&
-bcd::operator+=(const int p_value)
-{
-  *this = Add(bcd(p_value));
-  return *this;
-}
-
-bcd&
-bcd::operator+=(const double p_value)
-{
-  *this = Add(bcd(p_value));
-  return *this;
-}
-
-bcd&
-bcd::operator+=(LPCTSTR p_value)
-{
-  *this = Add(bcd(p_value));
-  return *this;
-}
-
-// bcd::operator -=
-// Description: Operator to subtract a bcd from this one
-bcd&
-bcd::operator-=(const bcd& p_value)
-{
-  *this = Sub(p_value);
-  return *this;
-}
-
-bcd& 
-bcd::operator-=(const int p_value)
-{
-  *this = Sub(bcd(p_value));
-  return *this;
-}
-
-bcd&
-bcd::operator-=(const double p_value)
-{
-  *this = Sub(bcd(p_value));
-  return *this;
-}
-
-bcd&
-bcd::operator-=(LPCTSTR p_value)
-{
-  *this = Sub(bcd(p_value));
-  return *this;
-}
-
-// bcd::operator *=
-// Description: Operator to multiply a bcd with this one
-bcd& 
-bcd::operator*=(const bcd& p_value)
-{
-  *this = Mul(p_value);
-  return *this;
-}
-
-bcd&
-bcd::operator*=(const int p_value)
-{
-  *this = Mul(bcd(p_value));
-  return *this;
-}
-
-bcd&
-bcd::operator*=(const double p_value)
-{
-  *this = Mul(bcd(p_value));
-  return *this;
-}
-
-bcd&
-bcd::operator*=(LPCTSTR p_value)
-{
-  *this = Mul(bcd(p_value));
-  return *this;
-}
-
-// bcd::operator /=
-// Description: Operator to divide a bcd with another
-bcd& 
-bcd::operator/=(const bcd& p_value)
-{
-  *this = Div(p_value);
-  return *this;
-}
-
-bcd&
-bcd::operator/=(const int p_value)
-{
-  *this = Div(bcd(p_value));
-  return *this;
-}
-
-bcd&
-bcd::operator/=(const double p_value)
-{
-  *this = Div(bcd(p_value));
-  return *this;
-}
-
-bcd&
-bcd::operator/=(LPCTSTR p_value)
-{
-  *this = Div(bcd(p_value));
-  return *this;
-}
-
-// bcd::operator %=
-// Description: Operator to do a modulo on this one
-bcd& 
-bcd::operator%=(const bcd& p_value)
-{
-  *this = Mod(p_value);
-  return *this;
-}
-
-bcd&
-bcd::operator%=(const int p_value)
-{
-  *this = Mod(bcd(p_value));
-  return *this;
-}
-
-bcd&
-bcd::operator%=(const double p_value)
-{
-  *this = Mod(bcd(p_value));
-  return *this;
-}
-
-bcd&
-bcd::operator%=(LPCTSTR p_value)
-{
-  *this = Mod(bcd(p_value));
-  return *this;
-}
-
-// bd::-
-// Description: prefix unary minus (negation)
-//
-bcd  
-bcd::operator-() const
-{
-  bcd result(*this);
-
-  // Null can never be negative
-  if(!result.IsZero() && result.IsValid() && !result.IsNULL())
-  {
-    // Swap signs
-    if(result.m_sign == Sign::Positive)
-    {
-      result.m_sign = Sign::Negative;
-    }
-    else
-    {
-      result.m_sign = Sign::Positive;
-    }
-  }
-  return result;
-}
-
-// bcd::postfix ++
-//
-bcd 
-bcd::operator++(int)
-{
-  // Return result first, than do the add 1
-  bcd res(*this);
-  ++*this;
-  return res;
-}
-
-// bcd::prefix++
-bcd& 
-bcd::operator++()
-{
-  //++x is equal to x+=1
-  bcd number_1(1);
-  *this += number_1;
-  return *this;
-}
-
-// bcd::Postfix decrement
-//
-bcd 
-bcd::operator--(int)
-{
-  // Return result first, than do the subtract
-  bcd res(*this);
-  --*this;
-  return res;
-}
-
-// bcd::Prefix  decrement
-bcd& 
-bcd::operator--()
-{
-  // --x is equal to x-=1
-  bcd number_1(1);
-  *this -= number_1;
-  return *this;
-}
-
-// bcd::=
-// Description: Assignment operator from another bcd
-bcd& 
-bcd::operator=(const bcd& p_value)
-{
-  if(this != &p_value)
-  {
-    m_sign      = p_value.m_sign;
-    m_exponent  = p_value.m_exponent;
-    memcpy(m_mantissa,p_value.m_mantissa,bcdLength * sizeof(long));
-  }
-  return *this;
-}
-
-// bcd::=
-// Description: Assignment operator from a long
-bcd& 
-bcd::operator=(const int p_value)
-{
-  SetValueLong(p_value,0);
-  return *this;
-}
-
-// bcd::=
-// Description: Assignment operator from a double
-bcd& 
-bcd::operator=(const double p_value)
-{
-  SetValueDouble(p_value);
-  return *this;
-}
-
-// bcd::=
-// Description: Assignment operator from a string
-bcd& 
-bcd::operator=(const PCTSTR p_value)
-{
-  SetValueString(p_value);
-  return *this;
-}
-
-// bcd::=
-// Description: Assignment operator from an __int64
-bcd&
-bcd::operator=(const __int64 p_value)
-{
-  SetValueInt64(p_value,0);
-  return *this;
-}
-
-// bcd::operator==
-// Description: Equality comparison of two bcd numbers
-//
-bool 
-bcd::operator==(const bcd& p_value) const
-{
-  // Shortcut: the same number is equal to itself
-  if(this == &p_value)
-  {
-    return true;
-  }
-  // Signs must be equal
-  if(m_sign != p_value.m_sign)
-  {
-    return false;
-  }
-  // Exponents must be equal
-  if(m_exponent != p_value.m_exponent)
-  {
-    return false;
-  }
-  // Mantissa's must be equal
-  for(int ind = 0;ind < bcdLength; ++ind)
-  {
-    if(m_mantissa[ind] != p_value.m_mantissa[ind])
-    {
-      return false;
-    }
-  }
-  // Everything is equal
-  return true;
-}
-
-bool
-bcd::operator==(const int p_value) const
-{
-  bcd value(p_value);
-  return *this == value;
-}
-
-bool
-bcd::operator==(const double p_value) const
-{
-  bcd value(p_value);
-  return *this == value;
-}
-
-bool
-bcd::operator==(LPCTSTR p_value) const
-{
-  bcd value(p_value);
-  return *this == value;
-}
-
-// bcd::operator!=
-// Description: Inequality comparison of two bcd numbers
-//
-bool 
-bcd::operator!=(const bcd& p_value) const
-{
-  // (x != y) is equal to !(x == y)
-  return !(*this == p_value);
-}
-
-bool
-bcd::operator!=(const int p_value) const
-{
-  bcd value(p_value);
-  return !(*this == value);
-}
-
-bool
-bcd::operator!=(const double p_value) const
-{
-  bcd value(p_value);
-  return !(*this == value);
-}
-
-bool
-bcd::operator!=(LPCTSTR p_value) const
-{
-  bcd value(p_value);
-  return !(*this == value);
-}
-
-bool
-bcd::operator<(const bcd& p_value) const
-{
-  // Check if we can do a comparison
-  // Infinity compares to nothing!!
-  if(!IsValid() || !p_value.IsValid() || IsNULL() || p_value.IsNULL())
-  {
-    return false;
-  }
-
-  // Shortcut: Negative numbers are smaller than positive ones
-  if(m_sign != p_value.m_sign)
-  {
-    // Signs are not equal 
-    // If this one is negative "smaller than" is true
-    // If this one is positive "smaller than" is false
-    return (m_sign == Sign::Negative);
-  }
-
-  // Issue #2 at github
-  // Zero is always smaller than everything else
-  if(IsZero() && !p_value.IsZero())
-  {
-    return (m_sign == Sign::Positive);
-  }
-
-  // Shortcut: If the exponent differ, the mantissa's don't matter
-  if(m_exponent != p_value.m_exponent)
-  {
-    if(m_exponent < p_value.m_exponent)
-    {
-      return (m_sign == Sign::Positive);
-    }
-    else
-    {
-      return (m_sign == Sign::Negative);
-    }
-  }
-
-  // Signs are the same and exponents are the same
-  // Now compare the mantissa
-  for(int ind = 0;ind < bcdLength; ++ind)
-  {
-    // Find the first position not equal to the other
-    if(m_mantissa[ind] != p_value.m_mantissa[ind])
-    {
-      // Result by comparing the mantissa positions
-      if(m_sign == Sign::Positive)
-      {
-        return (m_mantissa[ind] < p_value.m_mantissa[ind]);
-      }
-      else
-      {
-        return (m_mantissa[ind] > p_value.m_mantissa[ind]);
-      }
-    }
-  }
-  // Numbers are exactly the same
-  return false;
-}
-
-bool
-bcd::operator<(const int p_value) const
-{
-  bcd value(p_value);
-  return *this < value;
-}
-
-bool
-bcd::operator<(const double p_value) const
-{
-  bcd value(p_value);
-  return *this < value;
-}
-
-bool
-bcd::operator<(LPCTSTR p_value) const
-{
-  bcd value(p_value);
-  return *this < value;
-}
-
-bool
-bcd::operator>(const bcd& p_value) const
-{
-  // Check if we can do a comparison
-  // Infinity compares to nothing!!
-  if(!IsValid() || !p_value.IsValid() || IsNULL() || p_value.IsNULL())
-  {
-    return false;
-  }
-
-  // Shortcut: Negative numbers are smaller than positive ones
-  if(m_sign != p_value.m_sign)
-  {
-    // Signs are not equal. 
-    // If this one is positive "greater than" is true
-    // If this one is negative "greater than" is false
-    return (m_sign == Sign::Positive);
-  }
-  // Shortcut: if value is zero
-  if(IsZero())
-  {
-    return (p_value.m_sign == Sign::Negative);
-  }
-  // Shortcut: If the exponent differ, the mantissa's don't matter
-  if(m_exponent != p_value.m_exponent)
-  {
-    if(m_exponent > p_value.m_exponent || p_value.IsZero())
-    {
-      return (m_sign == Sign::Positive);
-    }
-    else
-    {
-      return (m_sign == Sign::Negative);
-    }
-  }
-  // Signs are the same and exponents are the same
-  // Now compare the mantissa
-  for(int ind = 0;ind < bcdLength; ++ind)
-  {
-    // Find the first position not equal to the other
-    if(m_mantissa[ind] != p_value.m_mantissa[ind])
-    {
-      // Result by comparing the mantissa positions
-      if(m_sign == Sign::Positive)
-      {
-        return (m_mantissa[ind] > p_value.m_mantissa[ind]);
-      }
-      else
-      {
-        return (m_mantissa[ind] < p_value.m_mantissa[ind]);
-      }
-    }
-  }
-  // Numbers are exactly the same
-  return false;
-}
-
-bool
-bcd::operator>(const int p_value) const
-{
-  bcd value(p_value);
-  return *this > value;
-}
-
-bool
-bcd::operator>(const double p_value) const
-{
-  bcd value(p_value);
-  return *this > value;
-}
-
-bool
-bcd::operator>(LPCTSTR p_value) const
-{
-  bcd value(p_value);
-  return *this > value;
-}
-
-bool
-bcd::operator<=(const bcd& p_value) const
-{
-  // (x <= y) equals !(x > y)
-  return !(*this > p_value);
-}
-
-bool
-bcd::operator<=(const int p_value) const
-{
-  bcd value(p_value);
-  return !(*this > value);
-}
-
-bool
-bcd::operator<=(const double p_value) const
-{
-  bcd value(p_value);
-  return !(*this > value);
-}
-
-bool
-bcd::operator<=(LPCTSTR p_value) const
-{
-  bcd value(p_value);
-  return !(*this > value);
-}
-
-bool
-bcd::operator>=(const bcd& p_value) const
-{
-  // (x >= y) equals !(x < y)
-  return !(*this < p_value);
-}
-
-bool
-bcd::operator>=(const int p_value) const
-{
-  bcd value(p_value);
-  return !(*this < value);
-}
-
-bool
-bcd::operator>=(const double p_value) const
-{
-  bcd value(p_value);
-  return !(*this < value);
-}
-
-bool
-bcd::operator>=(LPCTSTR p_value) const
-{
-  bcd value(p_value);
-  return !(*this < value);
-}
-
-//////////////////////////////////////////////////////////////////////////
-//
-// END OF OPERATORS OF BCD
-//
-//////////////////////////////////////////////////////////////////////////
-
-//////////////////////////////////////////////////////////////////////////
-//
-// MAKING AN EXACT NUMERIC
-//
-//////////////////////////////////////////////////////////////////////////
-
-// bcd::Zero
-// Description: Make empty
-// Technical:   Set the mantissa/exponent/sign to the number zero (0)
-
-void
-bcd::Zero()
-{
-  m_sign = Sign::Positive;
-  m_exponent = 0;
-  memset(m_mantissa,0,bcdLength * sizeof(long));
-}
-
-// Set to database NULL
-void
-bcd::SetNULL()
-{
-  Zero();
-  m_sign = Sign::ISNULL;
-}
-
-// Round to a specified fraction (decimals behind the .)
-void     
-bcd::Round(int p_precision /*=0*/)
-{
-  // Check if we can do a round
-  if(!IsValid() || IsNULL())
-  {
-    return;
-  }
-
-  // Precision is dependent on the exponent
-  int precision = p_precision + m_exponent;
-
-  // Quick optimization
-  if(precision < 0)
-  {
-    Zero();
-    return;
-  }
-  if(precision > bcdPrecision)
-  {
-    // Nothing to be done
-    return;
-  }
-
-  // Walk the mantissa
-  int mant = precision / bcdDigits;
-  int pos  = precision % bcdDigits;
-
-  int mm = m_mantissa[mant];
-
-  if(pos == (bcdDigits - 1))
-  {
-    // Last position in the mantissa part
-    if(mant == (bcdLength - 1))
-    {
-      // Nothing to do. No rounding possible
-      return;
-    }
-    else
-    {
-      int mn = m_mantissa[mant + 1];
-      int digitNext  = mn / (bcdBase / 10);
-
-      if(digitNext >= 5)
-      {
-        // The rounding in optimized form
-        m_mantissa[mant] = ++mm;
-      }
-    }
-  }
-  else
-  {
-    // In-between Optimalization
-    int base = bcdBase;
-    // Calculate base
-    for(int p2 = 0;p2 <= pos; ++p2)
-    {
-      base /= 10;
-    }
-    // Rounding this digit
-    int mantBefore = mm / base;
-    // Next rounding digit
-    int digitNext = mm % base;
-    digitNext /= (base / 10);
-
-    // Rounding
-    if(digitNext >= 5)
-    {
-      // Calculate new mantissa
-      ++mantBefore;
-      int newMant = mantBefore * base;
-      if(pos >= 0)
-      {
-        m_mantissa[mant] = newMant;
-      }
-    }
-    // Strip everything in the mantissa behind the position
-    m_mantissa[mant] /= base;
-    m_mantissa[mant] *= base;
-  }
-
-  // Strip the higher mantissa's
-  for(int m1 = mant + 1;m1 < bcdLength; ++m1)
-  {
-    m_mantissa[m1] = 0;
-  }
-  Normalize();
-}
-
-// Truncate to a specified fraction (decimals behind the .)
-void
-bcd::Truncate(int p_precision /*=0*/)
-{
-  // Check if we can do a truncate
-  if(!IsValid() || IsNULL())
-  {
-    return;
-  }
-
-  // Precision is dependent on the exponent
-  int precision = p_precision + m_exponent;
-
-  // Quick optimization
-  if(precision <= 0)
-  {
-    // Number totally truncated
-    Zero();
-    return;
-  }
-  if(precision > bcdPrecision)
-  {
-    // Nothing to truncate
-    return;
-  }
-
-  // Walk the mantissa
-  int mant = precision / bcdDigits;
-  int pos  = precision % bcdDigits;
-
-  // Strip everything in the mantissa behind the position
-  if(pos < (bcdDigits - 1))
-  {
-    // Calculate base
-    int base = bcdBase;
-    for(int p2 = 0;p2 <= pos; ++p2)
-    {
-      base /= 10;
-    }
-
-    m_mantissa[mant] /= base;
-    m_mantissa[mant] *= base;
-  }
-
-  // Strip the higher mantissa's
-  if(mant < (bcdLength - 1))
-  {
-    for(int m1 = mant + 1;m1 < bcdLength; ++m1)
-    {
-      m_mantissa[m1] = 0;
-    }
-  }
-}
-
-// Change the sign
-void
-bcd::Negate()
-{
-  // Check if we can do a negation
-  if(!IsValid() || IsNULL())
-  {
-    return;
-  }
-
-  if(IsZero())
-  {
-    m_sign = Sign::Positive;
-  }
-  else
-  {
-    m_sign = (m_sign == Sign::Positive) ? Sign::Negative : Sign::Positive;
-  }
-}
-
-// Change length and precision
-void
-bcd::SetLengthAndPrecision(int p_precision /*= bcdPrecision*/,int p_scale /*= (bcdPrecision / 2)*/)
-{
-  // Check if we can set these
-  if(!IsValid() || IsNULL())
-  {
-    return;
-  }
-
-  if(IsZero())
-  {
-    // Optimize for NULL situation
-    return;
-  }
-
-  if(m_exponent > p_precision)
-  {
-    XString error;
-    error.Format(_T("Overflow in BCD at set precision and scale as NUMERIC(%d,%d)"),p_precision,p_scale);
-    *this = SetInfinity(error);
-    return;
-  }
-
-  // Calculate the mantissa position to truncate
-  int mantpos = m_exponent + p_scale + 1;
-
-  // Truncating to zero?
-  if(mantpos <= 0)
-  {
-    m_exponent = 0;
-    memset(m_mantissa,0,sizeof(long) * bcdLength);
-    return;
-  }
-  int mant = mantpos / bcdDigits;
-  int mpos = mantpos % bcdDigits;
-
-  // Strip this on mantissa part
-  if(mpos)
-  {
-    static const int significations[] = {1,10000000,1000000,100000,10000,1000,100,10,1};
-    int  significant = significations[mpos];
-    int64       accu = m_mantissa[mant] / significant;
-    m_mantissa[mant] = (long) (accu * significant);
-  }
-  // Strip the rest of the mantissa
-  for(int index = mant + 1;index < bcdLength; ++index)
-  {
-    m_mantissa[index] = 0;
-  }
-}
-
-//////////////////////////////////////////////////////////////////////////
-//
-// END OF MAKING AN EXACT NUMERIC
-//
-//////////////////////////////////////////////////////////////////////////
-
-//////////////////////////////////////////////////////////////////////////
-//
-// MATHEMATICAL FUNCTIONS FOR BCD
-//
-//////////////////////////////////////////////////////////////////////////
-
-// bcd::Floor
-// Value before the decimal point
-bcd
-bcd::Floor() const
-{
-  bcd result;
-  bcd minusOne(-1L);
-
-  // Check if we can do a floor
-  if(IsNULL())
-  {
-    return bcd(Sign::ISNULL);
-  }
-  if(!IsValid())
-  {
-    return SetInfinity(_T("BCD: Infinity doesn't have a floor"));
-  }
-
-  // Shortcut: If number is null. Floor is always zero
-  if(IsZero())
-  {
-    return result;
-  }
-  // Shortcut: if number is a fraction: floor is always zero
-  if(m_exponent < 0)
-  {
-    return m_sign == Sign::Positive ? result : minusOne;
-  }
-  // Shortcut: If number is too big, it's just this number
-  if(m_exponent > bcdDigits * bcdLength)
-  {
-    return *this;
-  }
-  // Find the floor
-  result = SplitMantissa();
-
-  // Take care of sign
-  if(m_sign == Sign::Negative)
-  {
-    // Floor is 1 smaller
-    result -= bcd(1L);
-  }
-  return result;
-}
-
-// bcd::Fraction
-// Description: Value behind the decimal point
-bcd     
-bcd::Fraction() const
-{
-  return (*this) - Floor();
-}
-
-// Value after the decimal point
-bcd     
-bcd::Ceiling() const
-{
-  bcd result;
-  bcd one(1);
-
-  // Check if we can do a ceiling
-  if(IsNULL())
-  {
-    return bcd(Sign::ISNULL);
-  }
-  if(!IsValid())
-  {
-    return SetInfinity(_T("BCD: Infinity does not have a ceiling."));
-  }
-
-  // Shortcut: If number is null. Ceiling is always zero
-  if(IsZero())
-  {
-    return result;
-  }
-  // Shortcut: if number is a fraction: ceiling is one or zero
-  if(m_exponent < 0)
-  {
-    return m_sign == Sign::Positive ? one : result;
-  }
-  // Shortcut: If number is too big, it's just this number
-  if(m_exponent > bcdDigits * bcdLength)
-  {
-    return *this;
-  }
-  // Find the floor
-  result = SplitMantissa();
-
-  // Take care of sign
-  if(m_sign == Sign::Positive)
-  {
-    // Floor is 1 smaller
-    result += one;
-  }
-  return result;
-}
-
-#ifndef ALT_SQUAREROOT
-
-// bcd::SquareRoot
-// Description: Do the square root of the bcd
-// Technical:   Do first approximation by sqrt(double)
-//              Then use Newton's equation
-
-
-bcd
-bcd::SquareRoot() const
-{
-  bcd number;
-  bcd half(_T("0.5"));
-  bcd two(2);
-  bcd three(3);
-
-  // Check if we can do this
-  if(IsNULL())
-  {
-    return bcd(Sign::ISNULL);
-  }
-  if(!IsValid())
-  {
-    return SetInfinity(_T("BCD: Infinity does not have a square root!"));
-  }
-
-  // Optimalization sqrt(0) = 0
-  if(IsZero())
-  {
-    return number;
-  }
-  // Tolerance criterion epsilon
-  bcd epsilon = Epsilon(10);
-
-  number = *this; // Number to get the root from
-  if(number.GetSign() == -1)
-  {
-    return SetInfinity(_T("BCD: Cannot get a square root from a negative number."));
-  }
-  // Reduction by dividing through square of a whole number
-  // for speed a power of two
-  bcd reduction(1L);
-  bcd hunderd(100L);
-  while(number / (reduction * reduction) > hunderd)
-  {
-    reduction *= two;
-  }
-  // Reduce by dividing by the square of the reduction
-  // (reduction is really sqrt(reduction)
-  number /= (reduction * reduction);
-
-  // First quick guess
-  double approximation1 = number.AsDouble();
-  double approximation2 = 1 / ::sqrt(approximation1);
-  bcd    result(approximation2);
-  bcd    between;
-
-  // Newton's iteration
-  // U(n) = U(3-VU^2)/2
-  while(true)
-  {
-    between  = number * result * result;  // VU^2
-    between  = three - between;           // 3-VU^2
-    between *= half;                      // (3-VU^2)/2
-
-    if(between.Fraction() < epsilon)
-    {
-      break;
-    }
-    result *= between;
-  }
-  // End result from number * 1/sqrt
-  result *= number;
-  // Reapply reduction by multiplying to the result
-  result *= reduction;
-
-  return result;
-}
-
-#else
-
-// Description: Square root of the number
-// What it does: Does an estimation through a double and then
-// Uses the Newton estimation to calculate the root
-bcd
-bcd::SquareRoot() const
-{
-  bcd number(0L, 0L);
-  bcd half(_T("0.5"));
-  bcd two(2L);
-  bcd three(3L);
-  int sqrti = 0;
-
-  // Optimization: sqrt(0) = 0
-  if (IsNULL())
-  {
-    return number;
-  }
-
-  // Getting the breaking criterion
-  bcd epsilon = Epsilon(10);
-
-  number = *this; // Number to get the square-root from
-  if (number.GetSign() == -1)
-  {
-    return SetInfinity(_T("BCD: Infinity does not have a square root!"));
-  }
-  // First estimate
-  double estimate1 = number.AsDouble() / 2;
-  double estimate2 = 1 / sqrt(estimate1);
-  bcd result(estimate1);
-  bcd between;
-
-  // Newton's iteration
-  bcd last_result(_T("0.0"));
-
-  while (true)
-  {
-    result = (result + number / result) / two;
-    between = last_result - result;
-    if (between.AbsoluteValue() < epsilon)
-    {
-      break;
-    }
-
-    last_result = result;
-  }
-  return result;
-}
-#endif
-
-// bcd::Power
-// Description: Get BCD number to a power
-// Technical:   x^y = exp(y * ln(x))
-bcd
-bcd::Power(const bcd& p_power) const
-{
-  bcd result;
-
-  // Check if we can do this
-  if(IsNULL())
-  {
-    return bcd(Sign::ISNULL);
-  }
-  if(!IsValid())
-  {
-    return SetInfinity(_T("BCD: Can not take a power of infinity!"));
-  }
-
-  result = this->Log() * p_power;
-  result = result.Exp();
-
-  return result;
-}
-
-// bcd::AbsoluteValue
-// Description: Return the absolute value
-bcd
-bcd::AbsoluteValue() const
-{
-  // Check if we can do this
-  if(IsNULL())
-  {
-    return bcd(Sign::ISNULL);
-  }
-  if(!IsValid())
-  {
-    return SetInfinity(_T("BCD: Can change the sign of infinity!"));
-  }
-  bcd result(*this);
-  result.m_sign = Sign::Positive;
-  return result;
-}
-
-// bcd::Reciprocal
-// Description: Reciprocal / Inverse = 1/x
-bcd     
-bcd::Reciprocal() const
-{
-  // Check if we can do this
-  if(IsNULL())
-  {
-    return bcd(Sign::ISNULL);
-  }
-  if(!IsValid())
-  {
-    return SetInfinity(_T("BCD: Can do the reciprocal of infinity!"));
-  }
-  bcd result = bcd(1) / *this;
-  return result;
-}
-
-// bcd::Log
-// Description: Natural logarithm
-// Technical:   Use a Taylor series until their is no more change in the result
-//              Equivalent with the same standard C function call
-//              ln(x) == 2( z + z^3/3 + z^5/5 ...
-//              z = (x-1)/(x+1)
-bcd     
-bcd::Log() const
-{
-  long k;
-  long expo = 0;
-  bcd res, number, z2;
-  bcd number10(10L);
-  bcd fast(_T("1.2"));
-  bcd one(1L);
-  bcd epsilon = Epsilon(5);
-
-  // Check if we can do this
-  if(IsNULL())
-  {
-    return bcd(Sign::ISNULL);
-  }
-  if((GetSign() == -1) || !IsValid())
-  { 
-    return SetInfinity(_T("BCD: Cannot calculate a natural logarithm of a number <= 0"));
-  }
-  // Bring number under 10 and save exponent
-  number = *this;
-  while(number > number10)
-  {
-    number /= number10;
-    ++expo;
-  }
-  // In order to get a fast Taylor series result we need to get the fraction closer to one
-  // The fraction part is [1.xxx-9.999] (base 10) OR [1.xxx-255.xxx] (base 256) at this point
-  // Repeat a series of square root until 'number' < 1.2
-  for(k = 0; number > fast; k++)
-  {
-    number = number.SquareRoot();
-  }
-  // Calculate the fraction part now at [1.xxx-1.1999]
-  number = (number - one) / (number + one);
-  z2     = number * number;
-  res    = number;
-  // Iterate using Taylor series ln(x) == 2( z + z^3/3 + z^5/5 ... )
-  bcd between;
-  for(long stap = 3; ;stap += 2)
-  {
-    number *= z2;
-    between = number / bcd(stap);
-    // Tolerance criterion
-    if(between.AbsoluteValue() < epsilon)
-    {
-      break;
-    }
-    res += between;
-  }
-  // Re-add powers of two (comes from  " < 1.2")
-  res *= bcd(::pow(2.0,(double)++k));
-
-  // Re-apply the exponent
-  if(expo != 0)
-  {
-    // Ln(x^y) = Ln(x) + Ln(10^y) = Ln(x) + y * ln(10)
-    res += bcd(expo) * bcd::LN10();
-  }
-  return res;
-}
-
-// bcd::exp
-// Description: Exponent e tot the power 'this number'
-// Technical:   Use a Taylor series until their is no more change in the result
-//              exp(x) == 1 + x + x^2/2!+x^3/3!+....
-//              Equivalent with the same standard C function call
-//
-bcd
-bcd::Exp() const
-{
-  long step, k = 0;
-  bcd between, result, number;
-  bcd half(_T("0.5"));
-  bcd epsilon = Epsilon(5);
-
-  // Check if we can do this
-  if(IsNULL())
-  {
-    return bcd(Sign::ISNULL);
-  }
-  if(!IsValid())
-  {
-    return SetInfinity(_T("BCD: Cannot take the exponent of infinity!"));
-  }
-  number = *this;
-
-  // Can not calculate: will always be one!
-  if(number.IsZero())
-  {
-    return bcd(1);
-  }
-
-  if(number.GetSign () < 0 )
-  {
-    number = -number;;
-  }
-  for( k = 0; number > half; )
-  {
-    long expo = number.GetExponent();
-    if( expo > 0 )
-    {
-      step   = 3 * min( 10, expo );  // 2^3
-      result = bcd((long) (1 << step) );
-      result = result.Reciprocal();
-      k += step;
-    }
-    else
-    {
-      result = half;
-      k++;
-    }
-
-    number *= result;
-  }
-
-  // Do first two iterations
-  result  = bcd(1L) + number;
-  between  = number * number * half;
-  result += between;
-  // Now iterate 
-  for(step = 3; ;step++)
-  {
-    between *= number / bcd(step);
-    // Tolerance criterion
-    if(between < epsilon)
-    {
-      break;
-    }
-    result += between;
-  }
-  // Re-add powers of myself
-  for( ; k > 0; k-- )
-  {
-    result *= result;
-  }
-  // Take care of the sign
-  if(this->GetSign() < 0 )
-  {
-    result = bcd(1) / result;
-  }
-  return result;
-}
-
-// bcd::Log10
-// Description: Logarithm in base 10
-// Technical:   log10 = ln(x) / ln(10);
-bcd     
-bcd::Log10() const
-{
-  bcd res;
-
-  // Check if we can do a LOG10
-  if(IsNULL())
-  {
-    return bcd(Sign::ISNULL);
-  }
-  if(!IsValid())
-  {
-    return SetInfinity(_T("BCD: Cannot take the Log10 of infinity!"));
-  }
-  if(GetSign() <= 0) 
-  { 
-    return SetInfinity(_T("BCD: Cannot get a 10-logarithm of a number <= 0"));
-  }
-  res = *this;
-  res = res.Log() / LN10();
-
-  return res;
-}
-
-// Ten Power
-// Description: bcd . 10^n
-// Technical:   add n to the exponent of the number
-bcd
-bcd::TenPower(int n)
-{
-  // Check if we can do this
-  if(IsNULL())
-  {
-    return bcd(Sign::ISNULL);
-  }
-  if(!IsValid())
-  {
-    return SetInfinity(_T("BCD: Cannot take the 10th power of infinity!"));
-  }
-  bcd res = *this;
-  res.m_exponent += (short)n;
-  res.Normalize();
-  
-  return res;
-}
-
-//////////////////////////////////////////////////////////////////////////
-//
-// END OF MATHEMATICAL FUNCTIONS FOR BCD
-//
-//////////////////////////////////////////////////////////////////////////
-
-//////////////////////////////////////////////////////////////////////////
-//
-// BCD TRIGONOMETRIC FUNCTIONS
-//
-//////////////////////////////////////////////////////////////////////////
-
-// bcd::Sine
-// Description: Sine of the angle
-// Technical:   Use the Taylor series: Sin(x) = x - x^3/3! + x^5/5! ...
-//              1) Reduce x to between 0..2*PI 
-//              2) Reduce further until x between 0..PI by means of sin(x+PI) = -Sin(x)
-//              3) Then do the Taylor expansion series
-// Reduction is needed to speed up the Taylor expansion and reduce rounding errors
-//
-bcd
-bcd::Sine() const
-{
-  int sign;
-  bcd number;
-  bcd pi,pi2;
-  bcd between;
-  bcd epsilon = Epsilon(3);
-
-  // Check if we can do this
-  if(IsNULL())
-  {
-    return bcd(Sign::ISNULL);
-  }
-  if(!IsValid())
-  {
-    return SetInfinity(_T("BCD: Cannot take the sine of infinity!"));
-  }
-
-  number = *this;
-  sign = number.GetSign();
-  if( sign < 0 )
-  {
-    number = -number;
-  }
-  // Reduce the argument until it is between 0..2PI 
-  pi2 = PI() * bcd(2);
-  if(number > pi2)
-  {
-    between = number / pi2; 
-    between = between.Floor();
-    number -= between * pi2;
-  }
-  if(number < bcd(0))
-  {
-    number += pi2;
-  }
-  // Reduce further until it is between 0..PI
-  pi = PI();
-  if(number > pi)
-  { 
-    number -= pi; 
-    sign *= -1; 
-  }
-
-  // Now iterate with Taylor expansion
-  // Sin(x) = x - x^3/3! + x^5/5! ...
-  bcd square = number * number;
-  bcd result = number;
-  between    = number;
-
-  for(long step = 3; ;step += 2)
-  {
-    between *= square;
-    between /= bcd(step) * bcd(step - 1);
-    between  = -between; // Switch sign each step
-
-//     // DEBUGGING
-//     printf("Step: %d\n",step);
-//     result.DebugPrint("Result");
-//     between.DebugPrint("Between");
-
-    result  += between;
-
-//     // DEBUGGING
-//     result.DebugPrint("Between+");
-
-//     // DEBUGGING
-//     printf("%02d = %40s = %40s\n",step,between.AsString(),result.AsString());
-
-    // Check tolerance criterion
-    if(between.AbsoluteValue() < epsilon)
-    {
-      break;
-    }
-  }
-  // Reapply the right sign
-  if(sign < 0)
-  {
-    result = -result;
-  }
-  return result;
-}
-
-// bcd::Cosine
-// Description: Cosine of the angle
-// Technical:   Use the Taylor series. Cos(x) = 1 - x^2/2! + x^4/4! - x^6/6! ...
-//              1) However first reduce x to between 0..2*PI
-//              2) Then reduced it further to between 0..PI using cos(x)=Cos(2PI-x) for x >= PI
-//              3) Now use the trisection identity cos(3x)=-3*cos(x)+4*cos(x)^3
-//                 until argument is less than 0.5
-//              4) Finally use Taylor 
-//
-bcd
-bcd::Cosine() const
-{
-  long trisection, step;
-  bcd between, result, number, number2;
-  bcd c05(_T("0.5")), c1(1), c2(2), c3(3), c4(4);
-  bcd epsilon = Epsilon(2);
-
-  // Check if we can do this
-  if(IsNULL())
-  {
-    return bcd(Sign::ISNULL);
-  }
-  if(!IsValid())
-  {
-    return SetInfinity(_T("BCD: Cannot take the cosine of infinity!"));
-  }
-
-  number = *this;
-
-  // Reduce argument to between 0..2PI
-  result  = PI();
-  result *= c2;
-  if(number.AbsoluteValue() > result )
-  {
-    between = number / result; 
-    between = between.Floor();
-    number -= between * result;
-  }
-  if(number.GetSign() < 0)
-  {
-    number += result;
-  }
-  // Reduced it further to between 0..PI. u==2PI
-  between = PI();
-  if( number > between )
-  {
-    number = result - number;
-  }
-
-  // Breaking criterion, cosine close to 1 if number is close to zero
-  if(number.AbsoluteValue() < epsilon)
-  {
-    return (result = 1);
-  }
-
-  // Now use the trisection identity cos(3x)=-3*cos(x)+4*cos(x)^3
-  // until argument is less than 0.5
-  for( trisection = 0, between = c1; number / between > c05; ++trisection)
-  {
-    between *= c3;
-  }
-  number /= between;
-
-  // First step of the iteration
-  number2 = number * number;
-  between = c1;
-  result = between;
-
-  // Iterate with Taylor expansion
-  for(step=2; ;step += 2)
-  {
-    number   = number2; 
-    number  /= bcd(step);
-    number  /= bcd(step-1);
-    between *= number;
-    between  = -between;  // r.change_sign();
-    // Tolerance criterion
-    if(between.AbsoluteValue() < epsilon)
-    {
-      break;
-    }
-    result += between;
-  }
-
-  // Reapply the effects of the trisection again
-  for( ;trisection > 0; --trisection)
-  {
-    result *= ( c4 * result * result - c3 );
-  }
-  return result;
-}
-
-// bcd::Tangent
-// Description: Tangent of the angle
-// Technical:   Use the identity tan(x)=Sin(x)/Sqrt(1-Sin(x)^2)
-//              However first reduce x to between 0..2*PI
-//
-bcd
-bcd::Tangent() const
-{
-  bcd result, between, number;
-  bcd two(2), three(3);
-
-  // Check if we can do this
-  if(IsNULL())
-  {
-    return bcd(Sign::ISNULL);
-  }
-  if(!IsValid())
-  {
-    return SetInfinity(_T("BCD: Cannot take the tangent of infinity!"));
-  }
-
-  number = *this;
-
-  // Reduce argument to between 0..2PI
-  bcd pi     = PI();
-  bcd twopi  = two * pi;
-  if(number.AbsoluteValue() > twopi )
-  {
-    between  = number / twopi; 
-    between  = between.Floor();
-    number  -= between * twopi;
-  }
-
-  if(number.GetSign() < 0)
-  {
-    number += twopi;
-  }
-  bcd halfpi     = pi / two;
-  bcd oneandhalf = three * halfpi;
-  if( number == halfpi || number == oneandhalf)
-  { 
-    return SetInfinity(_T("BCD: Cannot calculate a tangent from a angle of 1/2 pi or 3/2 pi"));
-  }
-  // Sin(x)/Sqrt(1-Sin(x)^2)
-  result     = number.Sine(); 
-  bcd square = result * result;
-  bcd divide = bcd(1) - square;
-  bcd root   = sqrt(divide);
-  result    /= root;
-
-  // Correct for the sign
-  if(number > halfpi && number < oneandhalf)
-  {
-    result = -result;
-  }
-  return result;
-}
-
-// bcd::Asine
-// Description: ArcSine (angle) of the ratio
-// Technical:   Use Newton by solving the equation Sin(y)=x. Then y is Arcsine(x)
-//              Iterate by Newton y'=y-(sin(y)-x)/cos(y). 
-//              With initial guess using standard double precision arithmetic.
-// 
-bcd     
-bcd::ArcSine() const
-{
-  long step, reduction, sign;
-  double d;
-  bcd between, number, result, factor;
-  bcd c1(1);
-  bcd c2(2);
-  bcd c05(_T("0.5"));
-  bcd epsilon = Epsilon(5);
-
-  // Check if we can do this
-  if(IsNULL())
-  {
-    return bcd(Sign::ISNULL);
-  }
-  if(!IsValid())
-  {
-    return SetInfinity(_T("BCD: Cannot take the arcsine of infinity!"));
-  }
-
-  number = *this;
-  if(number > c1 || number < -c1)
-  {
-    return SetInfinity(_T("BCD: Cannot calculate an arcsine from a number > 1 or < -1"));
-  }
-
-  // Save the sign
-  sign = number.GetSign();
-  if(sign < 0)
-  {
-    number = -number;
-  }
-
-  // Reduce the argument to below 0.5 to make the newton run faster
-  for(reduction = 0; number > c05; ++reduction)
-  {
-    number /= sqrt(c2) * sqrt( c1 + sqrt( c1 - number * number ));
-  }
-  // Quick approximation of the asin
-  d = ::asin(number.AsDouble());
-  result = bcd( d );
-  factor = bcd( 1.0 / ::cos(d)); // Constant factor 
-
-  // Newton Iteration
-  for( step=0;; step++)
-  {
-    between = ( result.Sine() - number ) * factor;
-    // if( y - r == y )
-    if(between.AbsoluteValue() < epsilon)
-    {
-      break;
-    }
-    result -= between;
-  }
-
-  // Repair the reduction in the result
-  result *= bcd((long) (1 << reduction) );
-
-  // Take care of sign
-  if( sign < 0 )
-  {
-    result = -result;
-  }
-
-  // this is the result
-  return result;
-}
-
-// bcd::ArcCosine
-// Description: ArcCosine (angle) of the ratio
-// Technical:   Use ArcCosine(x) = PI/2 - ArcSine(x)
-bcd     
-bcd::ArcCosine() const
-{
-  bcd y;
-
-  // Check if we can do this
-  if(IsNULL())
-  {
-    return bcd(Sign::ISNULL);
-  }
-  if(!IsValid())
-  {
-    return SetInfinity(_T("BCD: Cannot take the arc-cosine of infinity!"));
-  }
-
-  y  = PI();
-  y /= bcd(2L);
-  y -= ArcSine();
-
-  return y;
-}
-
-// bcd::ArcTangent
-// Description: ArcTangent (angle) of the ratio
-// Technical:   Use the Taylor series. ArcTan(x) = x - x^3/3 + x^5/5 ...
-//              However first reduce x to abs(x)< 0.5 to improve taylor series
-//              using the identity. ArcTan(x)=2*ArcTan(x/(1+sqrt(1+x^2)))
-//
-bcd
-bcd::ArcTangent() const
-{
-  bcd  result, square;
-  bcd  between1,between2;
-  bcd  half(_T("0.5"));
-  bcd  one(1);
-  bcd  epsilon = Epsilon(5);
-  long k = 2;
-
-  // Check if we can do this
-  if(IsNULL())
-  {
-    return bcd(Sign::ISNULL);
-  }
-  if(!IsValid())
-  {
-    return SetInfinity(_T("BCD: Cannot take the arc-tangent of infinity!"));
-  }
-
-  result   = *this;
-  // Transform the solution to ArcTan(x)=2*ArcTan(x/(1+sqrt(1+x^2)))
-  result = result / ( one + sqrt( one + (result * result)));
-  if( result.AbsoluteValue() > half) // if still to big then do it again
-  {
-    k = 4;
-    result = result / (one + sqrt(one + (result * result)));
-  }
-  square = result * result;
-  between1  = result;
-  // Now iterate using Taylor expansion
-  for(long step = 3;; step += 2)
-  {
-    between1 *= square;
-    between1  = -between1;
-    between2  = between1 / bcd(step);
-    // Tolerance criterion
-    if(between2.AbsoluteValue() < epsilon)
-    {
-      break;
-    }
-    result += between2;
-  }
-
-  // Reapply the reduction/transformation
-  result *= bcd(k);
-
-  // this is the result
-  return result;
-}
-
-// bcd::Atan2
-// Description: Angle of two points
-// Technical:   return the angle (in radians) from the X axis to a point (y,x).
-//              use atan() to calculate atan2()
-//
-bcd
-bcd::ArcTangent2Points(const bcd& p_x) const
-{
-  bcd result;
-  bcd number = *this;
-  bcd nul, c05(_T("0.5"));
-
-  // Check if we can do this
-  if(IsNULL())
-  {
-    return bcd(Sign::ISNULL);
-  }
-  if(!IsValid() || !p_x.IsValid())
-  {
-    return SetInfinity(_T("BCD: Cannot take the arc-tangent-2 of infinity!"));
-  }
-
-  if( p_x == nul && number == nul)
-  {
-    return nul;
-  }
-  if( p_x == nul )
-  {
-    result = PI();
-    if( number < nul )
-    {
-      result *= -c05;
-    }
-    else
-    {
-      result *= c05;
-    }
-  }
-  else
-  {
-    if( number == nul )
-    {
-      if( p_x < nul )
-      {
-        result = PI();
-      }
-      else
-      {
-        result = nul;
-      }
-    }
-    else
-    {
-      result = bcd( number / p_x ).ArcTangent();
-      if( p_x < nul  && number < nul )
-      {
-        result -= PI();
-      }
-      if( p_x < nul && number >= nul )
-      {
-        result += PI();
-      }
-    }
-  }
-  return result;
-}
-
-//////////////////////////////////////////////////////////////////////////
-//
-// END OF BCD TRIGONOMETRIC FUNCTIONS
-//
-//////////////////////////////////////////////////////////////////////////
-
-//////////////////////////////////////////////////////////////////////////
-//
-// GET AS SOMETHING DIFFERENT THAN THE BCD
-//
-//////////////////////////////////////////////////////////////////////////
-
-// bcd::AsDouble
-// Description: Get as a double
-//
-double  
-bcd::AsDouble() const
-{
-  double result = 0.0;
-
-  // Check if we have a result
-  if(!IsValid() || IsNULL())
-  {
-    return result;
-  }
-
-  if(bcdDigits >= 8)
-  {
-    // SHORTCUT FOR PERFORMANCE: 
-    // A double cannot have more than 16 digits
-    // so everything over 16 digits gets discarded
-    result  = ((double)m_mantissa[0]) * 10.0 / (double) bcdBase;
-    result += ((double)m_mantissa[1]) * 10.0 / (double) bcdBase / (double) bcdBase;
-    //result += ((double)m_mantissa[2]) / bcdBase / bcdBase / bcdBase;
-  }
-  else
-  {
-    // Works for ALL implementations of bcdDigits  and bcdLength
-    // Get the mantissa into the result
-    double factor = 1.0;
-    for(int ind = 0; ind < bcdLength; ++ind)
-    {
-      long base    = bcdBase / 10;
-      long between = m_mantissa[ind];
-
-      for(int pos = bcdDigits; pos > 0; --pos)
-      {
-        // Get next number
-        long number = between / base;
-        between %= base;
-        base /= 10;
-
-        // Set in the result
-        result += (double)number * factor;
-        factor /= 10;
-      }
-    }
-  }
-
-  // Take care of exponent
-  if(m_exponent)
-  {
-    result *= ::pow(10.0,m_exponent);
-  }
-  // Take care of the sign
-  if(m_sign == Sign::Negative)
-  {
-    result = -result;
-  }
-  return result;
-}
-
-// bcd::AsShort
-// Description: Get as a short
-short   
-bcd::AsShort() const
-{
-  // Check if we have a result
-  if(!IsValid() || IsNULL())
-  {
-    return 0;
-  }
-
-  // Quick check for zero
-  if(m_exponent < 0)
-  {
-    return 0;
-  }
-  int exponent = bcdDigits - m_exponent - 1;
-
-  // Get from the mantissa
-  int result = m_mantissa[0];
-
-  // Adjust to exponent
-  while(exponent--)
-  {
-    result /= 10;
-  }
-
-  // Take care of sign and over/under flows
-  if(m_sign == Sign::Positive)
-  {
-    if(result > SHORT_MAX)
-    {
-      throw StdException(_T("BCD: Overflow in conversion to short number."));
-    }
-  }
-  else
-  {
-    if(result < SHORT_MIN)
-    {
-      throw StdException(_T("BCD: Underflow in conversion to short number."));
-    }
-    result = -result;
-  }
-  return (short) result;
-}
-
-// bcd::AsUShort
-// Description: Get as an unsigned short
-ushort  
-bcd::AsUShort() const
-{
-  // Check if we have a result
-  if(!IsValid() || IsNULL())
-  {
-    return 0;
-  }
-
-  // Check for unsigned
-  if(m_sign == Sign::Negative)
-  {
-    throw StdException(_T("BCD: Cannot convert a negative number to an unsigned short number."));
-  }
-  // Quick check for zero
-  if(m_exponent < 0)
-  {
-    return 0;
-  }
-
-  // Get from the mantissa
-  int result = m_mantissa[0];
-
-  // Adjust to exponent
-  int exponent = bcdDigits - m_exponent - 1;
-  while(exponent--)
-  {
-    result /= 10;
-  }
-
-  // Take care of overflow
-  if(result > USHORT_MAX)
-  {
-    throw StdException(_T("BCD: Overflow in conversion to unsigned short number."));
-  }
-
-  return (short)result;
-}
-
-// bcd::AsLong
-// Description: Get as a long
-long    
-bcd::AsLong() const
-{
-  // Check if we have a result
-  if(!IsValid() || IsNULL())
-  {
-    return 0;
-  }
-
-  // Quick optimization for really small numbers
-  if(m_exponent < 0)
-  {
-    return 0L;
-  }
-
-  // Get from the mantissa
-  int64 result = ((int64)m_mantissa[0] * bcdBase) + ((int64)m_mantissa[1]);
-
-  // Adjust to exponent
-  int exponent = 2 * bcdDigits - m_exponent - 1;
-  if(exponent > 0)
-  {
-    while(exponent--)
-    {
-      result /= 10;
-    }
-  }
-
-  // Take care of sign and over/under flows
-  if(m_sign == Sign::Positive)
-  {
-    if(result > LONG_MAX)
-    {
-      throw StdException(_T("BCD: Overflow in conversion to integer number."));
-    }
-  }
-  else
-  {
-    if(result < LONG_MIN)
-    {
-      throw StdException(_T("BCD: Underflow in conversion to integer number."));
-    }
-    result = -result;
-  }
-  return (long) result;
-}
-
-// bcd::AsULong
-// Get as an unsigned long
-ulong   
-bcd::AsULong() const
-{
-  // Check if we have a result
-  if(!IsValid() || IsNULL())
-  {
-    return 0;
-  }
-
-  // Check for unsigned
-  if(m_sign == Sign::Negative)
-  {
-    throw StdException(_T("BCD: Cannot convert a negative number to an unsigned long."));
-  }
-
-  // Quick optimization for really small numbers
-  if(m_exponent < 0)
-  {
-    return 0L;
-  }
-
-  // Get from the mantissa
-  int64 result = ((int64)m_mantissa[0] * bcdBase) + ((int64)m_mantissa[1]);
-
-  // Adjust to exponent
-  int exponent = 2 * bcdDigits - m_exponent - 1;
-  while(exponent--)
-  {
-    result /= 10;
-  }
-
-  // Take care of overflow
-  if(result > ULONG_MAX)
-  {
-    throw StdException(_T("BCD: Overflow in conversion to unsigned long integer."));
-  }
-  return (long)result;
-}
-
-// bcd::AsInt64
-// Description: Get as a 64 bits long number
-//
-int64
-bcd::AsInt64() const
-{
-  // Check if we have a result
-  if(!IsValid() || IsNULL())
-  {
-    return 0;
-  }
-
-  // Quick optimization for really small numbers
-  if(m_exponent < 0)
-  {
-    return 0L;
-  }
-  int64 result1 = 0L;
-  int64 result2 = 0L;
-  int exponent  = 4 * bcdDigits - m_exponent - 1;
-  int64 base2   = (int64)bcdBase * ((int64)bcdBase);
-  int64 base    = base2 / 10;
-
-  // Get from the mantissa
-  result1 = ((int64)m_mantissa[0] * bcdBase) + ((int64)m_mantissa[1]);
-  result2 = ((int64)m_mantissa[2] * bcdBase) + ((int64)m_mantissa[3]);
-
-  // Adjust to exponent
-  while(exponent--)
-  {
-    int64 carry = result1 %10;
-    result1 /= 10;
-    result2 /= 10;
-    result2 += carry * base;
-  }
-
-  // Take care of overflow
-  if(result1 > (LLONG_MAX / base2))
-  {
-    throw StdException(_T("BCD: Overflow in conversion to 64 bits integer number."));
-  }
-  result2 += (result1 * base2);
-
-  // Take care of sign 
-  if(m_sign == Sign::Negative)
-  {
-    result2 = -result2;
-  }
-  return result2;
-}
-
-// Get as an unsigned 64 bits long
-uint64  
-bcd::AsUInt64() const
-{
-  // Check if we have a result
-  if(!IsValid() || IsNULL())
-  {
-    return 0;
-  }
-
-  // Check for negative
-  if(m_sign == Sign::Negative)
-  {
-    throw StdException(_T("BCD: Cannot convert a negative number to an unsigned 64 bits integer"));
-  }
-  // Quick optimization for really small numbers
-  if(m_exponent < 0)
-  {
-    return 0L;
-  }
-  uint64 result1 = 0L;
-  uint64 result2 = 0L;
-  int exponent   = 4 * bcdDigits - m_exponent - 1;
-  uint64 base2   = (uint64)bcdBase * ((uint64)bcdBase);
-  uint64 base    = base2 / 10;
-
-  // Get from the mantissa
-  result1 = ((uint64)m_mantissa[0] * bcdBase) + ((uint64)m_mantissa[1]);
-  result2 = ((uint64)m_mantissa[2] * bcdBase) + ((uint64)m_mantissa[3]);
-
-  // Adjust to exponent
-  while(exponent--)
-  {
-    uint64 carry    = result1 %10;
-    result1 /= 10;
-    result2 /= 10;
-    result2 += carry * base;
-  }
-
-  // Take care of overflow
-  if(result1 > (ULLONG_MAX / base2))
-  {
-    throw StdException(_T("BCD: Overflow in conversion to 64 bits unsigned integer number."));
-  }
-  result2 += (result1 * base2);
-
-  return result2;
-}
-
-// bcd::AsString
-// Description: Get as a mathematical string
-//
-// Engineering format: Convert back to "[sign][digit][.[digit]*][E[sign][digits]+]"
-// Bookkeeping format: Convert back to "[sign]9[digit]*][.[digit]*]"
-// Optionally also print the positive '+' ('-' negative sign is always printed!)
-// Optionally get with fixed decimals, default = 2 decimals (most common default for bookkeeping purposes)
-// Optionally get as much as needed decimals with "p_decimals = 0"
-XString 
-bcd::AsString(Format p_format /*=Bookkeeping*/,bool p_printPositive /*=false*/,int p_decimals /*=2*/) const
-{
-  XString result;
-  int expo   = m_exponent;
-  int prec   = bcdDigits * bcdLength;
-
-  // Shortcut for infinity and not-a-number
-  switch(m_sign)
-  {
-    case Sign::NaN:     return  _T("NaN");
-    case Sign::INF:     return  _T("INF");
-    case Sign::MIN_INF: return _T("-INF");
-    case Sign::ISNULL:  return _T("NULL");
-  }
-
-  // Check format possibilities
-  if(expo < -(prec/2) || expo > (prec/2))
-  {
-    p_format = Format::Engineering;
-  }
-
-  // Construct the mantissa string
-  for(int mantpos = 0; mantpos < bcdLength; ++mantpos)
-  {
-    long number = m_mantissa[mantpos];
-    long base   = bcdBase / 10;
-    for(int digitpos = bcdDigits; digitpos > 0; --digitpos)
-    {
-      long num = number / base;
-      number   = number % base;
-      TCHAR c  = (TCHAR)num + '0';
-      base    /= 10;
-
-      result += c;
-    }
-  }
-  // Stripping trailing zeros.
-  result = result.TrimRight('0');
-
-  if(p_format == Format::Engineering)
-  {
-    XString left = result.Left(1);
-    result = left + XString(_T(".")) + result.Mid(1) + XString(_T("E"));
-    result += LongToString(expo);
-  }
-  else // Bookkeeping
-  {
-    if(m_exponent < 0)
-    {
-      XString left(_T("0."));
-      for(int ind = -1; ind > m_exponent; --ind)
-      {
-        left += _T("0");
-      }
-      result = left + result;
-    }
-    if(m_exponent >= 0)
-    {
-      int pos = 1 + m_exponent;
-      XString before = result.Left(pos);
-      XString behind = result.Mid(pos);
-      while(before.GetLength() < pos)
-      {
-        before += _T("0");
-      }
-      result = before;
-      while(p_decimals > 0 && behind.GetLength() < p_decimals)
-      {
-        behind += '0';
-      }
-      if(!behind.IsEmpty())
-      {
-        result += XString(_T(".")) + behind;
-      }
-    }
-  }
-
-  // Take care of the sign
-  // result = ((m_sign == Positive ) ? "+" : "-") + result;
-  if(m_sign == Sign::Positive)
-  {
-    if(p_printPositive)
-    {
-      result = _T("+") + result;
-    }
-  }
-  else
-  {
-    result = _T("-") + result;
-  }
-
-  // Ready
-  return result;
-}
-
-// Display strings are always in Format::Bookkeeping
-// as most users find mathematical exponential notation hard to read.
-XString 
-bcd::AsDisplayString(int p_decimals /*=2*/) const
-{
-  // Shortcut for infinity and not-a-number
-  switch(m_sign)
-  {
-    case Sign::NaN:     return  _T("NaN");
-    case Sign::INF:     return  _T("INF");
-    case Sign::MIN_INF: return _T("-INF");
-    case Sign::ISNULL:  return _T("NULL");
-  }
-
-  // Initialize locale strings
-  InitValutaString();
-
-  // Not in the bookkeeping range
-  if(m_exponent > 12 || m_exponent < -2)
-  {
-    return AsString(bcd::Format::Engineering,false,p_decimals);
-  }
-  bcd number(*this);
-  number.Round(p_decimals);
-
-  XString str = number.AsString(Format::Bookkeeping,false,p_decimals);
-  int pos = str.Find('.');
-  if(pos >= 0)
-  {
-    str.Replace(_T("."),g_locale_decimalSep);
-  }
-
-  // Apply thousand separators in first part of the number
-  if((pos > 0) || (pos == -1 && str.GetLength() > 3))
-  {
-    XString result = pos > 0 ? str.Mid(pos) : XString();
-    str = pos > 0 ? str.Left(pos) : str;
-    pos = result.GetLength();
-
-    while(str.GetLength() > 3)
-    {
-      result = XString(g_locale_thousandSep) + str.Right(3) + result;
-      str = str.Left(str.GetLength() - 3);
-    }
-    str += result;
-  }
-  
-  // Extra zero's for the decimals?
-  if((pos <= 0 && p_decimals > 0) || (0 < pos && pos <= p_decimals))
-  {
-    // Round on this number of decimals
-    int decimals(p_decimals);
-    if(pos < 0)
-    {
-      str += g_locale_decimalSep;
-    }
-    else
-    {
-      decimals = p_decimals - pos + 1;
-    }
-    for(int index = 0;index < decimals; ++index)
-    {
-      str += _T("0");
-    }
-  }
-  return str;
-}
-
-// Get as an ODBC SQL NUMERIC
-void
-bcd::AsNumeric(SQL_NUMERIC_STRUCT* p_numeric) const
-{
-  // Init the value array
-  memset(p_numeric->val,0,SQL_MAX_NUMERIC_LEN);
-
-  // Check if we have a result
-  if(!IsValid() || IsNULL())
-  {
-    return;
-  }
-
-  // Special case for 0.0 or smaller than can be contained (1.0E-38)
-  if(IsZero() || m_exponent < -SQLNUM_MAX_PREC)
-  {
-    return;
-  }
-
-  // Check for overflow. Cannot be greater than 9.999999999E+37
-  if(m_exponent >= SQLNUM_MAX_PREC)
-  {
-    throw StdException(_T("BCD: Overflow in converting bcd to SQL NUMERIC/DECIMAL"));
-  }
-
-  SQLCHAR precision = 0;
-  SQLCHAR scale = 0;
-  CalculatePrecisionAndScale(precision,scale);
-
-  // Setting the sign, precision and scale
-  p_numeric->sign      = (m_sign == Sign::Positive) ? 1 : 0;
-  p_numeric->precision = precision;
-  p_numeric->scale     = scale;
-
-  // Converting the value array
-  bcd one(1);
-  bcd radix(256);
-  bcd accu(*this);
-  int index = 0;
-
-  // Here is the big trick: use the exponent to scale up the number
-  // Adjusting m_exponent to positive scaled integer result
-  accu.m_exponent += (short)scale;
-  accu.m_sign      = Sign::Positive;
-
-  while(true)
-  {
-    // Getting the next val array value, relying on the bcd::modulo
-    bcd val = accu.Mod(radix);
-    p_numeric->val[index++] = (SQLCHAR) val.AsLong();
-
-    // Adjust the intermediate accu
-    accu -= val;
-    accu  = accu.Div(radix);
-
-    // Breaking criterion: nothing left
-    if(accu < one)
-    {
-      break;
-    }
-
-    // Breaking criterion on overflow
-    // Check as last, number could fit exactly!
-    if(index >= SQL_MAX_NUMERIC_LEN)
-    {
-      break;
-    }
-  }
-}
-
-//////////////////////////////////////////////////////////////////////////
-//
-// END OF "GET AS SOMETHING DIFFERENT"
-//
-//////////////////////////////////////////////////////////////////////////
-
-//////////////////////////////////////////////////////////////////////////
-//
-// GETTERS of BCD
-//
-//////////////////////////////////////////////////////////////////////////
-
-// bcd::IsNull
-// Description: Gets the fact that bcd is exactly 0.0
-bool  
-bcd::IsZero() const
-{
-  // Shortcut test
-  if(m_sign == Sign::Negative || m_exponent != 0)
-  {
-    return false;
-  }
-  // The normalized mantissa's first part must be a number
-  // otherwise the total of the bcd is NULL!!
-  // So: No need to scan the whole mantissa!!
-  if(m_mantissa[0])
-  {
-    // Also works for (-)INF, NaN and NULL
-    return false;
-  }
-  return true;
-}
-
-// Is bcd a database NULL
-bool
-bcd::IsNULL() const
-{
-  return m_sign == Sign::ISNULL;
-}
-
-// bcd::IsNearZero
-// Description: Nearly zero or zero
-bool
-bcd::IsNearZero()
-{
-  // NULL, NaN or (-)INF is never 'near zero'
-  if(m_sign > Sign::Negative)
-  {
-    return false;
-  }
-  bcd epsilon = Epsilon(5);
-  return AbsoluteValue() < epsilon;
-}
-
-// Not an (-)INF or a NaN
-bool
-bcd::IsValid() const
-{
-  return m_sign <= Sign::Negative;
-}
-
-// bcd::GetSign
-// Description: Gets the sign
-// Technical:   Returns -1 (negative), 0 or 1 (Positive)
-// Beware;      NaN, (-)INF also returns a 0
-int   
-bcd::GetSign() const
-{
-  // Negative number returns -1
-  if(m_sign == Sign::Negative)
-  {
-    return -1;
-  }
-  // Positive number returns 1
-  if(m_mantissa[0] || m_exponent)
-  {
-    return 1;
-  }
-  // Number is NULL. Sign = 0, or (-)INF or NaN
-  return 0;
-}
-
-// Gets Signed status Positive, Negative, -INF, INF, NaN
-bcd::Sign
-bcd::GetStatus() const
-{
-  return m_sign;
-}
-
-// bcd::GetLength
-// Description: Total length (before and after decimal point)
-// Technical:   Returns the actual length (not the precision)
-int   
-bcd::GetLength() const
-{
-  int length  = 0;
-  int counter = 0;
-
-  // Length of the display string
-  switch(m_sign)
-  {
-    case Sign::NaN:     return 3;
-    case Sign::INF:     return 3;
-    case Sign::MIN_INF: return 4;
-    case Sign::ISNULL:  return 4;
-  }
-
-  // Quick optimization
-  if(IsZero())
-  {
-    // Zero (0) has length of 1
-    return 1;
-  }
-
-  // Walk the mantissa
-  for(int pos = 0;pos < bcdLength; ++pos)
-  {
-    long number = m_mantissa[pos];
-    long base   = bcdBase / 10;
-
-    for(int dig = bcdDigits; dig > 0; --dig)
-    {
-      // Actual position
-      ++counter;
-
-      // See if there is a digit here
-      long num = number / base;
-      number  %= base;
-      base    /= 10;
-      if(num)
-      {
-        length = counter;
-      }
-    }
-  }
-  return length;
-}
-
-// bcd::GetPrecision
-// Description: Total precision (length after the decimal point)
-int   
-bcd::GetPrecision() const
-{
-  // Quick optimization
-  if(IsZero() || !IsValid() || IsNULL())
-  {
-    return 0;
-  }
-
-  // Default max precision
-  int precision = bcdPrecision;
-
-  for(int posLength = bcdLength - 1; posLength >= 0; --posLength)
-  {
-    int mant = m_mantissa[posLength];
-    for(int posDigits =  bcdDigits - 1;posDigits >= 0; --posDigits)
-    {
-      int last = mant % 10;
-      mant /= 10;       // Next pos
-      if(last == 0)
-      {
-        --precision;
-      }
-      else
-      {
-        // Break on first non-zero 
-        // by terminating both loops
-        posDigits = -1;
-        posLength = -1;
-      }
-    }
-  }
-  // Precision is 1 based (1 position for the decimal point implied)
-  precision -= 1;
-  // Precision is inverse to the exponent (higher exponent, means less behind the decimal point)
-  precision -= m_exponent;
-  // Precision cannot be less than zero
-  if(precision < 0)
-  {
-    precision = 0;
-  }
-  // Return the result
-  return precision;
-}
-
-// bcd::GetMaxSize
-// Description: Get the max size of a bcd
-int 
-bcd::GetMaxSize(int /* precision /*= 0*/)
-{
-  // int size = bcdDigits * bcdLength;
-  return bcdPrecision;
-}
-
-// bcd::GetFitsInLong
-// Gets the fact that it fits in a long
-bool  
-bcd::GetFitsInLong() const
-{
-  // Infinity does not fit in a long :-)
-  if(!IsValid() || IsNULL())
-  {
-    return false;
-  }
-
-  try
-  {
-    AsLong();
-  }
-  catch(StdException& ex)
-  {
-    ReThrowSafeException(ex);
-    return false;
-  }
-  return true;
-}
-
-// bcd::GetFitsInInt64
-// Description: Gets the fact that it fits in an int64
-//
-bool  
-bcd::GetFitsInInt64() const
-{
-  // Infinity does not fit in an int64 :-)
-  if(!IsValid() || IsNULL())
-  {
-    return false;
-  }
-
-  try
-  {
-    AsInt64();
-  }
-  catch(StdException& ex)
-  {
-    ReThrowSafeException(ex);
-    return false;
-  }
-  return true;
-}
-
-// bcd::GetHasDecimals
-// Description: Decimal part (behind the decimal point) is not "000" (zeros)
-bool  
-bcd::GetHasDecimals() const
-{
-  // Shortcut for ZERO
-  if(IsZero() || !IsValid() || IsNULL())
-  {
-    return false;
-  }
-  // Shortcut: some decimals must exist
-  if(m_exponent < 0)
-  {
-    return true;
-  }
-
-  // Compare the length with the exponent.
-  // If exponent smaller, the rest is behind the decimal point
-  int length = GetLength();
-  if(m_exponent < (length - 1))
-  {
-    return true;
-  }
-  return false;
-}
-
-// bd::GetExponent
-// Description: Gets the 10-based exponent
-int   
-bcd::GetExponent() const
-{
-  // Infinity has no exponent
-  if(!IsValid() || IsNULL())
-  {
-    return 0;
-  }
-  return m_exponent;
-}
-
-// bcd::GetMantissa
-// Description: Gets the mantissa
-bcd   
-bcd::GetMantissa() const
-{
-  if(!IsValid() || IsNULL())
-  {
-    return SetInfinity(_T("BCD: Infinity cannot give a mantissa."));
-  }
-
-  bcd number(*this);
-
-  number.m_sign     = Sign::Positive;
-  number.m_exponent = 0;
-  return number;
-}
-
-//////////////////////////////////////////////////////////////////////////
-//
-// END OF GETTERS OF BCD
-//
-//////////////////////////////////////////////////////////////////////////
-
-//////////////////////////////////////////////////////////////////////////
-//
-// INTERNALS OF BCD
-//
-//////////////////////////////////////////////////////////////////////////
-
-// Take the absolute value of a long
-// This method is taken outside the <math> library or other macro's.
-// It was needed because some versions of std linked wrongly
-long 
-bcd::long_abs(const long p_value) const
-{
-  if(p_value < 0)
-  {
-    return -p_value;
-  }
-  return p_value;
-}
-
-// bcd::SetValueInt
-// Description: Sets one integer in this bcd number
-void  
-bcd::SetValueInt(const int p_value)
-{
-  Zero();
-
-  // Shortcut if value is zero
-  if(p_value == 0)
-  {
-    return;
-  }
-  // Take care of sign
-  m_sign = (p_value < 0) ? Sign::Negative : Sign::Positive;
-  // Place in mantissa
-  m_mantissa[0] = long_abs(p_value);
-  // And normalize
-  Normalize(bcdDigits - 1);
-}
-
-// bcd::SetValueLong
-// Description: Set the bcd to the value of two longs
-//              Numbers can be set as bcd(12345,4567) -> +1.23454567E+4 = 12,345.4567
-//              Works up to 8 positions before and after the decimal point
-// Parameters:  const long value     // value before the decimal point
-//              const long restValue // Optional value behind the decimal point
-//
-void
-bcd::SetValueLong(const long p_value, const long p_restValue)
-{
-  Zero();
-
-  if(p_value == 0 && p_restValue == 0)
-  {
-    // Nothing more to do. We are zero
-    return;
-  }
-  // Get the sign
-  if (p_value == 0)
-  {
-    m_sign = (p_restValue < 0) ? Sign::Negative : Sign::Positive;
-  }
-  else
-  {
-    m_sign = (p_value < 0) ? Sign::Negative : Sign::Positive;
-  }
-  // Fill in mantissa. restValue first
-  int norm = 0;
-
-  if(p_restValue)
-  {
-    m_mantissa[0] = long_abs(p_restValue % bcdBase);
-    norm = -1;
-
-    if(p_restValue / bcdBase)
-    {
-      ShiftRight();
-      m_mantissa[0] = long_abs(p_restValue / bcdBase);
-      norm -= bcdDigits;
-    }
-    Normalize(norm);
-    norm = 0;
-    if(p_value)
-    {
-      ShiftRight();
-    }
-  }
-
-  if(p_value % bcdBase)
-  {
-    m_mantissa[0] = long_abs(p_value % bcdBase);
-    norm = bcdDigits - 1;
-  }
-  if(p_value / bcdBase)
-  {
-    ShiftRight();
-    m_mantissa[0] = long_abs(p_value / bcdBase);
-    norm = 2 * bcdDigits - 1;
-  }
-  Normalize(norm);
-}
-
-// bcd::SetValueint64
-// Description: Set the bcd to the value of two longs
-//              Numbers can be set as bcd(12345,4567) -> +1.23454567E+4 = 12,345.4567
-//              Works up to all 19 positions before and after the decimal point
-// Parameters:  const long value     // value before the decimal point
-//              const long restValue // Optional value behind the decimal point
-// Be advised:  The restValues behave as digits left shifted to the decimal marker
-//              5      becomes 0.5
-//              15     becomes 0.15
-//              2376   becomes 0.2376
-void  
-bcd::SetValueInt64(const int64 p_value, const int64 p_restValue)
-{
-  Zero();
-
-  int64 dblBcdDigits = (int64)bcdBase * (int64)bcdBase;
-
-  if(p_value == 0L && p_restValue == 0L)
-  {
-    // Nothing more to do. We are zero
-    return;
-  }
-  // Get the sign
-  if(p_value == 0L)
-  {
-    m_sign = (p_restValue < 0L) ? Sign::Negative : Sign::Positive;
-  }
-  else
-  {
-    m_sign = (p_value < 0L) ? Sign::Negative : Sign::Positive;
-  }
-  // Fill in mantissa
-  int norm = 0;
-
-  // Part after the decimal point first
-  if(p_restValue % bcdBase)
-  {
-    m_mantissa[0] = long_abs(p_restValue % bcdBase);
-    norm = bcdDigits - 1;
-  }
-  if(p_restValue / bcdBase)
-  {
-    ShiftRight();
-    m_mantissa[0] = long_abs((long)((p_restValue / bcdBase) % bcdBase));
-    norm = 2 * bcdDigits - 1;
-  }
-  if(p_restValue / dblBcdDigits)
-  {
-    ShiftRight();
-    m_mantissa[0] = long_abs((long)(p_restValue / dblBcdDigits));
-    norm = 3 * bcdDigits - 1;
-  }
-
-  if(p_restValue)
-  {
-    // Normalize the rest value to be left shifted
-    Normalize(norm);
-    norm = 0; // reset !!
-  }
-
-  // Part before the decimal point
-  if(p_value % bcdBase)
-  {
-    ShiftRight();
-    m_mantissa[0] = long_abs((long)(p_value % bcdBase));
-    norm = bcdDigits - 1;
-  }
-  if(p_value / bcdBase)
-  {
-    ShiftRight();
-    m_mantissa[0] = long_abs((long)((p_value / bcdBase) % bcdBase));
-    norm = 2 * bcdDigits - 1;
-  }
-  if(p_value / dblBcdDigits)
-  {
-    ShiftRight();
-    m_mantissa[0] = long_abs((long)(p_value / dblBcdDigits));
-    norm = 3 * bcdDigits -1;
-  }
-
-  // Normalize the whole result
-  Normalize(norm);
-}
-
-void    
-bcd::SetValueUInt64(const uint64 p_value,const int64 p_restValue)
-{
-  uint64 value(p_value);
-  bool extra = false;
-  if(p_value > LONGLONG_MAX)
-  {
-    extra  = true;
-    value -= LONGLONG_MAX;
-    value -= 1;
-  }
-  SetValueInt64(value,p_restValue);
-  if(extra)
-  {
-    *this += bcd(LONGLONG_MAX);
-    *this += bcd(1);
-  }
-  Normalize();
-}
-
-// bcd::SetValueDouble
-// Description: Sets the value from a double
-void  
-bcd::SetValueDouble(const double p_value)
-{
-  // Make empty
-  Zero();
-
-  // Save in between value
-  double between = p_value;
-  double notused;
-
-  // Take care of sign
-  if(p_value < 0.0)
-  {
-    m_sign  = Sign::Negative;
-    between = -between;
-  }
-  // Take care of exponent
-  m_exponent = (short)::log10(between);
-
-  // Normalize
-  between *= ::pow(10.0,(int)-m_exponent);
-
-  // Set the double mantissa into the m_mantissa
-  // A double has 16 digits
-  for(int ind = 0;ind < (16 / bcdDigits); ++ind)
-  {
-    long base = bcdBase / 10;
-    for(int pos = 0; pos < bcdDigits; ++pos)
-    {
-      long res = (long) ::fmod(between,10.0);
-      between  = ::modf(between,&notused) * 10;
-
-      m_mantissa[ind] += res * base;
-      base /= 10;
-    }
-  }
-  Normalize();
-}
-
-// bcd::SetValueString
-// Description: Set the value of the bcd from a string
-// Technical:   Scans [sign][digit][.[digit]*][E[sign][digits]+]
-//              part =       1        2          3    
-void
-bcd::SetValueString(LPCTSTR p_string,bool /*p_fromDB*/)
-{
-  // Zero out this number
-  Zero();
-
-  bool spacing   = true;
-  bool signing   = true;
-  int  mantpos   = 0;
-  int  digitpos  = bcdDigits;
-  int  base      = bcdBase / 10;
-  int  part      = 1;
-  int  exp_extra = 0;
-  Sign exp_sign  = Sign::Positive;
-  
-  // For normalized numbers without a first part
-  m_exponent = -1;
-
-  // Check special cases
-  if(_tcscmp(p_string,_T("INF")) == 0)
-  {
-    m_sign = Sign::INF;
-    return;
-  }
-  if(_tcscmp(p_string,_T("-INF")) == 0)
-  {
-    m_sign = Sign::MIN_INF;
-    return;
-  }
-  if(_tcscmp(p_string,_T("NaN")) == 0)
-  {
-    m_sign = Sign::NaN;
-    return;
-  }
-  if(_tcscmp(p_string,_T("NULL")) == 0)
-  {
-    m_sign = Sign::ISNULL;
-    return;
-  }
-
-  // Scan the entire string
-  for(LPCTSTR pos = p_string; *pos; ++pos)
-  {
-    // Get a char at the next position
-    _TUCHAR c = *pos;
-
-    // Skip whitespace at the beginning
-    if(spacing)
-    {
-      if(isspace(c))
-      {
-        continue;
-      }
-      spacing = false;
-    }
-    // See if a sign is found
-    if(signing && part == 1)
-    {
-      if(c == '-')
-      {
-        m_sign  = Sign::Negative;
-        signing = false;
-        continue;
-      }
-      if(c == '+')
-      {
-        m_sign  = Sign::Positive;
-        signing = false;
-        continue;
-      }
-    }
-    // Get type of next character
-    switch(c)
-    {
-      case '.': part = 2; 
-                break;
-      case 'e': // Fall through
-      case 'E': part = 3; 
-                break;
-      case '-': exp_sign = Sign::Negative;
-                break;
-      case '+': exp_sign = Sign::Positive;
-                break;
-      default:  // Now must be a digit. No other chars allowed
-                if(isdigit(c) == false)
-                {
-                  Zero();
-                  m_sign = Sign::NaN;
-                  if(g_throwing)
-                  {
-                    throw StdException(_T("BCD: Conversion from string. Bad format in decimal number"));
-                  }
-                  return;
-                }
-                break;
-    }
-    // Decimal point found. Just continue
-    if(part == 2 && c == '.')
-    {
-      continue;
-    }
-    // Exponent just found. Just continue;
-    if(part == 3 && (c == 'e' || c == 'E'))
-    {
-      continue;
-    }
-    // Exponent sign just found. Just continue
-    if(c == '-' || c == '+')
-    {
-      continue;
-    }
-    // Get next char pos
-    int number = c - '0';
-    // Building the mantissa
-    if(part == 1 || part == 2)
-    {
-      // Adjusting exponent
-      if(part == 1)
-      {
-        // Before the decimal point, the exponent grows
-        ++m_exponent;
-      }
-      // Set in the mantissa
-      if(mantpos < bcdLength)
-      {
-        m_mantissa[mantpos] += number * base;
-        base /= 10;
-
-        // Check for next position in the mantissa
-        if(--digitpos == 0)
-        {
-          // Reset for the next long in the mantissa
-          base     = bcdBase / 10;
-          digitpos = bcdDigits;
-
-          // Next position
-          ++mantpos;
-        }
-      }
-      // else skip the latter part of the mantissa
-    }
-    // Building the exponent
-    if(part == 3)
-    {
-      exp_extra *= 10;
-      exp_extra += number;
-    }
-  }
-  // Ready with the string
-
-  // Adjust the exponent from saved variables
-  if(exp_extra)
-  {
-    if(exp_sign == Sign::Negative)
-    {
-      exp_extra = -exp_extra;
-    }
-    m_exponent += (short) exp_extra;
-  }
-  // Normalize for "0.xxx" case
-  Normalize();
-}
-
-// Sets the value from a SQL NUMERIC
-void  
-bcd::SetValueNumeric(const SQL_NUMERIC_STRUCT* p_numeric)
-{
-  int maxval = SQL_MAX_NUMERIC_LEN - 1;
-
-  // Start at zero
-  Zero();
-
-  // Find the last value in the numeric
-  int ind = maxval;
-  for(;ind >= 0; --ind)
-  {
-    if(p_numeric->val[ind])
-    {
-      maxval = ind;
-      break;
-    }
-  }
-
-  // Special case: NUMERIC = zero
-  if(ind < 0)
-  {
-    return;
-  }
-
-  // Compute the value array to the bcd-mantissa
-  bcd radix(1);
-  for(ind = 0;ind <= maxval; ++ind)
-  {
-    bcd val = radix * bcd(p_numeric->val[ind]);
-    *this   = Add(val);
-    radix  *= 256;  // Value array is in 256 radix
-  }
-
-  // Compute the exponent from the precision and scale
-  m_exponent -= p_numeric->scale;
-
-  // Adjust the sign
-  m_sign      = (p_numeric->sign == 1) ? Sign::Positive : Sign::Negative;
-}
-
-// bcd::Normalize
-// Description: Normalize the exponent. 
-//              Always up to first position with implied decimal point
-void
-bcd::Normalize(int p_startExponent /*=0*/)
-{
-  // Set starting exponent
-  if(p_startExponent)
-  {
-    m_exponent = (short)p_startExponent;
-  }
-  // Check for zero first
-  bool zero = true;
-  for(int ind = 0; ind < bcdLength; ++ind)
-  {
-    if(m_mantissa[ind])
-    {
-      zero = false;
-    }
-  }
-  // Zero mantissa found
-  if(zero)
-  {
-    m_sign     = Sign::Positive;
-    m_exponent = 0;
-    return;
-  }
-  // See to it that the mantissa is normalized
-  int shift = 0;
-  while(((m_mantissa[0] * 10) / bcdBase) == 0)
-  {
-    ++shift;
-    Mult10();
-  }
-  // Calculate exponent from number of shifts
-  m_exponent -= (short) shift;
-}
-
-// bcd::Mult10
-// Description: Multiply the mantissa by 10
-// Technical:   Optimize by doing shifts
-//              Pure internal operation for manipulating the mantissa
-//
-void
-bcd::Mult10(int p_times /* = 1 */)
-{
-  // If the number of times is bigger than bcdDigits
-  // Optimize by doing shifts instead of MULT
-  if(p_times / bcdDigits)
-  {
-    int shifts = p_times / bcdDigits;
-    p_times   %= bcdDigits;
-    while(shifts--)
-    {
-      ShiftLeft();
-    }
-  }
-  while(p_times--)
-  {
-    long carry   = 0;
-
-    // Multiply all positions by 10
-    for(int ind = bcdLength -1; ind >= 0; --ind)
-    {
-      long between    = m_mantissa[ind] * 10 + carry;
-      m_mantissa[ind] = between % bcdBase;
-      carry           = between / bcdBase;
-    }
-  }
-}
-
-// bcd::Div10
-// Description: Divide the mantissa by 10
-// Technical:   Optimize by doing shifts
-//              Pure internal operation for manipulating the mantissa
-void
-bcd::Div10(int p_times /*=1*/)
-{
-  // if the number of times is bigger than bcdDigits
-  // optimize by doing shifts instead of divs
-  if(p_times / bcdDigits)
-  {
-    int shifts = p_times / bcdDigits;
-    p_times   %= bcdDigits;
-    while(shifts--)
-    {
-      ShiftRight();
-    }
-  }
-  while(p_times--)
-  {
-    long carry   = 0;
-
-    for(int ind = 0; ind < bcdLength; ++ind)
-    {
-      long between    = m_mantissa[ind] + (carry * bcdBase);
-      carry           = between % 10;
-      m_mantissa[ind] = between / 10;
-    }
-  }
-}
-
-// bcd::ShiftRight
-// Description: Shift the mantissa members one position right
-void
-bcd::ShiftRight()
-{
-  for(int ind = bcdLength - 1; ind > 0; --ind)
-  {
-    m_mantissa[ind] = m_mantissa[ind - 1];
-  }
-  m_mantissa[0] = 0;
-}
-
-// bcd::ShiftLeft
-// Description: Shift the mantissa members one position left
-void
-bcd::ShiftLeft()
-{
-  for(int ind = 0; ind < bcdLength - 1; ++ind)
-  {
-    m_mantissa[ind] = m_mantissa[ind + 1];
-  }
-  m_mantissa[bcdLength - 1] = 0;
-}
-
-// bcd::LongNaarString
-XString
-bcd::LongToString(long p_value) const
-{
-  TCHAR buffer[20];
-  _itot_s(p_value,buffer,20,10);
-  return XString(buffer);
-}
-
-// bcd::StringNaarLong
-// Description: Convert a string to a single long value
-long
-bcd::StringToLong(LPCTSTR p_string) const
-{
-  return _ttoi(p_string);
-}
-
-// bcd::SplitMantissa
-// Description: Split the mantissa for floor/ceiling operations
-bcd
-bcd::SplitMantissa() const
-{
-  bcd result = *this;
-
-  // Splitting position is 1 more than the exponent
-  // because of the implied first position
-  int position = m_exponent + 1;
-
-  for(int mantpos = 0;mantpos < bcdLength; ++mantpos)
-  {
-    if(position <= 0)
-    {
-      // Result after this position will be zero
-      result.m_mantissa[mantpos] = 0;
-    }
-    else if(position >= bcdDigits)
-    {
-      // Keep these numbers in the mantissa
-      position -= bcdDigits;
-    }
-    else
-    {
-      // Here we will split the bcdDigits somewhere in the middle
-      long base   = bcdBase / 10;
-      long number = result.m_mantissa[mantpos];
-
-      for(int pos = bcdDigits; pos > 0; --pos)
-      {
-        // Find next number
-        long num = number / base;
-        number  %= base;
-
-        // zero out ?
-        if(position <= 0)
-        {
-          result.m_mantissa[mantpos] -= (num * base);
-        }
-        // go to the next position
-        --position;
-        base /= 10;
-      }
-    }
-  }
-  return result;
-}
-
-// bcd::CompareMantissa
-// Description: Compare two mantissa
-// Technical:   returns the following values
-//              -1  p_value is bigger
-//              0   mantissa are equal
-//              1   this is is bigger
-int   
-bcd::CompareMantissa(const bcd& p_value) const
-{
-  // Now compare the mantissa
-  for(int ind = 0;ind < bcdLength; ++ind)
-  {
-    // Find the first position not equal to the other
-    if(m_mantissa[ind] != p_value.m_mantissa[ind])
-    {
-      // Result by comparing the mantissa positions
-      return (m_mantissa[ind] > p_value.m_mantissa[ind]) ? 1 : -1;
-    }
-  }
-  // Mantissa are equal
-  return 0;
-}
-
-#ifdef _DEBUG
-// Debug print of the mantissa
-XString
-bcd::DebugPrint(PTCHAR p_name)
-{
-  XString debug;
-
-  // Print the debug name
-  debug.Format(_T("%-14s "),p_name);
-
-  // Print the sign
-  debug.AppendFormat(_T("%c "),m_sign == Sign::Positive ? '+' : '-');
-
-  // Print the exponent
-  debug.AppendFormat(_T("E%+d "),m_exponent);
-
-  // Print the mantissa in special format
-  for(int ind = 0;ind < bcdLength; ++ind)
-  {
-    // Text "%08ld" dependent on bcdDigits
-    debug.AppendFormat(_T(" %08ld"),m_mantissa[ind]);
-  }
-  debug += _T("\n");
-
-  return debug;
-}
-#endif
-
-// bcd::Epsilon
-// Description: Stopping criterion for iterations
-// Technical:   Translates fraction to lowest decimal position
-//               10 -> 0.0000000000000000000000000000000000000010
-//                5 -> 0.0000000000000000000000000000000000000005
-bcd&
-bcd::Epsilon(long p_fraction) const
-{
-  // Calculate stop criterion epsilon
-  static bcd epsilon;
-  epsilon.m_mantissa[0] = p_fraction * bcdBase / 10;
-  epsilon.m_exponent    = 2 - bcdPrecision;
-  return epsilon;
-}
-
-// Calculate the precision and scale for a SQL_NUMERIC
-// Highly optimized version as we do this a lot when
-// streaming bcd numbers to the database
-void
-bcd::CalculatePrecisionAndScale(SQLCHAR& p_precision,SQLCHAR& p_scale) const
-{
-  // Default max values
-  p_precision = bcdDigits * bcdLength;
-  p_scale     = 0;
-
-  // Quick check on zero
-  if(IsZero())
-  {
-    p_precision = 1;
-    return;
-  }
-
-  int index;
-  // Find the first non-zero mantissa digit
-  for(index = bcdLength - 1;index >= 0; --index)
-  {
-    if(m_mantissa[index] == 0)
-    {
-      p_precision -= bcdDigits;
-    }
-    else break;
-  }
-  if(index < 0)
-  {
-    return;
-  }
-  // Find the number of digits in this mantissa
-  // Change this optimalization when changing bcdDigits or bcdLength !!
-  if(m_mantissa[index] % 10000)
-  {
-    // Lower half filled
-    if(m_mantissa[index] % 100)
-    {
-      // 7 or 8 digits
-      p_precision -= (m_mantissa[index] % 10) ? 0 : 1;
-    }
-    else
-    {
-      // 5 or 6 digits
-      p_precision -= (m_mantissa[index] % 1000) ? 2 : 3;
-    }
-  }
-  else
-  {
-    // Lower half is empty
-    if(m_mantissa[index] % 1000000)
-    {
-      // 3 or 4 digits
-      p_precision -= (m_mantissa[index] % 100000) ? 4 : 5;
-    }
-    else
-    {
-      // just two digits
-      p_precision -= (m_mantissa[index] % 10000000) ? 6 : 7;
-    }
-  }
-  // Final check on maximum precision
-  // Cannot exceed SQLNUM_MAX_PREC as otherwise 
-  // we **will** crash on certain RDBMS (MS SQL-Server)
-  if(p_precision > SQLNUM_MAX_PREC)
-  {
-    p_precision = SQLNUM_MAX_PREC;
-  }
-
-  // Now adjust the scale to accommodate precision and exponent
-  // m_exponent always below (-)SQLNUM_MAX_PREC, so this is safe
-  if(m_exponent < 0)
-  {
-    p_scale      = p_precision - (SQLCHAR) m_exponent - 1;
-    p_precision -= (SQLCHAR) m_exponent;
-  }
-  else
-  {
-    if((p_precision - 1) > (SQLCHAR) m_exponent)
-    {
-      p_scale = p_precision - (SQLCHAR) m_exponent - 1;
-    }
-    if(p_precision <= m_exponent)
-    {
-      p_precision = (SQLCHAR) m_exponent + 1;
-    }
-  }
-}
-
-//////////////////////////////////////////////////////////////////////////
-//
-// END OF INTERNALS OF BCD
-//
-//////////////////////////////////////////////////////////////////////////
-
-//////////////////////////////////////////////////////////////////////////
-//
-// BASIC OPERATIONS OF BCD
-//
-//////////////////////////////////////////////////////////////////////////
-
-// Addition operation
-bcd 
-bcd::Add(const bcd& p_number) const 
-{
-  // Check if we can add
-  if(!IsValid() || !p_number.IsValid())
-  {
-    return SetInfinity(_T("Cannot add to INFINITY"));
-  }
-  // NULL always yield a NULL
-  if(IsNULL() || p_number.IsNULL())
-  {
-    return bcd(Sign::ISNULL);
-  }
-  // See if we must do addition or subtraction
-  // Probably we need to swap the arguments....
-  // (+x) + (+y) -> Addition,    result positive, Do not swap
-  // (+x) + (-y) -> Subtraction, result pos/neg,  Possibly swap
-  // (-x) + (+y) -> Subtraction, result pos/neg,  Possibly swap
-  // (-x) + (-y) -> Addition,    result negative, Do not swap
-  Sign     signResult   = Sign::Positive;
-  Operator operatorKind = Operator::Addition;
-  bcd      arg1(*this);
-  bcd      arg2(p_number);
-  PositionArguments(arg1, arg2, signResult, operatorKind);
-
-  if (operatorKind == Operator::Addition)
-  {
-    arg1 = PositiveAddition(arg1, arg2);
-  }
-  else
-  {
-    if(arg1 > arg2)
-    {
-      arg1 = PositiveSubtraction(arg1, arg2);
-    }
-    else
-    {
-      arg1 = PositiveSubtraction(arg2, arg1);
-    }
-  }
-  arg1.m_sign = signResult;
-
-  return arg1;
-}
-
-// Subtraction operation
-bcd 
-bcd::Sub(const bcd& p_number) const 
-{
-  // Check if we can subtract
-  if(!IsValid() || !p_number.IsValid())
-  {
-    return SetInfinity(_T("Cannot subtract with INFINITY"));
-  }
-  // NULL always yield a NULL
-  if(IsNULL() || p_number.IsNULL())
-  {
-    return bcd(Sign::ISNULL);
-  }
-  // x-y is equal to  x+(-y)
-  return *this + (-p_number);
-}
-
-// Multiplication
-bcd 
-bcd::Mul(const bcd& p_number) const 
-{
-  // Check if we can multiply
-  if(!IsValid() || !p_number.IsValid())
-  {
-    return SetInfinity(_T("Cannot multiply with INFINITY"));
-  }
-  // NULL always yield a NULL
-  if(IsNULL() || p_number.IsNULL())
-  {
-    return bcd(Sign::ISNULL);
-  }
-  // Multiplication without signs
-  bcd result = PositiveMultiplication(*this,p_number);
-
-  // Take care of the sign
-  result.m_sign = result.IsZero() ? Sign::Positive : CalculateSign(*this, p_number);
-
-  return result;
-}
-
-// Division
-bcd 
-bcd::Div(const bcd& p_number) const 
-{
-  // Check if we can divide
-  if(!IsValid() || !p_number.IsValid())
-  {
-    return SetInfinity(_T("Cannot divide with INFINITY"));
-  }
-  // NULL always yield a NULL
-  if(IsNULL() || p_number.IsNULL())
-  {
-    return bcd(Sign::ISNULL);
-  }
-  // If divisor is zero -> ERROR
-  if(p_number.IsZero())
-  {
-    return SetInfinity(_T("BCD: Division by zero."));
-  }
-  // Shortcut: result is zero if this is zero
-  if(IsZero())
-  {
-    return *this;
-  }
-  // Division without signs
-  bcd arg1(*this);
-  bcd arg2(p_number);
-  bcd result = PositiveDivision(arg1,arg2);
-
-  // Take care of the sign
-  result.m_sign = result.IsZero() ? Sign::Positive : CalculateSign(*this, p_number);
-
-  return result;
-}
-
-// Modulo
-bcd 
-bcd::Mod(const bcd& p_number) const 
-{
-  // Check if we can do a modulo
-  if(!IsValid() || !p_number.IsValid())
-  {
-    return SetInfinity(_T("Cannot do a modulo with INFINITY"));
-  }
-  // NULL always yield a NULL
-  if(IsNULL() || p_number.IsNULL())
-  {
-    return bcd(Sign::ISNULL);
-  }
-  bcd count = ((*this) / p_number).Floor();
-  bcd mod((*this) - (count * p_number));
-
-  if (m_sign == Sign::Negative)
-  {
-    mod = -mod;
-  }
-  return mod;
-}
-
-// Position the arguments for a positive addition or subtraction
-// Only called from within Add()
-void
-bcd::PositionArguments(bcd&       arg1,
-                       bcd&       arg2,
-                       Sign&      signResult,
-                       Operator&  operatorKind) const
-{
-  // Get the resulting kind of operator and sign
-  // if (-x) + y then turnaround, so x + (-y), becomes x - y
-  if (arg1.m_sign == Sign::Positive)
-  {
-    if(arg2.m_sign == Sign::Positive)
-    {
-      // Both are positive
-      signResult   = Sign::Positive;
-      operatorKind = Operator::Addition;
-    }
-    else
-    {
-      // Arg2 is negative
-      // Now the rest is positive
-      arg1.m_sign  = Sign::Positive;
-      arg2.m_sign  = Sign::Positive;
-      operatorKind = Operator::Subtraction;
-      // Sign depends on the size
-      signResult   = (arg1 >= arg2) ? Sign::Positive : Sign::Negative;
-    }
-  }
-  else // arg1.m_sign == Negative
-  {
-    if(arg2.m_sign == Sign::Negative)
-    {
-      // Both are negative
-      arg1.m_sign  = Sign::Positive;
-      arg2.m_sign  = Sign::Positive;
-      signResult   = Sign::Negative;
-      operatorKind = Operator::Addition;
-    }
-    else
-    {
-      // arg2 is positive
-      // Now the rest is positive
-      arg1.m_sign = Sign::Positive;
-      arg2.m_sign = Sign::Positive;
-      operatorKind = Operator::Subtraction;
-      // Sign depends on the size
-      signResult  = (arg2 >= arg1) ? Sign::Positive : Sign::Negative;
-    }
-  }
-}
-
-bcd::Sign
-bcd::CalculateSign(const bcd& p_arg1, const bcd& p_arg2) const
-{
-  // Find the sign for multiplication / division
-  // (+x) * (+y) -> positive
-  // (-x) * (+y) -> negative
-  // (-x) * (-y) -> positive
-  // (+x) * (-y) -> negative
-  if (p_arg1.IsZero() || p_arg2.IsZero())
-  {
-    return Sign::Positive;
-  }
-  if(p_arg1.m_sign != p_arg2.m_sign)
-  {
-    return Sign::Negative;
-  }
-  return Sign::Positive;
-}
-
-// Addition of two mantissa (no signs/exponents)
-bcd
-bcd::PositiveAddition(bcd& arg1,bcd& arg2) const
-{
-  // Take care of the exponents
-  if(arg1.m_exponent != arg2.m_exponent)
-  {
-    // If numbers differ more than this, an addition is useless
-    int border = bcdDigits * bcdLength;
-
-    if(arg1.m_exponent > arg2.m_exponent)
-    {
-      int shift = arg1.m_exponent - arg2.m_exponent;
-      if(shift > border)
-      {
-        // Adding arg2 will not result in a difference
-        return arg1;
-      }
-      // Shift arg2 to the right;
-      arg2.Div10(shift);
-    }
-    else
-    {
-      int shift = arg2.m_exponent - arg1.m_exponent;
-      if(shift > border)
-      {
-        // Adding arg1 will not result in a difference
-        return arg2;
-      }
-      // Shift arg1 to the right
-      arg1.Div10(shift);
-      arg1.m_exponent += (short) shift;
-    }
-  }
-  // Do the addition of the mantissa
-  int64 carry = 0L;
-  for(int ind = bcdLength - 1;ind >= 0; --ind)
-  {
-    int64 reg = ((int64)arg1.m_mantissa[ind]) + ((int64)arg2.m_mantissa[ind]) + carry;
-    carry = reg / bcdBase;
-    arg1.m_mantissa[ind] = reg % bcdBase;
-  }
-  // Take care of carry
-  if(carry)
-  {
-    arg1.Div10();
-    arg2.Div10();
-    arg1.m_exponent++;
-    arg1.m_mantissa[0] += (long)(carry * (bcdBase / 10));
-  }
-  return arg1;
-}
-
-// Subtraction of two mantissa (no signs/exponents)
-// Precondition arg1 > arg2
-bcd
-bcd::PositiveSubtraction(bcd& arg1,bcd& arg2) const
-{
-  // Take care of the exponents
-  if(arg1.m_exponent != arg2.m_exponent)
-  {
-    // If numbers differ more than this, an addition is useless
-    int border = bcdDigits * bcdLength;
-
-    int shift = arg1.m_exponent - arg2.m_exponent;
-    if(shift > border)
-    {
-      // Adding arg2 will not result in a difference
-      return arg1;
-    }
-    if (shift > 0)
-    {
-      // Shift arg2 to the right;
-      arg2.Div10(shift);
-    }
-    else
-    {
-      arg2.Mult10(-shift);
-    }
-  }
-  // Do the subtraction of the mantissa
-  for(int ind = bcdLength - 1;ind >= 0; --ind)
-  {
-    if(arg1.m_mantissa[ind] >= arg2.m_mantissa[ind])
-    {
-      arg1.m_mantissa[ind] -= arg2.m_mantissa[ind];
-    }
-    else
-    {
-      int64 reg = ((int64)bcdBase + arg1.m_mantissa[ind]) - arg2.m_mantissa[ind];
-      arg1.m_mantissa[ind] = (long) reg;
-      // Take care of carry
-      if(ind > 0)
-      {
-        arg1.m_mantissa[ind - 1] -= 1;
-      }
-    }
-  }
-  // Normalize the mantissa/exponent
-  arg1.Normalize();
-
-  // Return the result
-  return arg1;
-}
-
-// bcd::PositiveMultiplication
-// Description: Multiplication of two mantissa (no signs)
-// Technical:   1) addition of the exponents
-//              2) multiplication of the mantissa
-//              3) take-in carry and normalize
-bcd
-bcd::PositiveMultiplication(const bcd& p_arg1,const bcd& p_arg2) const
-{
-  bcd result;
-  int64 res[2 * bcdLength] = { 0 };
-
-  // Multiplication of the mantissa
-  for(int i = bcdLength - 1; i >= 0; --i)
-  {
-    for(int j = bcdLength - 1; j >= 0; --j)
-    {
-      int64 between = (int64)p_arg1.m_mantissa[i] * (int64)p_arg2.m_mantissa[j];
-      res[i + j + 1] += between % bcdBase; // result
-      res[i + j    ] += between / bcdBase; // carry
-    }
-  }
-
-  // Normalize resulting mantissa to bcdBase
-  int64 carry   = 0;
-  for(int ind = (2 * bcdLength) - 1;ind >= 0; --ind)
-  {
-    res[ind] += carry;
-    carry     = res[ind] / bcdBase;
-    res[ind] %= bcdBase;
-  }
-
-  // Possibly perform rounding of res[bcdLength] -> res[bcdLength-1]
-
-  // Put the resulting mantissa's in the result
-  for(int ind = 0; ind < bcdLength; ++ind)
-  {
-    result.m_mantissa[ind] = (long)res[ind];
-  }
-
-  // Take care of exponents
-  // Multiplication is the addition of the exponents
-  // Add 1 for the implied 1 position of the second argument
-  result.m_exponent = p_arg1.m_exponent + p_arg2.m_exponent + 1;
-
-  // Normalize to implied dec.point position
-  result.Normalize();
-
-  return result;
-}
-
-// bcd::PositiveDivision
-// Description: Division of two mantissa (no signs)
-// Technical:   Do traditional 'long division' of two bcd's
-bcd
-bcd::PositiveDivision(bcd& p_arg1,bcd& p_arg2) const
-{
-  bcd   result;
-  short result_mantissa[bcdPrecision + 1] = { 0 };
-  bcd   subtrahend;
-
-  // Division of the mantissa
-  long dividend  = 0;
-  long divisor   = 0; 
-  long quotient  = 0;
-  int  guess     = 2;
-
-  // Grade down arg2 one position
-  p_arg2.Div10();
-
-  for(int ind = 1;ind <= bcdPrecision; ++ind)
-  {
-//     printf("Iteration: %d\n",ind);
-//     p_arg1.DebugPrint("argument1");
-//     p_arg2.DebugPrint("argument2");
-
-    // Check for intermediate of zero. Arg1 != zero, so it must end!!
-    bool zero = true;
-    for(int x = 0;x < bcdLength; ++x)
-    {
-      if(p_arg1.m_mantissa[x]) 
-      {
-        zero = false;
-        break;
-      }
-    }
-    // arg1 has become zero. Nothing more to do
-    if(zero)
-    {
-      break;
-    }
-    // If not at implied position: Mantissa can shift 1 position up
-    if((p_arg1.m_mantissa[0] * 10 / bcdBase) == 0)
-    {
-      p_arg1.Mult10();
-
-      // If still not at implied position, we may do an extra shifts 
-      // inserting zero's in the result if there are more
-      if((p_arg1.m_mantissa[0] * 10 / bcdBase) == 0)
-      {
-        do
-        {
-          result_mantissa[ind++] = 0;
-          p_arg1.Mult10();
-          if(ind > bcdPrecision)
-          {
-            // Escape from double loop (for/while)
-            goto end;
-          }
-        }
-        while((p_arg1.m_mantissa[0] * 10 / bcdBase) == 0);
-      }
-    }
-
-//     // Resulting mantissa's 
-//     p_arg1.DebugPrint("argument1-2");
-//     p_arg2.DebugPrint("argument2-2");
-
-    // get quotient
-    dividend = p_arg1.m_mantissa[0];
-    divisor  = p_arg2.m_mantissa[0];
-    quotient = dividend / divisor;
-
-    // Try to get a subtrahend
-    // Could go wrong because the total of quotient * arg2.mantissa can be > than arg1.mantissa
-    guess = 2;
-    while(guess--)
-    {
-      // quotient * p_arg2 -> subtrahend
-      int64 carry  = 0;
-      for(int pos = bcdLength - 1; pos >= 0; --pos)
-      {
-        int64 number = (int64)quotient * (int64)p_arg2.m_mantissa[pos] + carry;
-        subtrahend.m_mantissa[pos] = number % bcdBase;
-        carry = number / bcdBase;
-      }
-//    // Effective subtrahend
-//    subtrahend.DebugPrint("subtrahend");
-
-      // if(p_arg1 < subtrahend)
-      if(p_arg1.CompareMantissa(subtrahend) == -1)
-      {
-        --quotient;
-      }
-      else
-      {
-        // Effective quotient found for this 'ind' step
-//      printf("%02d quotient: %d\n",ind,quotient);
-
-        // Ready guessing: quotient is OK
-        guess = 0;
-        result_mantissa[ind] = (short)quotient;
-        // arg1 = arg1 - subtrahend
-        for(int pos = bcdLength - 1;pos >= 0; --pos)
-        {
-          if(p_arg1.m_mantissa[pos] >= subtrahend.m_mantissa[pos])
-          {
-            p_arg1.m_mantissa[pos] -= subtrahend.m_mantissa[pos];
-          }
-          else
-          {
-            int64 number = ((int64)bcdBase + p_arg1.m_mantissa[pos]) - subtrahend.m_mantissa[pos];
-            p_arg1.m_mantissa[pos] = (long)number;
-            if(pos > 0)
-            {
-              // Do the borrow
-              p_arg1.m_mantissa[pos - 1] -= 1;
-            }
-          }
-        }
-      }
-//    // Effective difference (minuend - subtrahend)
-//    p_arg1.DebugPrint("argument1-3");
-    }
-  }
-end:
-  // Normalize result
-  short carry = 0;
-  for(int i = bcdPrecision; i > 0; --i)
-  {
-    result_mantissa[i] += carry;
-    carry               = result_mantissa[i] / 10;
-    result_mantissa[i] %= 10;
-  }
-  result_mantissa[0] = carry;
-
-  // Get starting position of the answer
-  int respos = (carry == 0) ? 1 : 0;
-
-  // Set the result_mantissa in the result number
-  for(int mantpos = 0;mantpos < bcdLength; ++mantpos)
-  {
-    long number = 0;
-    long base   = bcdBase / 10;
-
-    for(int ind = 0; ind < bcdDigits; ++ind)
-    {
-      number += result_mantissa[respos++] * base;
-      base   /= 10;
-    }
-    result.m_mantissa[mantpos] = number;
-  }
-
-  // Subtraction of the exponents
-  // Subtract 1 for initial Div10 of the second argument
-  result.m_exponent = p_arg1.m_exponent - p_arg2.m_exponent - 1;
-
-  // If we had a carry, the exponent will be 1 higher
-  if(carry)
-  {
-    result.m_exponent++;
-  }
-
-  // Return the result
-  return result;
-}
-
-// On overflow we set negative or positive infinity
-bcd
-bcd::SetInfinity(XString p_reason /*= ""*/) const
-{
-  if(g_throwing)
-  {
-    throw StdException(p_reason);
-  }
-  // NaN AND previous infinity is set to positive infinity !!
-  bcd inf;
-  inf.m_sign = (m_sign == Sign::Negative) ? Sign::MIN_INF : Sign::INF;
-  return inf;
-}
-
-//////////////////////////////////////////////////////////////////////////
-//
-// END OF BASIC OPERATIONS OF BCD
-//
-//////////////////////////////////////////////////////////////////////////
-
-//////////////////////////////////////////////////////////////////////////
-//
-// OVERLOADED MATH FUNCTIONS (Everybody has come to expect)
-//
-//////////////////////////////////////////////////////////////////////////
-
-// Overloaded math precision floating point functions equivalent with the std C functions
-// Overloaded to work with the BCD number class, always yielding a bcd number.
-
-bcd modf(const bcd& p_number, bcd* p_intpart)
-{
-  *p_intpart = p_number.Floor();
-  return p_number.Fraction();
-}
-
-bcd fmod(const bcd& p_number,const bcd& p_divisor)
-{
-  return p_number % p_divisor;
-}
-
-bcd floor(const bcd& p_number)
-{
-  return p_number.Floor();
-}
-
-bcd ceil(const bcd& p_number)
-{
-  return p_number.Ceiling();
-}
-
-bcd fabs(const bcd& p_number)
-{
-  return p_number.AbsoluteValue();
-}
-
-bcd sqrt(const bcd& p_number)
-{
-  return p_number.SquareRoot();
-}
-
-bcd log10(const bcd& p_number)
-{
-  return p_number.Log10();
-}
-
-bcd log(const bcd& p_number)
-{
-  return p_number.Log();
-}
-
-bcd exp(const bcd& p_number)
-{
-  return p_number.Exp();
-}
-
-bcd pow(const bcd& p_number,const bcd& p_power)
-{
-  return p_number.Power(p_power);
-}
-
-bcd frexp(const bcd& p_number,int* p_exponent)
-{
-  *p_exponent = p_number.GetExponent();
-  return p_number.GetMantissa();
-}
-
-bcd ldexp(const bcd& p_number,int p_power)
-{
-  if(p_power == 0)
-  {
-    return p_number;
-  }
-  if(p_power > 0 && p_power <= 31)
-  {
-    return p_number * bcd((long) (((unsigned)1) << p_power));
-  }
-  return p_number * pow(bcd(2L),bcd((long)p_power));
-}
-
-// Overloaded trigonometric functions on a bcd number
-
-bcd atan (const bcd& p_number) 
-{ 
-  return p_number.ArcTangent(); 
-}
-
-bcd atan2(const bcd& p_y,const bcd& p_x)
-{
-  return p_y.ArcTangent2Points(p_x);
-}
-
-bcd asin(const bcd& p_number)
-{
-  return p_number.ArcSine();
-}
-
-bcd acos(const bcd& p_number)
-{
-  return p_number.ArcCosine();
-}
-
-bcd sin(const bcd& p_number)
-{
-  return p_number.Sine();
-}
-
-bcd cos(const bcd& p_number)
-{
-  return p_number.Cosine();
-}
-
-bcd tan(const bcd& p_number)
-{
-  return p_number.Tangent();
-}
-
-//////////////////////////////////////////////////////////////////////////
-//
-// END OF OVERLOADED MATH FUNCTIONS
-//
-//////////////////////////////////////////////////////////////////////////
-
-//////////////////////////////////////////////////////////////////////////
-//
-// FILE STREAM FUNCTIONS
-// Used for binary storage in a binary-mode file stream!
-//
-//////////////////////////////////////////////////////////////////////////
-
-bool
-bcd::WriteToFile (FILE* p_fp)
-{
-  // Write out the sign
-  if(putc((char)m_sign,p_fp)      == EOF) return false;
-  // Write out the exponent (little endian)
-  if(putc(m_exponent >> 8,  p_fp) == EOF) return false;
-  if(putc(m_exponent & 0xFF,p_fp) == EOF) return false;
-  // Write out the mantissa (little endian)
-  for(unsigned int ind = 0;ind < bcdLength; ++ind)
-  {
-    ulong num = (ulong) m_mantissa[ind];
-    if(putc((num & 0xFF000000) >> 24,p_fp) == EOF) return false;
-    if(putc((num & 0x00FF0000) >> 16,p_fp) == EOF) return false;
-    if(putc((num & 0x0000FF00) >>  8,p_fp) == EOF) return false;
-    if(putc((num & 0x000000FF)      ,p_fp) == EOF) return false;
-  }
-  return true;
-}
-
-bool
-bcd::ReadFromFile(FILE* p_fp)
-{
-  int ch = 0;
-
-  // Read in the sign
-  m_sign = (Sign) getc(p_fp);
-  // Read in the exponent
-  ch = getc(p_fp);
-  m_exponent = (short) (ch << 8);
-  ch = getc(p_fp);
-  m_exponent += (short) ch;
-
-  // Read in the mantissa
-  for(unsigned int ind = 0; ind < bcdLength; ++ind)
-  {
-    ulong num = 0L;
-    ch = getc(p_fp); num += ((ulong)ch) << 24;
-    ch = getc(p_fp); num += ((ulong)ch) << 16;
-    ch = getc(p_fp); num += ((ulong)ch) <<  8;
-    ch = getc(p_fp); num +=  (ulong)ch;
-    m_mantissa[ind] = num;
-  }
-
-  // BCD is invalid in case of file error
-  if(ferror(p_fp))
-  {
-    Zero();
-    return false;
-  }
-  return true;
-}
-
-//////////////////////////////////////////////////////////////////////////
-//
-// END OF FILE STREAM FUNCTIONS
-//
-//////////////////////////////////////////////////////////////////////////
-
-//////////////////////////////////////////////////////////////////////////
-//
-// END OF BCD IMPLEMENTATION
-//
-//////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////
+//
+// SourceFile: bcd.cpp
+//
+// Copyright (c) 2014-2025 ir. W.E. Huisman
+// All rights reserved
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////
+//
+//  BCD
+// 
+//  Floating Point Precision Number class (Binary Coded Decimal)
+//  An Arbitrary float always has the format [sign][digit][.[digit]*][E[sign][digits]+] 
+//  where sign is either '+' or '-' or is missing ('+' implied)
+//  And is always stored in normalized mode after an operation or conversion
+//  with an implied decimal point between the first and second position
+//
+// Copyright (c) 2014-2022 ir W. E. Huisman
+// Version 1.5 of 03-01-2022
+//
+//  Examples:
+//  E+03 15456712 45000000 00000000 -> 1545.671245
+//  E+01 34125600 00000000 00000000 -> 3.41256
+//  E-05 78976543 12388770 00000000 -> 0.0000789765431238877
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "stdafx.h"         // Precompiled headers
+#include "bcd.h"            // OUR INTERFACE
+#include "StdException.h"   // Exceptions
+#include <math.h>           // Still needed for conversions of double
+#include <float.h>          // DBL_MAX for the comparisons with a double
+#include <stdio.h>          // snprintf/strtod for the conversion of a double
+#include <stdlib.h>
+#include <locale.h>
+#include <winnls.h>
+#include <thread>           // Bulk conversions on several threads
+#include <system_error>     // A thread that cannot be started
+#ifdef _M_X64
+#include <intrin.h>         // __umulh for the multiplication kernel
+#endif
+
+#ifdef _AFX
+#ifdef _DEBUG
+#define new DEBUG_NEW
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#endif
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+//
+// THE NUMERIC CONTEXT
+//
+//////////////////////////////////////////////////////////////////////////
+
+bcd_context::bcd_context()
+{
+  InitLocale();
+}
+
+// bcd_context::Current
+// Description: The context of the current thread
+// Technical:   Created on first use by each thread, so no locking is needed
+bcd_context&
+bcd_context::Current()
+{
+  static thread_local bcd_context context;
+  return context;
+}
+
+// Initialization for printing numbers in the current locale
+void
+bcd_context::InitLocale()
+{
+  GetLocaleInfo(LOCALE_USER_DEFAULT, LOCALE_SDECIMAL,  m_decimalSep, bcdSeparatorLength);
+  GetLocaleInfo(LOCALE_USER_DEFAULT, LOCALE_STHOUSAND, m_thousandSep,bcdSeparatorLength);
+  GetLocaleInfo(LOCALE_USER_DEFAULT, LOCALE_SCURRENCY, m_strCurrency,bcdSeparatorLength);
+  m_decimalSepLen  = (int)_tclen(m_decimalSep);
+  m_thousandSepLen = (int)_tclen(m_thousandSep);
+  m_strCurrencyLen = (int)_tclen(m_strCurrency);
+}
+
+// Re-read the locale for printing numbers on the current thread
+void 
+InitValutaString()
+{
+  bcd_context::Current().InitLocale();
+}
+
+// Upper 64 bits of the 128 bits product of two unsigned 64 bits numbers
+static inline uint64
+MultiplyHigh(const uint64 p_one,const uint64 p_two)
+{
+#ifdef _M_X64
+  return __umulh(p_one,p_two);
+#else
+  uint64 oneLow  = p_one & 0xFFFFFFFFULL;
+  uint64 oneHigh = p_one >> 32;
+  uint64 twoLow  = p_two & 0xFFFFFFFFULL;
+  uint64 twoHigh = p_two >> 32;
+
+  uint64 lowlow  = oneLow  * twoLow;
+  uint64 lowhigh = oneLow  * twoHigh;
+  uint64 highlow = oneHigh * twoLow;
+  uint64 middle  = (lowlow >> 32) + (lowhigh & 0xFFFFFFFFULL) + (highlow & 0xFFFFFFFFULL);
+
+  return oneHigh * twoHigh + (lowhigh >> 32) + (highlow >> 32) + (middle >> 32);
+#endif
+}
+
+// Division by bcdBase without a hardware division
+// Multiply by the reciprocal 2^90 / bcdBase (rounded up) and shift back.
+// The rounding error of the reciprocal is small enough (< 2^26)
+// for the quotient to be exact over the full range of 64 bits.
+static inline uint64
+DivideByBase(const uint64 p_number)
+{
+  return MultiplyHigh(p_number,0xABCC77118461CEFDULL) >> 26;
+}
+
+// Multiply-accumulate on a 128 bits unsigned integer in two 64 bits words
+// (p_high,p_low) = (p_high,p_low) * p_factor + p_add, modulo 2^128
+static inline void
+MultiplyAdd128(uint64& p_high,uint64& p_low,const uint64 p_factor,const uint64 p_add)
+{
+  uint64 high = p_high * p_factor + MultiplyHigh(p_low,p_factor);
+  uint64 low  = p_low  * p_factor;
+  p_low  = low + p_add;
+  p_high = high + (p_low < low ? 1 : 0);
+}
+
+// Division of a 128 bits unsigned integer in two 64 bits words by bcdBase
+// In four steps of 32 bits. The remainder stays below bcdBase, so every
+// step stays within 64 bits. Returns the remainder.
+static inline uint64
+DivideByBase128(uint64& p_high,uint64& p_low)
+{
+  uint64 words[4] = { p_high >> 32, p_high & 0xFFFFFFFFULL, p_low >> 32, p_low & 0xFFFFFFFFULL };
+  uint64 remainder = 0;
+  for(int ind = 0; ind < 4; ++ind)
+  {
+    uint64 number = (remainder << 32) | words[ind];
+    words[ind] = DivideByBase(number);
+    remainder  = number - words[ind] * bcdBase;
+  }
+  p_high = (words[0] << 32) | words[1];
+  p_low  = (words[2] << 32) | words[3];
+  return remainder;
+}
+
+// Minimum number of values for one thread of a bulk conversion
+// Below this, starting a thread costs more than it saves
+const size_t bcdBulkChunk = 4096;
+
+// Maximum number of threads (and chunks) of a bulk operation
+const size_t bcdBulkThreads = 64;
+
+// Run a bulk operation on p_count values in chunks on several threads
+// p_work(chunk,begin,end) does one chunk and returns its number of failures.
+// With p_threads the number of chunks is fixed, otherwise it follows the hardware.
+// The chunks never throw. Their status flags are merged into the context
+// of the calling thread. Returns the total number of failures.
+template<typename Work>
+static size_t
+BulkChunks(size_t p_count,size_t p_threads,Work p_work)
+{
+  bcd_context& caller = bcd_context::Current();
+
+  // One chunk on the calling thread, the others on extra threads
+  auto chunk = [&](size_t p_chunk,size_t p_begin,size_t p_end,unsigned& p_status,size_t& p_failed)
+  {
+    bcd_context& context  = bcd_context::Current();
+    bool         mode     = context.m_throwing;
+    unsigned     status   = context.m_status;
+    context.m_throwing = false;
+    context.ClearStatus();
+    p_failed = p_work(p_chunk,p_begin,p_end);
+    p_status = context.m_status;
+    context.m_throwing = mode;
+    context.m_status   = status;
+  };
+
+  size_t threads = p_threads ? min(p_threads,p_count)
+                             : min((size_t)std::thread::hardware_concurrency(),p_count / bcdBulkChunk);
+  threads = max(min(threads,bcdBulkThreads),(size_t)1);
+
+  std::thread workers [bcdBulkThreads];
+  unsigned    statuses[bcdBulkThreads] = { 0 };
+  size_t      failures[bcdBulkThreads] = { 0 };
+  size_t      size    = p_count / threads;
+  size_t      started = threads;
+  auto begin = [&](size_t p_chunk) { return p_chunk * size; };
+  auto end   = [&](size_t p_chunk) { return (p_chunk == threads - 1) ? p_count : (p_chunk + 1) * size; };
+  for(size_t ind = 1; ind < threads; ++ind)
+  {
+    try
+    {
+      workers[ind] = std::thread(chunk,ind,begin(ind),end(ind),std::ref(statuses[ind]),std::ref(failures[ind]));
+    }
+    catch(std::system_error&)
+    {
+      // No more threads: the other chunks run on the calling thread
+      started = ind;
+      break;
+    }
+  }
+  chunk(0,begin(0),end(0),statuses[0],failures[0]);
+  for(size_t ind = started; ind < threads; ++ind)
+  {
+    chunk(ind,begin(ind),end(ind),statuses[ind],failures[ind]);
+  }
+
+  size_t failed = 0;
+  for(size_t ind = 0; ind < threads; ++ind)
+  {
+    if(workers[ind].joinable())
+    {
+      workers[ind].join();
+    }
+    caller.RaiseStatus(statuses[ind]);
+    failed += failures[ind];
+  }
+  return failed;
+}
+
+// Run a bulk conversion of p_count values in chunks on several threads
+// p_convert(begin,end) converts one chunk and returns its number of failures.
+template<typename Convert>
+static size_t
+BulkConversion(size_t p_count,Convert p_convert)
+{
+  return BulkChunks(p_count,0,[&](size_t /*p_chunk*/,size_t p_begin,size_t p_end)
+  {
+    return p_convert(p_begin,p_end);
+  });
+}
+
+// Two ASCII digits for every number 0..99
+static const char g_digitPairs[] =
+  "00010203040506070809"
+  "10111213141516171819"
+  "20212223242526272829"
+  "30313233343536373839"
+  "40414243444546474849"
+  "50515253545556575859"
+  "60616263646566676869"
+  "70717273747576777879"
+  "80818283848586878889"
+  "90919293949596979899";
+
+// Write one mantissa limb as exactly bcdDigits ASCII digits
+// Two digits at a time from the table, so only three divisions per limb
+static inline void
+LimbToChars(const long p_limb,char* p_buffer)
+{
+  long high = p_limb / 10000;
+  long low  = p_limb % 10000;
+  const char* pair = &g_digitPairs[2 * (high / 100)];
+  p_buffer[0] = pair[0];
+  p_buffer[1] = pair[1];
+  pair = &g_digitPairs[2 * (high % 100)];
+  p_buffer[2] = pair[0];
+  p_buffer[3] = pair[1];
+  pair = &g_digitPairs[2 * (low / 100)];
+  p_buffer[4] = pair[0];
+  p_buffer[5] = pair[1];
+  pair = &g_digitPairs[2 * (low % 100)];
+  p_buffer[6] = pair[0];
+  p_buffer[7] = pair[1];
+}
+
+// Powers of 10 for the digit positions in a mantissa limb
+static const long g_limbPowers[bcdDigits] =
+{
+  10000000L, 1000000L, 100000L, 10000L, 1000L, 100L, 10L, 1L
+};
+
+// Powers of 10 that fit in 64 bits, for the comparisons with an integer
+static const uint64 g_intPowers[20] =
+{
+  1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL,
+  1000000000ULL, 10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL,
+  100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL, 100000000000000000ULL,
+  1000000000000000000ULL, 10000000000000000000ULL
+};
+
+// Cache of the strings in the comparisons: number of entries per thread,
+// and the maximum length of a string in the cache
+static const int stringCacheEntries = 16;
+static const int stringCacheLength  = 48;
+
+// Tables of the reduction of Exp: exp(j / steps) for j in the range
+// -expTableReach to +expTableReach (a bit over ln(10) / 2 in the first table).
+// The second table divides one step of the first table in 64 steps
+static const int expTableLevels = 2;
+static const int expTableSteps[expTableLevels] = { 32, 32 * 64 };
+static const int expTableReach  = 40;
+
+// Tables of the reduction of Log: ln(1 + j / steps) for j in the range
+// -reach to +reach. After the powers of ten and two a number is between 0.7
+// and 1.42. The second table divides one step of the first table in 64 steps
+// Every level has room for the widest reach
+static const int logTableLevels = 2;
+static const int logTableSteps[logTableLevels] = { 32, 32 * 64 };
+static const int logTableReach[logTableLevels] = { 16, 64 };
+static const int logTableRoom = 64;
+
+// Check if eight characters (read as one 64 bits word) are all ASCII digits
+// Adding 6 pushes the characters beyond '9' out of the 0x3X range
+static inline bool
+IsEightDigits(const uint64 p_chars)
+{
+  return ((p_chars & 0xF0F0F0F0F0F0F0F0ULL) |
+         (((p_chars + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) == 0x3333333333333333ULL;
+}
+
+// Convert eight ASCII digits (read as one 64 bits word) to one mantissa limb
+// SWAR: combine the digits to pairs, then the pairs to one number in two multiplications.
+// The word is read little endian, so the first character is in the lowest byte.
+static inline long
+EightDigitsToLimb(uint64 p_chars)
+{
+  p_chars -= 0x3030303030303030ULL;
+  p_chars  = (p_chars * 10) + (p_chars >> 8);
+  p_chars  = (((p_chars & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32))) +
+             (((p_chars >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))) >> 32;
+  return (long)(p_chars & 0xFFFFFFFFULL);
+}
+
+// Number of limbs from where the multiplication splits the mantissa (Karatsuba)
+// Measured on x64 the schoolbook loop of column sums is faster up to about
+// 40 limbs (320 digits). So a bcd200 (25 limbs) still multiplies schoolbook.
+// Define a lower number to test or use the Karatsuba path.
+#ifndef BCD_KARATSUBA_LIMBS
+#define BCD_KARATSUBA_LIMBS 40
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+//
+// CONSTRUCTORS OF BCD
+//
+//////////////////////////////////////////////////////////////////////////
+
+// bcd::bcd
+// Description: Default constructor
+// Technical:   Initialize the number at zero (0)
+template<int Limbs>
+basic_bcd<Limbs>::basic_bcd()
+{
+  Zero();
+}
+
+// bcd::bcd(bcd& arg)
+// Description: Copy constructor of a bcd
+// Technical:   Copies all data members
+template<int Limbs>
+basic_bcd<Limbs>::basic_bcd(const basic_bcd& p_arg)
+{
+  m_sign      = p_arg.m_sign;
+  m_exponent  = p_arg.m_exponent;
+  // Create and copy mantissa
+  memcpy(m_mantissa,p_arg.m_mantissa,bcdLength * sizeof(long));
+}
+
+// bcd::bcd(value)
+// Description: BCD from a char value
+template<int Limbs>
+basic_bcd<Limbs>::basic_bcd(const TCHAR p_value)
+{
+  SetValueInt((int)p_value);
+}
+
+#ifndef UNICODE
+// bcd::bcd(value)
+// Description: BCD from an unsigned char value
+template<int Limbs>
+basic_bcd<Limbs>::basic_bcd(const _TUCHAR p_value)
+{
+  SetValueInt((int)p_value);
+}
+#endif
+
+// bcd::bcd(value)
+// Description: BCD from a short value
+// 
+template<int Limbs>
+basic_bcd<Limbs>::basic_bcd(const short p_value)
+{
+  SetValueInt((int)p_value);
+}
+
+// bcd::bcd(value)
+// Description: BCD from an unsigned short value
+//
+template<int Limbs>
+basic_bcd<Limbs>::basic_bcd(const unsigned short p_value)
+{
+  SetValueInt((int)p_value);
+}
+
+// bcd::bcd(value)
+// BCD from an integer
+template<int Limbs>
+basic_bcd<Limbs>::basic_bcd(const int p_value)
+{
+  SetValueInt(p_value);
+}
+
+// bcd::bcd(value)
+// BCD from an unsigned integer
+template<int Limbs>
+basic_bcd<Limbs>::basic_bcd(const unsigned int p_value)
+{
+  SetValueInt64((int64)p_value,0);
+}
+
+// bcd::bcd(value,value)
+// Description: Construct a BCD from a long and an option long
+// Technical:   See description of SetValueLong
+//
+template<int Limbs>
+basic_bcd<Limbs>::basic_bcd(const long p_value, const long p_restValue /*= 0*/)
+{
+  SetValueLong(p_value,p_restValue);
+}
+
+// bcd::bcd(value,value)
+// Description: Construct a BCD from an unsigned long and an unsigned optional long
+// Technical:   See description of SetValueLong
+template<int Limbs>
+basic_bcd<Limbs>::basic_bcd(const unsigned long p_value, const unsigned long p_restValue /*= 0*/)
+{
+  SetValueInt64((int64)p_value,(int64)p_restValue);
+}
+
+// bcd::bcd(value,value)
+// Description: Construct a BCD from a 64bit long and an optional long
+// Technical:   See description of SetValueInt64
+//
+template<int Limbs>
+basic_bcd<Limbs>::basic_bcd(const int64 p_value,const int64 p_restvalue /*= 0*/)
+{
+  SetValueInt64(p_value,p_restvalue);
+}
+
+template<int Limbs>
+basic_bcd<Limbs>::basic_bcd(const uint64 p_value,const int64 p_restvalue)
+{
+  SetValueUInt64(p_value,p_restvalue);
+}
+
+// bcd::bcd(float)
+// Description: Construct a bcd from a float
+// 
+template<int Limbs>
+basic_bcd<Limbs>::basic_bcd(const float p_value)
+{
+  SetValueDouble((double)p_value);
+}
+
+// bcd::bcd(double)
+// Description: Construct a bcd from a double
+// 
+template<int Limbs>
+basic_bcd<Limbs>::basic_bcd(const double p_value)
+{
+  SetValueDouble(p_value);
+}
+
+// BCD From a character string
+// Description: Assignment-constructor from an elementary character data pointer
+// Parameters:  p_string -> Input character pointer (containing a number)
+//              p_fromDB -> Input comes from a  database (always American format)
+template<int Limbs>
+basic_bcd<Limbs>::basic_bcd(LPCTSTR p_string,bool p_fromDB /*= false*/)
+{
+  SetValueString(p_string,p_fromDB);
+}
+
+// bcd::bcd(numeric)
+// Description: Assignment-constructor for bcd from a SQL NUMERIC
+// Parameters:  p_numeric -> Input from a SQL ODBC database
+//                           from a NUMERIC field
+//
+template<int Limbs>
+basic_bcd<Limbs>::basic_bcd(const SQL_NUMERIC_STRUCT* p_numeric)
+{
+  SetValueNumeric(p_numeric);
+}
+
+// bcd::bcd(Sign)
+// Description: Construct a bcd from a NULL in the database
+// Parameters:  p_sign : BUT GETS IGNORED!!
+//
+template<int Limbs>
+basic_bcd<Limbs>::basic_bcd(const basic_bcd::Sign /*p_sign*/)
+{
+  Zero();
+  // We ignore the argument!!
+  m_sign = Sign::ISNULL;
+}
+
+//////////////////////////////////////////////////////////////////////////
+//
+// END OF CONSTRUCTORS OF BCD
+//
+//////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////
+//
+// CONSTANTS OF BCD
+//
+//////////////////////////////////////////////////////////////////////////
+
+// Mantissa elements of the nature constants in 1024 digits (2 * bcdMaxLength elements)
+// Every width of the bcd takes as many elements as its mantissa can hold,
+// and the tails of PI and LN10 as many elements after that
+
+// PI: +3.1415926_53589793_23846264_33832795_02884197_16939937 ...
+static const long g_mantissaPI[2 * bcdMaxLength] =
+{
+   31415926L, 53589793L, 23846264L, 33832795L,  2884197L
+ , 16939937L, 51058209L, 74944592L, 30781640L, 62862089L
+ , 98628034L, 82534211L, 70679821L, 48086513L, 28230664L
+ , 70938446L,  9550582L, 23172535L, 94081284L, 81117450L
+ , 28410270L, 19385211L,  5559644L, 62294895L, 49303819L
+ , 64428810L, 97566593L, 34461284L, 75648233L, 78678316L
+ , 52712019L,  9145648L, 56692346L,  3486104L, 54326648L
+ , 21339360L, 72602491L, 41273724L, 58700660L, 63155881L
+ , 74881520L, 92096282L, 92540917L, 15364367L, 89259036L
+ ,   113305L, 30548820L, 46652138L, 41469519L, 41511609L
+ , 43305727L,  3657595L, 91953092L, 18611738L, 19326117L
+ , 93105118L, 54807446L, 23799627L, 49567351L, 88575272L
+ , 48912279L, 38183011L, 94912983L, 36733624L, 40656643L
+ ,  8602139L, 49463952L, 24737190L, 70217986L,  9437027L
+ , 70539217L, 17629317L, 67523846L, 74818467L, 66940513L
+ , 20005681L, 27145263L, 56082778L, 57713427L, 57789609L
+ , 17363717L, 87214684L, 40901224L, 95343014L, 65495853L
+ , 71050792L, 27968925L, 89235420L, 19956112L, 12902196L
+ ,  8640344L, 18159813L, 62977477L, 13099605L, 18707211L
+ , 34999999L, 83729780L, 49951059L, 73173281L, 60963185L
+ , 95024459L, 45534690L, 83026425L, 22308253L, 34468503L
+ , 52619311L, 88171010L,   313783L, 87528865L, 87533208L
+ , 38142061L, 71776691L, 47303598L, 25349042L, 87554687L
+ , 31159562L, 86388235L, 37875937L, 51957781L, 85778053L
+ , 21712268L,  6613001L, 92787661L, 11959092L, 16420198L
+ , 93809525L, 72010654L, 85863278L
+};
+
+// LN2: +0.69314718_05599453_09417232_12145817_65680755_00134360 ...
+static const long g_mantissaLN2[2 * bcdMaxLength] =
+{
+   69314718L,  5599453L,  9417232L, 12145817L, 65680755L
+ ,   134360L, 25525412L,  6800094L, 93393621L, 96969471L
+ , 56058633L, 26996418L, 68754200L, 14810205L, 70685733L
+ , 68552023L, 57581305L, 57032670L, 75163507L, 59619307L
+ , 27570828L, 37143519L,  3070386L, 23891673L, 47112335L
+ ,  1153644L, 97955239L, 12047517L, 26815749L, 32065155L
+ , 52473413L, 95258829L, 50453007L,  9532636L, 66426541L
+ ,  4239157L, 81495204L, 37404303L, 85500801L, 94417064L
+ , 16715186L, 44712839L, 96817178L, 45469570L, 26271631L
+ ,  6454615L,  2572074L,  2481637L, 77338963L, 85506952L
+ , 60668341L, 13727387L, 37229289L, 56493547L,  2576265L
+ , 20988596L, 93201965L,  5855476L, 47033067L, 93654432L
+ , 54763274L, 49512504L,  6069438L, 14710468L, 99465062L
+ , 20167720L, 42452452L, 96126879L, 46546193L, 16517468L
+ , 13926725L,  4103802L, 54625965L, 68691441L, 92871608L
+ , 29380317L, 27143677L, 82654877L, 56648508L, 56740776L
+ , 48451464L, 43994046L, 14226031L, 93096735L, 40257444L
+ , 60703080L, 96085047L, 48663852L, 31381816L, 76751438L
+ , 66747664L, 78908814L, 37141985L, 49423151L, 99735488L
+ ,  3751658L, 61275352L, 91661000L, 71053558L, 24987941L
+ , 47295092L, 93113897L, 15599820L, 56543928L, 71700072L
+ , 18085761L,  2523688L, 92132449L, 71389320L, 37843935L
+ , 30887748L, 25970171L, 55910708L, 82368362L, 75898425L
+ , 89185353L,  2436342L, 14367061L, 18923678L, 91923723L
+ , 14672321L, 72053401L, 64925687L, 27477823L, 44535347L
+ , 64811494L, 18642386L, 77677440L
+};
+
+// LN10: +2.3025850_92994045_68401799_14546843_64207601_10148862 ...
+static const long g_mantissaLN10[2 * bcdMaxLength] =
+{
+   23025850L, 92994045L, 68401799L, 14546843L, 64207601L
+ , 10148862L, 87729760L, 33327900L, 96757260L, 96773524L
+ , 80235997L, 20508959L, 82983419L, 67784042L, 28624863L
+ , 34095254L, 65082806L, 75666628L, 73690987L, 81689482L
+ , 90720832L, 55546808L, 43799894L, 82623319L, 85283935L
+ ,  5308965L, 37773262L, 88461633L, 66222287L, 69821988L
+ , 67465436L, 67474404L, 24327436L, 51550489L, 34314939L
+ , 39147961L, 94044002L, 22105101L, 71417480L,  3688084L
+ ,  1264708L,  6855677L, 43216228L, 35522011L, 48046637L
+ , 15659121L, 37345074L, 78569476L, 83463616L, 79210180L
+ , 64450706L, 48000277L, 50268491L, 67465505L, 86856935L
+ , 67342067L,  5811364L, 29224554L, 40575892L, 57242082L
+ , 41314695L, 68901675L, 89402567L, 76311356L, 91929203L
+ , 33765871L, 41660230L, 10570308L, 96345720L, 75440370L
+ , 84746994L,  1682692L, 82808481L, 18428931L, 48485249L
+ , 48644871L, 92780967L, 62712757L, 75397027L, 66860595L
+ , 24967166L, 74183485L, 70442250L, 71979650L,  4714951L
+ ,  5049221L, 47765676L, 36938662L, 97697952L, 21107182L
+ , 64549734L, 77266242L, 57094293L, 22582798L, 50258550L
+ , 97852653L, 83207606L, 72631716L, 43095059L, 95087807L
+ , 52371033L, 31011978L, 57547331L, 54142180L, 84275438L
+ , 63591778L, 11705430L, 98274823L, 85045648L,  1909561L
+ ,  2992918L, 24318237L, 52535770L, 97505395L, 65187697L
+ , 51037497L,  8886921L, 80205189L, 33950723L, 85392051L
+ , 44634197L, 26528728L, 69651108L, 62571492L, 19884997L
+ , 87488737L, 71345686L, 20916705L
+};
+
+// bcd::PI
+// Description: Circumference/Radius ratio of a circle
+// Technical:   Nature constant that never changes
+template<int Limbs>
+basic_bcd<Limbs>
+basic_bcd<Limbs>::PI()
+{
+  basic_bcd pi;
+
+  memcpy(pi.m_mantissa,g_mantissaPI,bcdLength * sizeof(long));
+
+  return pi;
+}
+
+// bcd::LN2
+// Description: Natural logarithm of two
+// Technical:  Mathematical constant that never changes
+template<int Limbs>
+basic_bcd<Limbs>
+basic_bcd<Limbs>::LN2()
+{
+  basic_bcd ln2;
+
+  ln2.m_exponent = -1;
+  memcpy(ln2.m_mantissa,g_mantissaLN2,bcdLength * sizeof(long));
+
+  return ln2;
+}
+
+// bcd::LN10
+// Description: Natural logarithm of ten
+// Technical:   Mathematical constant that never changes
+template<int Limbs>
+basic_bcd<Limbs>
+basic_bcd<Limbs>::LN10()
+{
+  basic_bcd ln10;
+
+  memcpy(ln10.m_mantissa,g_mantissaLN10,bcdLength * sizeof(long));
+
+  return ln10;
+}
+
+// bcd::LN10Tail
+// Description: The digits of ln(10) after the mantissa of LN10()
+// Technical:   For multiples of ln(10) that must be exact beyond the precision
+template<int Limbs>
+basic_bcd<Limbs>
+basic_bcd<Limbs>::LN10Tail()
+{
+  basic_bcd tail;
+
+  memcpy(tail.m_mantissa,&g_mantissaLN10[bcdLength],bcdLength * sizeof(long));
+  tail.Normalize(-bcdPrecision);
+
+  return tail;
+}
+
+// bcd::PITail
+// Description: The digits of PI after the mantissa of PI()
+// Technical:   For multiples of PI that must be exact beyond the precision
+template<int Limbs>
+basic_bcd<Limbs>
+basic_bcd<Limbs>::PITail()
+{
+  basic_bcd tail;
+
+  memcpy(tail.m_mantissa,&g_mantissaPI[bcdLength],bcdLength * sizeof(long));
+  tail.Normalize(-bcdPrecision);
+
+  return tail;
+}
+
+ // Maximum number a bcd can hold
+template<int Limbs>
+basic_bcd<Limbs>
+basic_bcd<Limbs>::MIN_BCD()
+{
+  basic_bcd min = MAX_BCD();
+  // Turn the sign around
+  min.m_sign = Sign::Negative;
+
+  return min;
+}
+
+// Minimum number a bcd can hold
+template<int Limbs>
+basic_bcd<Limbs>
+basic_bcd<Limbs>::MAX_BCD()
+{
+  basic_bcd max;
+
+  max.m_sign     = Sign::Positive;
+  max.m_exponent = SHRT_MAX;
+  for(int ind = 0; ind < bcdLength; ++ind)
+  {
+    max.m_mantissa[ind] = bcdBase - 1;
+  }
+  return max;
+}
+
+// Smallest number a bcd can hold
+template<int Limbs>
+basic_bcd<Limbs>
+basic_bcd<Limbs>::MIN_EPSILON()
+{
+  basic_bcd eps;
+
+  eps.m_sign        = Sign::Positive;
+  eps.m_mantissa[0] = 1L;
+  eps.m_exponent    = SHRT_MIN;
+
+  return eps;
+}
+
+//////////////////////////////////////////////////////////////////////////
+//
+// END OF CONSTANTS OF BCD
+//
+//////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////
+//
+// ERROR HANDLING
+//
+//////////////////////////////////////////////////////////////////////////
+
+template<int Limbs>
+/*static */ void 
+basic_bcd<Limbs>::ErrorThrows(bool p_throws /*= true*/)
+{
+  bcd_context::Current().m_throwing = p_throws;
+}
+
+//////////////////////////////////////////////////////////////////////////
+//
+// OPERATORS OF BCD
+//
+//////////////////////////////////////////////////////////////////////////
+
+// bcd::+
+// Description: Addition operator
+//
+template<int Limbs>
+const basic_bcd<Limbs>
+basic_bcd<Limbs>::operator+(const basic_bcd& p_value) const
+{
+  return Add(p_value);
+}
+
+template<int Limbs>
+const basic_bcd<Limbs>
+basic_bcd<Limbs>::operator+(const int p_value) const
+{
+  return Add(basic_bcd(p_value));
+}
+
+template<int Limbs>
+const basic_bcd<Limbs>
+basic_bcd<Limbs>::operator+(const double p_value) const
+{
+  return Add(basic_bcd(p_value));
+}
+
+template<int Limbs>
+const basic_bcd<Limbs>
+basic_bcd<Limbs>::operator+(LPCTSTR p_value) const
+{
+  return Add(basic_bcd(p_value));
+}
+
+// bcd::-
+// Description: Subtraction operator
+template<int Limbs>
+const basic_bcd<Limbs>
+basic_bcd<Limbs>::operator-(const basic_bcd& p_value) const
+{
+  return Sub(p_value);
+}
+
+template<int Limbs>
+const basic_bcd<Limbs>
+basic_bcd<Limbs>::operator-(const int p_value) const
+{
+  return Sub(basic_bcd(p_value));
+}
+
+template<int Limbs>
+const basic_bcd<Limbs>
+basic_bcd<Limbs>::operator-(const double p_value) const
+{
+  return Sub(basic_bcd(p_value));
+}
+
+template<int Limbs>
+const basic_bcd<Limbs>
+basic_bcd<Limbs>::operator-(LPCTSTR p_value) const
+{
+  return Sub(basic_bcd(p_value));
+}
+
+// bcd::*
+// Description: Multiplication operator
+template<int Limbs>
+const basic_bcd<Limbs>
+basic_bcd<Limbs>::operator*(const basic_bcd& p_value) const
+{
+  return Mul(p_value);
+}
+
+template<int Limbs>
+const basic_bcd<Limbs>
+basic_bcd<Limbs>::operator*(const int p_value) const
+{
+  return MulInt(p_value);
+}
+
+template<int Limbs>
+const basic_bcd<Limbs>
+basic_bcd<Limbs>::operator*(const double p_value) const
+{
+  return Mul(basic_bcd(p_value));
+}
+
+template<int Limbs>
+const basic_bcd<Limbs>
+basic_bcd<Limbs>::operator*(LPCTSTR p_value) const
+{
+  return Mul(basic_bcd(p_value));
+}
+
+// bcd::/
+// Description: Division operator
+template<int Limbs>
+const basic_bcd<Limbs>
+basic_bcd<Limbs>::operator/(const basic_bcd& p_value) const
+{
+  return Div(p_value);
+}
+
+template<int Limbs>
+const basic_bcd<Limbs>
+basic_bcd<Limbs>::operator/(const int p_value) const
+{
+  return DivInt(p_value);
+}
+
+template<int Limbs>
+const basic_bcd<Limbs>
+basic_bcd<Limbs>::operator/(const double p_value) const
+{
+  return Div(basic_bcd(p_value));
+}
+
+template<int Limbs>
+const basic_bcd<Limbs>
+basic_bcd<Limbs>::operator/(LPCTSTR p_value) const
+{
+  return Div(basic_bcd(p_value));
+}
+
+// bcd::%
+// Description: Modulo operator
+template<int Limbs>
+const basic_bcd<Limbs>
+basic_bcd<Limbs>::operator%(const basic_bcd& p_value) const
+{
+  return Mod(p_value);
+}
+
+template<int Limbs>
+const basic_bcd<Limbs>  
+basic_bcd<Limbs>::operator%(const int p_value) const
+{
+  return ModInt(p_value);
+}
+
+template<int Limbs>
+const basic_bcd<Limbs>
+basic_bcd<Limbs>::operator%(const double p_value) const
+{
+  return Mod(basic_bcd(p_value));
+}
+
+template<int Limbs>
+const basic_bcd<Limbs>
+basic_bcd<Limbs>::operator%(LPCTSTR p_value) const
+{
+  return Mod(basic_bcd(p_value));
+}
+
+// bcd::operator +=
+// Description: Operator to add a bcd to this one
+template<int Limbs>
+basic_bcd<Limbs>&
+basic_bcd<Limbs>::operator+=(const basic_bcd& p_value)
+{
+  *this = Add(p_value);
+  return *this;
+}
+
+template<int Limbs>
+basic_bcd<Limbs>&
+basic_bcd<Limbs>::operator+=(const int p_value)
+{
+  *this = Add(basic_bcd(p_value));
+  return *this;
+}
+
+template<int Limbs>
+basic_bcd<Limbs>&
+basic_bcd<Limbs>::operator+=(const double p_value)
+{
+  *this = Add(basic_bcd(p_value));
+  return *this;
+}
+
+template<int Limbs>
+basic_bcd<Limbs>&
+basic_bcd<Limbs>::operator+=(LPCTSTR p_value)
+{
+  *this = Add(basic_bcd(p_value));
+  return *this;
+}
+
+// bcd::operator -=
+// Description: Operator to subtract a bcd from this one
+template<int Limbs>
+basic_bcd<Limbs>&
+basic_bcd<Limbs>::operator-=(const basic_bcd& p_value)
+{
+  *this = Sub(p_value);
+  return *this;
+}
+
+template<int Limbs>
+basic_bcd<Limbs>& 
+basic_bcd<Limbs>::operator-=(const int p_value)
+{
+  *this = Sub(basic_bcd(p_value));
+  return *this;
+}
+
+template<int Limbs>
+basic_bcd<Limbs>&
+basic_bcd<Limbs>::operator-=(const double p_value)
+{
+  *this = Sub(basic_bcd(p_value));
+  return *this;
+}
+
+template<int Limbs>
+basic_bcd<Limbs>&
+basic_bcd<Limbs>::operator-=(LPCTSTR p_value)
+{
+  *this = Sub(basic_bcd(p_value));
+  return *this;
+}
+
+// bcd::operator *=
+// Description: Operator to multiply a bcd with this one
+template<int Limbs>
+basic_bcd<Limbs>& 
+basic_bcd<Limbs>::operator*=(const basic_bcd& p_value)
+{
+  *this = Mul(p_value);
+  return *this;
+}
+
+template<int Limbs>
+basic_bcd<Limbs>&
+basic_bcd<Limbs>::operator*=(const int p_value)
+{
+  *this = MulInt(p_value);
+  return *this;
+}
+
+template<int Limbs>
+basic_bcd<Limbs>&
+basic_bcd<Limbs>::operator*=(const double p_value)
+{
+  *this = Mul(basic_bcd(p_value));
+  return *this;
+}
+
+template<int Limbs>
+basic_bcd<Limbs>&
+basic_bcd<Limbs>::operator*=(LPCTSTR p_value)
+{
+  *this = Mul(basic_bcd(p_value));
+  return *this;
+}
+
+// bcd::operator /=
+// Description: Operator to divide a bcd with another
+template<int Limbs>
+basic_bcd<Limbs>& 
+basic_bcd<Limbs>::operator/=(const basic_bcd& p_value)
+{
+  *this = Div(p_value);
+  return *this;
+}
+
+template<int Limbs>
+basic_bcd<Limbs>&
+basic_bcd<Limbs>::operator/=(const int p_value)
+{
+  *this = DivInt(p_value);
+  return *this;
+}
+
+template<int Limbs>
+basic_bcd<Limbs>&
+basic_bcd<Limbs>::operator/=(const double p_value)
+{
+  *this = Div(basic_bcd(p_value));
+  return *this;
+}
+
+template<int Limbs>
+basic_bcd<Limbs>&
+basic_bcd<Limbs>::operator/=(LPCTSTR p_value)
+{
+  *this = Div(basic_bcd(p_value));
+  return *this;
+}
+
+// bcd::operator %=
+// Description: Operator to do a modulo on this one
+template<int Limbs>
+basic_bcd<Limbs>& 
+basic_bcd<Limbs>::operator%=(const basic_bcd& p_value)
+{
+  *this = Mod(p_value);
+  return *this;
+}
+
+template<int Limbs>
+basic_bcd<Limbs>&
+basic_bcd<Limbs>::operator%=(const int p_value)
+{
+  *this = ModInt(p_value);
+  return *this;
+}
+
+template<int Limbs>
+basic_bcd<Limbs>&
+basic_bcd<Limbs>::operator%=(const double p_value)
+{
+  *this = Mod(basic_bcd(p_value));
+  return *this;
+}
+
+template<int Limbs>
+basic_bcd<Limbs>&
+basic_bcd<Limbs>::operator%=(LPCTSTR p_value)
+{
+  *this = Mod(basic_bcd(p_value));
+  return *this;
+}
+
+// bd::-
+// Description: prefix unary minus (negation)
+//
+template<int Limbs>
+basic_bcd<Limbs>  
+basic_bcd<Limbs>::operator-() const
+{
+  basic_bcd result(*this);
+
+  // Null can never be negative
+  if(!result.IsZero() && result.IsValid() && !result.IsNULL())
+  {
+    // Swap signs
+    if(result.m_sign == Sign::Positive)
+    {
+      result.m_sign = Sign::Negative;
+    }
+    else
+    {
+      result.m_sign = Sign::Positive;
+    }
+  }
+  return result;
+}
+
+// bcd::postfix ++
+//
+template<int Limbs>
+basic_bcd<Limbs> 
+basic_bcd<Limbs>::operator++(int)
+{
+  // Return result first, than do the add 1
+  basic_bcd res(*this);
+  ++*this;
+  return res;
+}
+
+// bcd::prefix++
+template<int Limbs>
+basic_bcd<Limbs>& 
+basic_bcd<Limbs>::operator++()
+{
+  //++x is equal to x+=1
+  basic_bcd number_1(1);
+  *this += number_1;
+  return *this;
+}
+
+// bcd::Postfix decrement
+//
+template<int Limbs>
+basic_bcd<Limbs> 
+basic_bcd<Limbs>::operator--(int)
+{
+  // Return result first, than do the subtract
+  basic_bcd res(*this);
+  --*this;
+  return res;
+}
+
+// bcd::Prefix  decrement
+template<int Limbs>
+basic_bcd<Limbs>& 
+basic_bcd<Limbs>::operator--()
+{
+  // --x is equal to x-=1
+  basic_bcd number_1(1);
+  *this -= number_1;
+  return *this;
+}
+
+// bcd::=
+// Description: Assignment operator from another bcd
+template<int Limbs>
+basic_bcd<Limbs>& 
+basic_bcd<Limbs>::operator=(const basic_bcd& p_value)
+{
+  if(this != &p_value)
+  {
+    m_sign      = p_value.m_sign;
+    m_exponent  = p_value.m_exponent;
+    memcpy(m_mantissa,p_value.m_mantissa,bcdLength * sizeof(long));
+  }
+  return *this;
+}
+
+// bcd::=
+// Description: Assignment operator from a long
+template<int Limbs>
+basic_bcd<Limbs>& 
+basic_bcd<Limbs>::operator=(const int p_value)
+{
+  SetValueLong(p_value,0);
+  return *this;
+}
+
+// bcd::=
+// Description: Assignment operator from a double
+template<int Limbs>
+basic_bcd<Limbs>& 
+basic_bcd<Limbs>::operator=(const double p_value)
+{
+  SetValueDouble(p_value);
+  return *this;
+}
+
+// bcd::=
+// Description: Assignment operator from a string
+template<int Limbs>
+basic_bcd<Limbs>& 
+basic_bcd<Limbs>::operator=(const PCTSTR p_value)
+{
+  SetValueString(p_value);
+  return *this;
+}
+
+// bcd::=
+// Description: Assignment operator from an __int64
+template<int Limbs>
+basic_bcd<Limbs>&
+basic_bcd<Limbs>::operator=(const __int64 p_value)
+{
+  SetValueInt64(p_value,0);
+  return *this;
+}
+
+// bcd::operator==
+// Description: Equality comparison of two bcd numbers
+//
+template<int Limbs>
+bool 
+basic_bcd<Limbs>::operator==(const basic_bcd& p_value) const
+{
+  // Shortcut: the same number is equal to itself
+  if(this == &p_value)
+  {
+    return true;
+  }
+  // Signs must be equal
+  if(m_sign != p_value.m_sign)
+  {
+    return false;
+  }
+  // Exponents must be equal
+  if(m_exponent != p_value.m_exponent)
+  {
+    return false;
+  }
+  // Mantissa's must be equal
+  for(int ind = 0;ind < bcdLength; ++ind)
+  {
+    if(m_mantissa[ind] != p_value.m_mantissa[ind])
+    {
+      return false;
+    }
+  }
+  // Everything is equal
+  return true;
+}
+
+template<int Limbs>
+bool
+basic_bcd<Limbs>::operator==(const int p_value) const
+{
+  return IsValid() && CompareInteger(p_value) == 0;
+}
+
+template<int Limbs>
+bool
+basic_bcd<Limbs>::operator==(const int64 p_value) const
+{
+  return IsValid() && CompareInteger(p_value) == 0;
+}
+
+template<int Limbs>
+bool
+basic_bcd<Limbs>::operator==(const double p_value) const
+{
+  return IsValid() && CompareDouble(p_value) == 0;
+}
+
+template<int Limbs>
+bool
+basic_bcd<Limbs>::operator==(LPCTSTR p_value) const
+{
+  return *this == CachedString(p_value);
+}
+
+// bcd::operator!=
+// Description: Inequality comparison of two bcd numbers
+//
+template<int Limbs>
+bool 
+basic_bcd<Limbs>::operator!=(const basic_bcd& p_value) const
+{
+  // (x != y) is equal to !(x == y)
+  return !(*this == p_value);
+}
+
+template<int Limbs>
+bool
+basic_bcd<Limbs>::operator!=(const int p_value) const
+{
+  return !(*this == p_value);
+}
+
+template<int Limbs>
+bool
+basic_bcd<Limbs>::operator!=(const int64 p_value) const
+{
+  return !(*this == p_value);
+}
+
+template<int Limbs>
+bool
+basic_bcd<Limbs>::operator!=(const double p_value) const
+{
+  return !(*this == p_value);
+}
+
+template<int Limbs>
+bool
+basic_bcd<Limbs>::operator!=(LPCTSTR p_value) const
+{
+  return !(*this == CachedString(p_value));
+}
+
+// bcd::operator<
+// Description: Smaller than comparison of two bcd numbers
+// Technical:   NULL, INF and NaN compare to nothing
+template<int Limbs>
+bool
+basic_bcd<Limbs>::operator<(const basic_bcd& p_value) const
+{
+  if(!IsValid() || !p_value.IsValid())
+  {
+    return false;
+  }
+  return Compare(p_value) < 0;
+}
+
+template<int Limbs>
+bool
+basic_bcd<Limbs>::operator<(const int p_value) const
+{
+  return IsValid() && CompareInteger(p_value) < 0;
+}
+
+template<int Limbs>
+bool
+basic_bcd<Limbs>::operator<(const int64 p_value) const
+{
+  return IsValid() && CompareInteger(p_value) < 0;
+}
+
+template<int Limbs>
+bool
+basic_bcd<Limbs>::operator<(const double p_value) const
+{
+  return IsValid() && CompareDouble(p_value) < 0;
+}
+
+template<int Limbs>
+bool
+basic_bcd<Limbs>::operator<(LPCTSTR p_value) const
+{
+  return *this < CachedString(p_value);
+}
+
+// bcd::operator>
+// Description: Greater than comparison of two bcd numbers
+// Technical:   NULL, INF and NaN compare to nothing
+template<int Limbs>
+bool
+basic_bcd<Limbs>::operator>(const basic_bcd& p_value) const
+{
+  if(!IsValid() || !p_value.IsValid())
+  {
+    return false;
+  }
+  return Compare(p_value) > 0;
+}
+
+template<int Limbs>
+bool
+basic_bcd<Limbs>::operator>(const int p_value) const
+{
+  return IsValid() && CompareInteger(p_value) > 0;
+}
+
+template<int Limbs>
+bool
+basic_bcd<Limbs>::operator>(const int64 p_value) const
+{
+  return IsValid() && CompareInteger(p_value) > 0;
+}
+
+template<int Limbs>
+bool
+basic_bcd<Limbs>::operator>(const double p_value) const
+{
+  return IsValid() && CompareDouble(p_value) > 0;
+}
+
+template<int Limbs>
+bool
+basic_bcd<Limbs>::operator>(LPCTSTR p_value) const
+{
+  return *this > CachedString(p_value);
+}
+
+template<int Limbs>
+bool
+basic_bcd<Limbs>::operator<=(const basic_bcd& p_value) const
+{
+  // (x <= y) equals !(x > y)
+  return !(*this > p_value);
+}
+
+template<int Limbs>
+bool
+basic_bcd<Limbs>::operator<=(const int p_value) const
+{
+  return !(*this > p_value);
+}
+
+template<int Limbs>
+bool
+basic_bcd<Limbs>::operator<=(const int64 p_value) const
+{
+  return !(*this > p_value);
+}
+
+template<int Limbs>
+bool
+basic_bcd<Limbs>::operator<=(const double p_value) const
+{
+  return !(*this > p_value);
+}
+
+template<int Limbs>
+bool
+basic_bcd<Limbs>::operator<=(LPCTSTR p_value) const
+{
+  return !(*this > CachedString(p_value));
+}
+
+template<int Limbs>
+bool
+basic_bcd<Limbs>::operator>=(const basic_bcd& p_value) const
+{
+  // (x >= y) equals !(x < y)
+  return !(*this < p_value);
+}
+
+template<int Limbs>
+bool
+basic_bcd<Limbs>::operator>=(const int p_value) const
+{
+  return !(*this < p_value);
+}
+
+template<int Limbs>
+bool
+basic_bcd<Limbs>::operator>=(const int64 p_value) const
+{
+  return !(*this < p_value);
+}
+
+template<int Limbs>
+bool
+basic_bcd<Limbs>::operator>=(const double p_value) const
+{
+  return !(*this < p_value);
+}
+
+template<int Limbs>
+bool
+basic_bcd<Limbs>::operator>=(LPCTSTR p_value) const
+{
+  return !(*this < CachedString(p_value));
+}
+
+// bcd::Compare
+// Description: Three way comparison of two bcd numbers
+// Technical:   Returns -1 (this is smaller), 0 (equal) or 1 (this is greater)
+//              Decided by the signs first, then the exponents, then the mantissa
+//              limb by limb, with an exit on the first difference.
+//              All numbers are in order: NULL < -INF < negative < zero < positive < INF < NaN
+template<int Limbs>
+int
+basic_bcd<Limbs>::Compare(const basic_bcd& p_value) const
+{
+  if(m_sign != p_value.m_sign)
+  {
+    // Place in the order of the signs Positive, Negative, ISNULL, MIN_INF, INF and NaN
+    static const int order[] = { 3, 2, 0, 1, 4, 5 };
+    return (order[(int)m_sign] < order[(int)p_value.m_sign]) ? -1 : 1;
+  }
+  switch(m_sign)
+  {
+    case Sign::Positive: return  CompareAbsolute(p_value);
+    case Sign::Negative: return -CompareAbsolute(p_value);
+    default:             return  0;
+  }
+}
+
+// bcd::CompareInteger
+// Description: Three way comparison of a valid number with an integer (times 10^-p_scale)
+// Technical:   The signs and the number of digits of the integer decide most comparisons.
+//              Otherwise the integer is split into the first three limbs of a mantissa
+//              and compared limb by limb, so no bcd is made of it.
+template<int Limbs>
+int
+basic_bcd<Limbs>::CompareInteger(const int64 p_value,const int p_scale /*= 0*/) const
+{
+  Sign sign = (p_value < 0) ? Sign::Negative : Sign::Positive;
+  if(m_sign != sign)
+  {
+    return (m_sign == Sign::Negative) ? -1 : 1;
+  }
+  uint64 value = (p_value < 0) ? (0 - (uint64)p_value) : (uint64)p_value;
+  int    order = 0;
+  if(m_mantissa[0] == 0 || value == 0)
+  {
+    order = (m_mantissa[0] != 0) - (value != 0);
+  }
+  else
+  {
+    int digits = 1;
+    while(digits < 20 && value >= g_intPowers[digits])
+    {
+      ++digits;
+    }
+    int exponent = digits - 1 - p_scale;
+    if(m_exponent != exponent)
+    {
+      order = (m_exponent > exponent) ? 1 : -1;
+    }
+    else
+    {
+      // At most 20 digits: 8 in the first limb, 8 in the second and 4 in the third
+      long limbs[3] = { 0, 0, 0 };
+      int  rest     = digits - bcdDigits;
+      if(rest <= 0)
+      {
+        limbs[0] = (long)(value * g_intPowers[-rest]);
+      }
+      else
+      {
+        uint64 low = value % g_intPowers[rest];
+        limbs[0] = (long)(value / g_intPowers[rest]);
+        rest -= bcdDigits;
+        if(rest <= 0)
+        {
+          limbs[1] = (long)(low * g_intPowers[-rest]);
+        }
+        else
+        {
+          limbs[1] = (long)(low / g_intPowers[rest]);
+          limbs[2] = (long)(low % g_intPowers[rest] * g_intPowers[bcdDigits - rest]);
+        }
+      }
+      for(int ind = 0; ind < bcdLength && order == 0; ++ind)
+      {
+        long limb = (ind < 3) ? limbs[ind] : 0;
+        if(m_mantissa[ind] != limb)
+        {
+          order = (m_mantissa[ind] > limb) ? 1 : -1;
+        }
+      }
+    }
+  }
+  return (sign == Sign::Negative) ? -order : order;
+}
+
+// A double as it was written (1000, 1000.5 or 0.1) is a whole number times 10^-scale:
+// the first scale for which the nearest whole number reads back as the same double.
+// This is its shortest round trip decimal. Fails if that whole number exceeds 2^53
+// or needs a scale of 16 or more.
+static bool
+DoubleAsWritten(const double p_value,int64& p_whole,int& p_scale)
+{
+  const double exact = 9007199254740992.0; // 2^53
+  double scaled = p_value;
+  for(int scale = 0; scale < 16 && scaled > -exact && scaled < exact; ++scale)
+  {
+    // The product is rounded: the exact rest (fma) corrects the nearest whole number,
+    // and that number must read back as the same double
+    double power = (double)g_intPowers[scale];
+    double whole = floor(scaled + 0.5);
+    double rest  = fma(p_value,power,-whole);
+    if(rest > 0.5)
+    {
+      whole += 1.0;
+    }
+    else if(rest < -0.5)
+    {
+      whole -= 1.0;
+    }
+    if(whole / power == p_value)
+    {
+      p_whole = (int64)whole;
+      p_scale = scale;
+      return true;
+    }
+    scaled = p_value * (double)g_intPowers[scale + 1];
+  }
+  return false;
+}
+
+// bcd::CompareDouble
+// Description: Three way comparison of a valid number with a double
+// Technical:   Compares with the same number as the conversion of the double (SetValueDouble)
+//              - The signs decide, or the decimal exponent of this number against the
+//                binary exponent of the double (frexp) if they are far enough apart
+//              - A double as it was written is compared as an integer (DoubleAsWritten)
+//              - Only the rest (as 1/3.0) is converted to a bcd
+template<int Limbs>
+int
+basic_bcd<Limbs>::CompareDouble(const double p_value) const
+{
+  // Infinity or NaN as the conversion does
+  if(!(p_value > -DBL_MAX && p_value < DBL_MAX))
+  {
+    return Compare(basic_bcd(p_value));
+  }
+  Sign sign = (p_value < 0.0) ? Sign::Negative : Sign::Positive;
+  if(m_sign != sign)
+  {
+    return (m_sign == Sign::Negative) ? -1 : 1;
+  }
+  if(m_mantissa[0] != 0 && p_value != 0.0)
+  {
+    // 2^(binary - 1) <= |double| < 2^binary and 10^m_exponent <= |this| < 10^(m_exponent + 1)
+    // With log2(10) some margin remains for the rounding of the multiplication
+    const double log2ten = 3.321928094887362;
+    int binary = 0;
+    frexp(p_value,&binary);
+    if((m_exponent + 1) * log2ten < (binary - 1) - 1E-6)
+    {
+      return (sign == Sign::Negative) ? 1 : -1;
+    }
+    if(m_exponent * log2ten > binary + 1E-6)
+    {
+      return (sign == Sign::Negative) ? -1 : 1;
+    }
+  }
+  int64 whole = 0;
+  int   scale = 0;
+  if(DoubleAsWritten(p_value,whole,scale))
+  {
+    return CompareInteger(whole,scale);
+  }
+  return Compare(basic_bcd(p_value));
+}
+
+// bcd::CachedString
+// Description: The number of a string in a comparison
+// Technical:   Comparisons with a string (as amount > "1000.50") mostly get the same
+//              literal, millions of times. Every thread keeps the last parsed strings
+//              by their address. The text must still be the same, so a buffer with
+//              another number in it is parsed again. A string that raised a status
+//              while parsing (or a long one) is not kept, so it raises it every time.
+template<int Limbs>
+basic_bcd<Limbs>
+basic_bcd<Limbs>::CachedString(LPCTSTR p_string)
+{
+  struct CachedNumber
+  {
+    LPCTSTR   m_address { nullptr };
+    TCHAR     m_text[stringCacheLength] { 0 };
+    basic_bcd m_number;
+  };
+  static thread_local CachedNumber cache[stringCacheEntries];
+
+  CachedNumber& entry = cache[((size_t)p_string / sizeof(TCHAR)) % stringCacheEntries];
+  if(entry.m_address == p_string && _tcscmp(entry.m_text,p_string) == 0)
+  {
+    return entry.m_number;
+  }
+
+  // Parse with an empty status, to see if the string raises one
+  bcd_context& context = bcd_context::Current();
+  unsigned status = context.m_status;
+  context.m_status = bcd_context::StatusNone;
+  basic_bcd number;
+  try
+  {
+    number = basic_bcd(p_string);
+  }
+  catch(...)
+  {
+    context.m_status |= status;
+    throw;
+  }
+  bool raised = context.m_status != bcd_context::StatusNone;
+  context.m_status |= status;
+
+  size_t length = _tcslen(p_string);
+  if(!raised && length < stringCacheLength)
+  {
+    entry.m_address = p_string;
+    memcpy(entry.m_text,p_string,(length + 1) * sizeof(TCHAR));
+    entry.m_number  = number;
+  }
+  return number;
+}
+
+//////////////////////////////////////////////////////////////////////////
+//
+// END OF OPERATORS OF BCD
+//
+//////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////
+//
+// MAKING AN EXACT NUMERIC
+//
+//////////////////////////////////////////////////////////////////////////
+
+// bcd::Zero
+// Description: Make empty
+// Technical:   Set the mantissa/exponent/sign to the number zero (0)
+
+template<int Limbs>
+void
+basic_bcd<Limbs>::Zero()
+{
+  m_sign = Sign::Positive;
+  m_exponent = 0;
+  memset(m_mantissa,0,bcdLength * sizeof(long));
+}
+
+// Set to database NULL
+template<int Limbs>
+void
+basic_bcd<Limbs>::SetNULL()
+{
+  Zero();
+  m_sign = Sign::ISNULL;
+}
+
+// Round to a specified fraction (decimals behind the .)
+template<int Limbs>
+void     
+basic_bcd<Limbs>::Round(int p_precision /*=0*/)
+{
+  // Check if we can do a round
+  if(!IsValid() || IsNULL())
+  {
+    return;
+  }
+
+  // Precision is dependent on the exponent
+  int precision = p_precision + m_exponent;
+
+  // Quick optimization
+  if(precision < 0)
+  {
+    Zero();
+    return;
+  }
+  if(precision > bcdPrecision)
+  {
+    // Nothing to be done
+    return;
+  }
+
+  // Walk the mantissa
+  int mant = precision / bcdDigits;
+  int pos  = precision % bcdDigits;
+
+  int mm = m_mantissa[mant];
+
+  if(pos == (bcdDigits - 1))
+  {
+    // Last position in the mantissa part
+    if(mant == (bcdLength - 1))
+    {
+      // Nothing to do. No rounding possible
+      return;
+    }
+    else
+    {
+      int mn = m_mantissa[mant + 1];
+      int digitNext  = mn / (bcdBase / 10);
+
+      if(digitNext >= 5)
+      {
+        // The rounding in optimized form
+        m_mantissa[mant] = ++mm;
+      }
+    }
+  }
+  else
+  {
+    // In-between Optimalization
+    int base = bcdBase;
+    // Calculate base
+    for(int p2 = 0;p2 <= pos; ++p2)
+    {
+      base /= 10;
+    }
+    // Rounding this digit
+    int mantBefore = mm / base;
+    // Next rounding digit
+    int digitNext = mm % base;
+    digitNext /= (base / 10);
+
+    // Rounding
+    if(digitNext >= 5)
+    {
+      // Calculate new mantissa
+      ++mantBefore;
+      int newMant = mantBefore * base;
+      if(pos >= 0)
+      {
+        m_mantissa[mant] = newMant;
+      }
+    }
+    // Strip everything in the mantissa behind the position
+    m_mantissa[mant] /= base;
+    m_mantissa[mant] *= base;
+  }
+
+  // Strip the higher mantissa's
+  for(int m1 = mant + 1;m1 < bcdLength; ++m1)
+  {
+    m_mantissa[m1] = 0;
+  }
+  // Rounding up can carry into the limbs before it (9.99 -> 10.0)
+  for(int m1 = mant; m1 > 0 && m_mantissa[m1] >= bcdBase; --m1)
+  {
+    m_mantissa[m1]     -= bcdBase;
+    m_mantissa[m1 - 1] += 1;
+  }
+  if(m_mantissa[0] >= bcdBase)
+  {
+    m_mantissa[0] /= 10;
+    ++m_exponent;
+  }
+  Normalize();
+}
+
+// Truncate to a specified fraction (decimals behind the .)
+template<int Limbs>
+void
+basic_bcd<Limbs>::Truncate(int p_precision /*=0*/)
+{
+  // Check if we can do a truncate
+  if(!IsValid() || IsNULL())
+  {
+    return;
+  }
+
+  // Precision is dependent on the exponent
+  int precision = p_precision + m_exponent;
+
+  // Quick optimization
+  if(precision <= 0)
+  {
+    // Number totally truncated
+    Zero();
+    return;
+  }
+  if(precision > bcdPrecision)
+  {
+    // Nothing to truncate
+    return;
+  }
+
+  // Walk the mantissa
+  int mant = precision / bcdDigits;
+  int pos  = precision % bcdDigits;
+
+  // Strip everything in the mantissa behind the position
+  if(pos < (bcdDigits - 1))
+  {
+    // Calculate base
+    int base = bcdBase;
+    for(int p2 = 0;p2 <= pos; ++p2)
+    {
+      base /= 10;
+    }
+
+    m_mantissa[mant] /= base;
+    m_mantissa[mant] *= base;
+  }
+
+  // Strip the higher mantissa's
+  if(mant < (bcdLength - 1))
+  {
+    for(int m1 = mant + 1;m1 < bcdLength; ++m1)
+    {
+      m_mantissa[m1] = 0;
+    }
+  }
+}
+
+// Change the sign
+template<int Limbs>
+void
+basic_bcd<Limbs>::Negate()
+{
+  // Check if we can do a negation
+  if(!IsValid() || IsNULL())
+  {
+    return;
+  }
+
+  if(IsZero())
+  {
+    m_sign = Sign::Positive;
+  }
+  else
+  {
+    m_sign = (m_sign == Sign::Positive) ? Sign::Negative : Sign::Positive;
+  }
+}
+
+// Change length and precision
+template<int Limbs>
+void
+basic_bcd<Limbs>::SetLengthAndPrecision(int p_precision /*= bcdPrecision*/,int p_scale /*= (bcdPrecision / 2)*/)
+{
+  // Check if we can set these
+  if(!IsValid() || IsNULL())
+  {
+    return;
+  }
+
+  if(IsZero())
+  {
+    // Optimize for NULL situation
+    return;
+  }
+
+  if(m_exponent > p_precision)
+  {
+    XString error;
+    if(bcd_context::Current().m_throwing)
+    {
+      error.Format(_T("Overflow in BCD at set precision and scale as NUMERIC(%d,%d)"),p_precision,p_scale);
+    }
+    *this = SetInfinity(error,bcd_context::StatusOverflow);
+    return;
+  }
+
+  // Calculate the mantissa position to truncate
+  int mantpos = m_exponent + p_scale + 1;
+
+  // Truncating to zero?
+  if(mantpos <= 0)
+  {
+    m_exponent = 0;
+    memset(m_mantissa,0,sizeof(long) * bcdLength);
+    return;
+  }
+  int mant = mantpos / bcdDigits;
+  int mpos = mantpos % bcdDigits;
+
+  // Strip this on mantissa part
+  if(mpos)
+  {
+    static const int significations[] = {1,10000000,1000000,100000,10000,1000,100,10,1};
+    int  significant = significations[mpos];
+    int64       accu = m_mantissa[mant] / significant;
+    m_mantissa[mant] = (long) (accu * significant);
+  }
+  // Strip the rest of the mantissa
+  for(int index = mant + 1;index < bcdLength; ++index)
+  {
+    m_mantissa[index] = 0;
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////
+//
+// END OF MAKING AN EXACT NUMERIC
+//
+//////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////
+//
+// MATHEMATICAL FUNCTIONS FOR BCD
+//
+//////////////////////////////////////////////////////////////////////////
+
+// bcd::Floor
+// Value before the decimal point
+template<int Limbs>
+basic_bcd<Limbs>
+basic_bcd<Limbs>::Floor() const
+{
+  basic_bcd result;
+  basic_bcd minusOne(-1L);
+
+  // Check if we can do a floor
+  if(IsNULL())
+  {
+    return basic_bcd(Sign::ISNULL);
+  }
+  if(!IsValid())
+  {
+    return SetInfinity(_T("BCD: Infinity doesn't have a floor"));
+  }
+
+  // Shortcut: If number is null. Floor is always zero
+  if(IsZero())
+  {
+    return result;
+  }
+  // Shortcut: if number is a fraction: floor is always zero
+  if(m_exponent < 0)
+  {
+    return m_sign == Sign::Positive ? result : minusOne;
+  }
+  // Shortcut: If number is too big, it's just this number
+  if(m_exponent > bcdDigits * bcdLength)
+  {
+    return *this;
+  }
+  // Find the floor
+  result = SplitMantissa();
+
+  // Take care of sign
+  if(m_sign == Sign::Negative)
+  {
+    // Floor is 1 smaller
+    result -= basic_bcd(1L);
+  }
+  return result;
+}
+
+// bcd::Fraction
+// Description: Value behind the decimal point
+template<int Limbs>
+basic_bcd<Limbs>     
+basic_bcd<Limbs>::Fraction() const
+{
+  return (*this) - Floor();
+}
+
+// bcd::DivMod
+// Description: Truncated quotient and exact remainder of a division in one pass
+// Technical:   The quotient is rounded towards zero (as in the C 'fmod' function)
+//              so the remainder gets the sign of this number.
+//              this = quotient * divisor + remainder
+template<int Limbs>
+void
+basic_bcd<Limbs>::DivMod(const basic_bcd& p_divisor,basic_bcd& p_quotient,basic_bcd& p_remainder) const
+{
+  // Check if we can divide
+  if(!IsValid() || !p_divisor.IsValid())
+  {
+    p_quotient = p_remainder = SetInfinity(_T("Cannot do a modulo with INFINITY"));
+    return;
+  }
+  // NULL always yield a NULL
+  if(IsNULL() || p_divisor.IsNULL())
+  {
+    p_quotient = p_remainder = basic_bcd(Sign::ISNULL);
+    return;
+  }
+  // If divisor is zero -> ERROR
+  if(p_divisor.IsZero())
+  {
+    p_quotient = p_remainder = SetInfinity(_T("BCD: Division by zero."),bcd_context::StatusDivideByZero);
+    return;
+  }
+  // Shortcut: this is smaller than the divisor, so all of it remains
+  if(IsZero() || m_exponent < p_divisor.m_exponent)
+  {
+    p_remainder = *this;
+    p_quotient  = basic_bcd();
+    return;
+  }
+  // Results may be one of the arguments
+  basic_bcd quotient;
+  basic_bcd remainder;
+  PositiveDivMod(*this,p_divisor,quotient,remainder);
+
+  // Take care of the signs
+  if(!quotient.IsZero())
+  {
+    quotient.m_sign = CalculateSign(*this,p_divisor);
+  }
+  if(!remainder.IsZero())
+  {
+    remainder.m_sign = m_sign;
+  }
+  p_quotient  = quotient;
+  p_remainder = remainder;
+}
+
+// Value after the decimal point
+template<int Limbs>
+basic_bcd<Limbs>     
+basic_bcd<Limbs>::Ceiling() const
+{
+  basic_bcd result;
+  basic_bcd one(1);
+
+  // Check if we can do a ceiling
+  if(IsNULL())
+  {
+    return basic_bcd(Sign::ISNULL);
+  }
+  if(!IsValid())
+  {
+    return SetInfinity(_T("BCD: Infinity does not have a ceiling."));
+  }
+
+  // Shortcut: If number is null. Ceiling is always zero
+  if(IsZero())
+  {
+    return result;
+  }
+  // Shortcut: if number is a fraction: ceiling is one or zero
+  if(m_exponent < 0)
+  {
+    return m_sign == Sign::Positive ? one : result;
+  }
+  // Shortcut: If number is too big, it's just this number
+  if(m_exponent > bcdDigits * bcdLength)
+  {
+    return *this;
+  }
+  // Find the floor
+  result = SplitMantissa();
+
+  // Take care of sign
+  if(m_sign == Sign::Positive)
+  {
+    // Floor is 1 smaller
+    result += one;
+  }
+  return result;
+}
+
+#ifndef ALT_SQUAREROOT
+
+// bcd::SquareRoot
+// Description: Do the square root of the bcd
+// Technical:   Reduce by an even power of ten, so 1 <= V < 100
+//              First approximation of U = 1/sqrt(V) by sqrt(double)
+//              Then use Newton's equation U(n+1) = U(n) + U(n)(1 - VU(n)^2)/2
+//              on a precision that doubles each iteration (see NewtonPrecisions).
+//              The last iteration gives the root itself: R = VU + U(V - (VU)^2)/2
+//              The root is truncated as a division: R^2 <= V < (R + ulp)^2
+
+template<int Limbs>
+basic_bcd<Limbs>
+basic_bcd<Limbs>::SquareRoot() const
+{
+  // Check if we can do this
+  if(IsNULL())
+  {
+    return basic_bcd(Sign::ISNULL);
+  }
+  if(!IsValid())
+  {
+    return SetInfinity(_T("BCD: Infinity does not have a square root!"));
+  }
+
+  // Optimalization sqrt(0) = 0
+  if(IsZero())
+  {
+    return basic_bcd();
+  }
+  if(GetSign() == -1)
+  {
+    return SetInfinity(_T("BCD: Cannot get a square root from a negative number."));
+  }
+
+  // Number to get the root from. The root gets half of the even power of ten
+  basic_bcd number(*this);
+  number.m_exponent = (short)(m_exponent & 1);
+  int power = (m_exponent - number.m_exponent) / 2;
+
+  // Only the last rest tells if the root is exact, not the steps in between
+  bcd_context& context = bcd_context::Current();
+  unsigned     status  = context.m_status;
+
+  // First quick guess
+  basic_bcd reciprocal = basic_bcd(1 / ::sqrt(number.AsDouble())).TruncatedLimbs(2);
+
+  // Newton's iteration on the reciprocal root, up to half the mantissa
+  int precisions[bcdLength];
+  int steps = NewtonPrecisions(precisions);
+  const basic_bcd one(1L);
+  const basic_bcd half(_T("0.5"));
+  // The error of a guess with 'known' correct limbs only needs the limbs after them
+  int known = 2;
+  for(int step = 0; step < steps - 1; ++step)
+  {
+    int limbs = precisions[step];
+    basic_bcd square = (reciprocal * reciprocal).TruncatedLimbs(limbs);
+    basic_bcd error  = one - number.TruncatedLimbs(limbs) * square;
+    reciprocal  = (reciprocal + reciprocal * error.TruncatedLimbs(limbs + 1 - known) * half).TruncatedLimbs(limbs);
+    known = limbs;
+  }
+
+  // Last iteration on the full mantissa for the root itself
+  basic_bcd result = (number * reciprocal).TruncatedLimbs(known);
+  basic_bcd error  = FusedMultiplyAdd(-result,result,number);
+  result += reciprocal * error.TruncatedLimbs(bcdLength + 1 - known) * half;
+
+  // Truncate as a division: R^2 <= V < (R + ulp)^2
+  // The rest V - R^2 is exact in the accumulator. With ulp = 10^n
+  // the steps of the rest (R.ulp and ulp^2) are exact numbers
+  Accumulator rest;
+  rest += number;
+  rest.AddProduct(-result,result);
+  basic_bcd below = rest.Result();
+  while(below.GetSign() < 0)
+  {
+    basic_bcd ulp = result.UnitInLastPlace();
+    basic_bcd shifted(result);
+    shifted.m_exponent += ulp.m_exponent;
+    ulp.m_exponent     *= 2;
+    rest += shifted;
+    rest += shifted;
+    rest -= ulp;
+    result -= result.UnitInLastPlace();
+    below = rest.Result();
+  }
+  while(true)
+  {
+    basic_bcd ulp = result.UnitInLastPlace();
+    basic_bcd shifted(result);
+    shifted.m_exponent += ulp.m_exponent;
+    ulp.m_exponent     *= 2;
+    rest -= shifted;
+    rest -= shifted;
+    rest -= ulp;
+    basic_bcd above = rest.Result();
+    if(above.GetSign() < 0)
+    {
+      break;
+    }
+    result += result.UnitInLastPlace();
+    below   = above;
+  }
+  context.m_status = status;
+  RaiseInexact(!below.IsZero());
+
+  result.m_exponent += (short)power;
+  return result;
+}
+
+#else
+
+// Description: Square root of the number
+// What it does: Does an estimation through a double and then
+// Uses the Newton estimation to calculate the root
+template<int Limbs>
+basic_bcd<Limbs>
+basic_bcd<Limbs>::SquareRoot() const
+{
+  basic_bcd number(0L, 0L);
+  basic_bcd half(_T("0.5"));
+  basic_bcd two(2L);
+  basic_bcd three(3L);
+  int sqrti = 0;
+
+  // Optimization: sqrt(0) = 0
+  if (IsNULL())
+  {
+    return number;
+  }
+
+  // Getting the breaking criterion
+  basic_bcd epsilon = Epsilon(10);
+
+  number = *this; // Number to get the square-root from
+  if (number.GetSign() == -1)
+  {
+    return SetInfinity(_T("BCD: Infinity does not have a square root!"));
+  }
+  // First estimate
+  double estimate1 = number.AsDouble() / 2;
+  double estimate2 = 1 / sqrt(estimate1);
+  basic_bcd result(estimate1);
+  basic_bcd between;
+
+  // Newton's iteration
+  basic_bcd last_result(_T("0.0"));
+
+  while (true)
+  {
+    result = (result + number / result) / two;
+    between = last_result - result;
+    if (between.AbsoluteValue() < epsilon)
+    {
+      break;
+    }
+
+    last_result = result;
+  }
+  return result;
+}
+#endif
+
+// bcd::Power
+// Description: Get BCD number to a power
+// Technical:   A whole power (up to 18 digits) by square-and-multiply. Every product
+//              is rounded once from the full product, so a result that fits in the
+//              mantissa is exact. A negative power takes one reciprocal at the end.
+//              Other powers: x^y = exp(y * ln(x))
+template<int Limbs>
+basic_bcd<Limbs>
+basic_bcd<Limbs>::Power(const basic_bcd& p_power) const
+{
+  basic_bcd result;
+
+  // Check if we can do this
+  if(IsNULL())
+  {
+    return basic_bcd(Sign::ISNULL);
+  }
+  if(!IsValid())
+  {
+    return SetInfinity(_T("BCD: Can not take a power of infinity!"));
+  }
+
+  // Whole powers: also for a negative number or zero
+  if(p_power.IsValid() && p_power.m_exponent < 18 && !p_power.GetHasDecimals())
+  {
+    const basic_bcd zero;
+    int64     power  = p_power.AsInt64();
+    uint64    count  = (power < 0) ? (0 - (uint64)power) : (uint64)power;
+    basic_bcd square(*this);
+    result = basic_bcd(1);
+    while(count)
+    {
+      if(count & 1)
+      {
+        result = FusedMultiplyAdd(result,square,zero);
+      }
+      count >>= 1;
+      if(count)
+      {
+        square = FusedMultiplyAdd(square,square,zero);
+      }
+    }
+    return (power < 0) ? result.Reciprocal() : result;
+  }
+
+  // Rounded once, as the integer digits of the exponent cost digits of the result
+  result = FusedMultiplyAdd(Log(),p_power,basic_bcd());
+  result = result.Exp();
+
+  return result;
+}
+
+// bcd::AbsoluteValue
+// Description: Return the absolute value
+template<int Limbs>
+basic_bcd<Limbs>
+basic_bcd<Limbs>::AbsoluteValue() const
+{
+  // Check if we can do this
+  if(IsNULL())
+  {
+    return basic_bcd(Sign::ISNULL);
+  }
+  if(!IsValid())
+  {
+    return SetInfinity(_T("BCD: Can change the sign of infinity!"));
+  }
+  basic_bcd result(*this);
+  result.m_sign = Sign::Positive;
+  return result;
+}
+
+// bcd::Reciprocal
+// Description: Reciprocal / Inverse = 1/x
+// Technical:   The long division takes a whole limb per step. Measured on x64 this
+//              is faster than a Newton iteration (as in SquareRoot) for all widths
+//              up to bcdMaxLength, as the iteration needs an exact rest to truncate.
+template<int Limbs>
+basic_bcd<Limbs>     
+basic_bcd<Limbs>::Reciprocal() const
+{
+  // Check if we can do this
+  if(IsNULL())
+  {
+    return basic_bcd(Sign::ISNULL);
+  }
+  if(!IsValid())
+  {
+    return SetInfinity(_T("BCD: Can do the reciprocal of infinity!"));
+  }
+  basic_bcd result = basic_bcd(1) / *this;
+  return result;
+}
+
+// bcd::Log
+// Description: Natural logarithm
+// Technical:   Take out the powers of ten and two: x = 10^e * 2^k * y
+//              with y between 0.7 and 1.42. Two tables of ln(1 + j/32) and
+//              ln(1 + j/2048) bring y to 1 + r with |r| < 1/4096.
+//              Every step is one division by a small integer.
+//              ln(x) = e * ln(10) + k * ln(2) + ln(1 + j1/32) + ln(1 + j2/2048) + ln(1 + r)
+//              The last part is a short Taylor series, all parts are added exactly
+//              Equivalent with the same standard C function call
+template<int Limbs>
+basic_bcd<Limbs>     
+basic_bcd<Limbs>::Log() const
+{
+  // Check if we can do this
+  if(IsNULL())
+  {
+    return basic_bcd(Sign::ISNULL);
+  }
+  if((GetSign() == -1) || IsZero() || !IsValid())
+  { 
+    return SetInfinity(_T("BCD: Cannot calculate a natural logarithm of a number <= 0"));
+  }
+
+  // Take out the power of ten, but keep [0.5-1.0> as it is,
+  // so no digits cancel out in numbers just below one.
+  basic_bcd number(*this);
+  int expo = m_exponent;
+  if(expo == -1 && m_mantissa[0] >= bcdBase / 2)
+  {
+    expo = 0;
+  }
+  number.m_exponent -= (short)expo;
+
+  // Nearest power of two and nearest step of the first table
+  // 1 + r = number / (2^k * (1 + j/32)) = (32 * number - d) / d + 1
+  double approx = number.AsDouble();
+  int power = (int)floor(log(approx) / log(2.0) + 0.5);
+  approx   /= pow(2.0,power);
+  int steps[logTableLevels];
+  steps[0]  = (int)floor((approx - 1.0) * logTableSteps[0] + 0.5);
+
+  int divisor = logTableSteps[0] + steps[0];
+  if(power >= 0)
+  {
+    divisor <<= power;
+    number *= logTableSteps[0];
+  }
+  else
+  {
+    number *= logTableSteps[0] << -power;
+  }
+  basic_bcd reduced = (number - basic_bcd(divisor)) / divisor;
+
+  // Next tables: 1 + r' = (1 + r) / (1 + j/steps) = (steps * r - j) / (steps + j) + 1
+  for(int level = 1; level < logTableLevels; ++level)
+  {
+    steps[level] = (int)floor(reduced.AsDouble() * logTableSteps[level] + 0.5);
+    if(steps[level])
+    {
+      reduced = (reduced * logTableSteps[level] - basic_bcd(steps[level])) / (logTableSteps[level] + steps[level]);
+    }
+  }
+
+  // Add all parts in one accumulator
+  Accumulator sum;
+  if(expo)
+  {
+    // Ln(x^y) = Ln(x) + Ln(10^y) = Ln(x) + y * ln(10)
+    sum.AddProduct(basic_bcd(expo),LN10());
+    sum.AddProduct(basic_bcd(expo),LN10Tail());
+  }
+  if(power)
+  {
+    sum.AddProduct(basic_bcd(power),LN2());
+  }
+  for(int level = 0; level < logTableLevels; ++level)
+  {
+    if(steps[level])
+    {
+      sum += LogTable(level,steps[level]);
+    }
+  }
+  if(!reduced.IsZero())
+  {
+    // ln(1 + r) = ln((1 + z) / (1 - z)) with z = r / (2 + r)
+    sum += LogSeries(reduced / (reduced + basic_bcd(2)));
+  }
+  return sum.Result();
+}
+
+// bcd::LogSeries
+// Description: Natural logarithm of (1 + z) / (1 - z) for a small z
+// Technical:   Use a Taylor series until there is no more change in the result
+//              ln((1 + z) / (1 - z)) == 2( z + z^3/3 + z^5/5 ... )
+//              The terms go into an accumulator and are rounded once.
+template<int Limbs>
+basic_bcd<Limbs>
+basic_bcd<Limbs>::LogSeries(const basic_bcd& p_ratio)
+{
+  Accumulator sum;
+  basic_bcd z2 = p_ratio * p_ratio;
+  basic_bcd power = p_ratio * 2;
+  basic_bcd term(power);
+  int last = power.m_exponent - bcdPrecision - 1;
+  for(int step = 3; !term.IsZero() && term.m_exponent >= last; step += 2)
+  {
+    sum += term;
+    power *= z2;
+    term   = power / step;
+  }
+  return sum.Result();
+}
+
+// bcd::LogTable
+// Description: ln(1 + p_step / logTableSteps[p_level]) for the reduction of Log
+// Technical:   Calculated once for each width on the first use
+//              1 + j/n = (1 + z) / (1 - z) with z = j / (2n + j)
+template<int Limbs>
+const basic_bcd<Limbs>&
+basic_bcd<Limbs>::LogTable(int p_level,int p_step)
+{
+  struct Table
+  {
+    Table()
+    {
+      for(int level = 0; level < logTableLevels; ++level)
+      {
+        for(int step = -logTableReach[level]; step <= logTableReach[level]; ++step)
+        {
+          m_values[level][step + logTableRoom] = LogSeries(basic_bcd(step) / (2 * logTableSteps[level] + step));
+        }
+      }
+    }
+    basic_bcd m_values[logTableLevels][2 * logTableRoom + 1];
+  };
+  static const Table table;
+
+  return table.m_values[p_level][p_step + logTableRoom];
+}
+
+// bcd::exp
+// Description: Exponent e tot the power 'this number'
+// Technical:   Reduce to x = n * ln(10) + r, so exp(x) = exp(r) * 10^n
+//              and the power of ten is a shift of the exponent.
+//              The nearest step j/32 of a table takes r further down:
+//              exp(r) = exp(j/32) * exp(r - j/32), with |r - j/32| <= 1/64
+//              and a second table with steps of 1/2048 takes it to 1/4096.
+//              Only a short Taylor series remains for the last part
+//              exp(x) == 1 + x + x^2/2!+x^3/3!+....
+//              Equivalent with the same standard C function call
+//
+template<int Limbs>
+basic_bcd<Limbs>
+basic_bcd<Limbs>::Exp() const
+{
+  // Check if we can do this
+  if(IsNULL())
+  {
+    return basic_bcd(Sign::ISNULL);
+  }
+  if(!IsValid())
+  {
+    return SetInfinity(_T("BCD: Cannot take the exponent of infinity!"));
+  }
+
+  // Can not calculate: will always be one!
+  if(IsZero())
+  {
+    return basic_bcd(1);
+  }
+
+  // From 1E6 onwards the power of ten is out of the range of the exponent
+  basic_bcd result;
+  if(m_exponent > 5)
+  {
+    ExponentOutOfRange(m_sign == Sign::Negative ? SHRT_MIN - 1 : SHRT_MAX + 1,Sign::Positive,result);
+    return result;
+  }
+
+  // Nearest multiple of ln(10). The product with ln(10) is taken in two parts:
+  // the tail of the constant makes up for the digits that n * LN10() lacks
+  int power = (int)floor(AsDouble() / log(10.0) + 0.5);
+  basic_bcd reduced(*this);
+  if(power)
+  {
+    basic_bcd factor(-power);
+    reduced = FusedMultiplyAdd(factor,LN10(),reduced);
+    reduced = FusedMultiplyAdd(factor,LN10Tail(),reduced);
+  }
+
+  // Nearest step of the tables
+  int steps[expTableLevels];
+  for(int level = 0; level < expTableLevels; ++level)
+  {
+    steps[level] = (int)floor(reduced.AsDouble() * expTableSteps[level] + 0.5);
+    if(steps[level])
+    {
+      reduced -= basic_bcd(steps[level]) / expTableSteps[level];
+    }
+  }
+
+  // Rebuild with the products of the tables and the power of ten in the exponent
+  result = ExpSeries(reduced);
+  for(int level = 0; level < expTableLevels; ++level)
+  {
+    result = FusedMultiplyAdd(ExpTable(level,steps[level]),result,basic_bcd());
+  }
+  int exponent = result.m_exponent + power;
+  if(!ExponentOutOfRange(exponent,Sign::Positive,result))
+  {
+    result.m_exponent = (short)exponent;
+  }
+  return result;
+}
+
+// bcd::ExpSeries
+// Description: Taylor series of exp for a small number (|x| < 2)
+// Technical:   exp(x) == 1 + x + x^2/2!+x^3/3!+....
+//              The terms go into an accumulator and are rounded once.
+//              Stops if a term is below the last digit of the result
+template<int Limbs>
+basic_bcd<Limbs>
+basic_bcd<Limbs>::ExpSeries(const basic_bcd& p_number)
+{
+  Accumulator sum;
+  sum += basic_bcd(1);
+
+  basic_bcd term(p_number);
+  for(int step = 2; !term.IsZero() && term.m_exponent >= -bcdPrecision - 1; ++step)
+  {
+    sum += term;
+    term = (term * p_number) / step;
+  }
+  return sum.Result();
+}
+
+// bcd::ExpTable
+// Description: exp(p_step / expTableSteps[p_level]) for the reduction of Exp
+// Technical:   Calculated once for each width on the first use
+template<int Limbs>
+const basic_bcd<Limbs>&
+basic_bcd<Limbs>::ExpTable(int p_level,int p_step)
+{
+  struct Table
+  {
+    Table()
+    {
+      for(int level = 0; level < expTableLevels; ++level)
+      {
+        for(int step = -expTableReach; step <= expTableReach; ++step)
+        {
+          m_values[level][step + expTableReach] = ExpSeries(basic_bcd(step) / expTableSteps[level]);
+        }
+      }
+    }
+    basic_bcd m_values[expTableLevels][2 * expTableReach + 1];
+  };
+  static const Table table;
+
+  return table.m_values[p_level][p_step + expTableReach];
+}
+
+// bcd::Log10
+// Description: Logarithm in base 10
+// Technical:   log10 = ln(x) / ln(10);
+template<int Limbs>
+basic_bcd<Limbs>     
+basic_bcd<Limbs>::Log10() const
+{
+  basic_bcd res;
+
+  // Check if we can do a LOG10
+  if(IsNULL())
+  {
+    return basic_bcd(Sign::ISNULL);
+  }
+  if(!IsValid())
+  {
+    return SetInfinity(_T("BCD: Cannot take the Log10 of infinity!"));
+  }
+  if(GetSign() <= 0) 
+  { 
+    return SetInfinity(_T("BCD: Cannot get a 10-logarithm of a number <= 0"));
+  }
+  res = *this;
+  res = res.Log() / LN10();
+
+  return res;
+}
+
+// Ten Power
+// Description: bcd . 10^n
+// Technical:   add n to the exponent of the number
+template<int Limbs>
+basic_bcd<Limbs>
+basic_bcd<Limbs>::TenPower(int n)
+{
+  // Check if we can do this
+  if(IsNULL())
+  {
+    return basic_bcd(Sign::ISNULL);
+  }
+  if(!IsValid())
+  {
+    return SetInfinity(_T("BCD: Cannot take the 10th power of infinity!"));
+  }
+  basic_bcd res = *this;
+  res.m_exponent += (short)n;
+  res.Normalize();
+  
+  return res;
+}
+
+//////////////////////////////////////////////////////////////////////////
+//
+// END OF MATHEMATICAL FUNCTIONS FOR BCD
+//
+//////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////
+//
+// BCD TRIGONOMETRIC FUNCTIONS
+//
+//////////////////////////////////////////////////////////////////////////
+
+// bcd::Sine
+// Description: Sine of the angle
+// Technical:   Reduce the angle to [-PI/4,PI/4] and the quadrant (see ReduceAngle)
+//              In quadrant 1 and 3 the sine is the cosine of the reduced angle.
+//              Then do the Taylor expansion series Sin(x) = x - x^3/3! + x^5/5! ...
+//
+template<int Limbs>
+basic_bcd<Limbs>
+basic_bcd<Limbs>::Sine() const
+{
+  // Check if we can do this
+  if(IsNULL())
+  {
+    return basic_bcd(Sign::ISNULL);
+  }
+  if(!IsValid())
+  {
+    return SetInfinity(_T("BCD: Cannot take the sine of infinity!"));
+  }
+
+  basic_bcd angle;
+  basic_bcd result;
+  int quadrant = ReduceAngle(angle);
+  if(quadrant < 0)
+  {
+    return angle;
+  }
+  if(quadrant & 1)
+  {
+    TrigSeries(angle,nullptr,&result);
+  }
+  else
+  {
+    TrigSeries(angle,&result,nullptr);
+  }
+  // Sine is negative in quadrant 2 and 3
+  return (quadrant >= 2) ? -result : result;
+}
+
+// bcd::Cosine
+// Description: Cosine of the angle
+// Technical:   Reduce the angle to [-PI/4,PI/4] and the quadrant (see ReduceAngle)
+//              In quadrant 1 and 3 the cosine is the sine of the reduced angle.
+//              Then do the Taylor expansion series Cos(x) = 1 - x^2/2! + x^4/4! ...
+//
+template<int Limbs>
+basic_bcd<Limbs>
+basic_bcd<Limbs>::Cosine() const
+{
+  // Check if we can do this
+  if(IsNULL())
+  {
+    return basic_bcd(Sign::ISNULL);
+  }
+  if(!IsValid())
+  {
+    return SetInfinity(_T("BCD: Cannot take the cosine of infinity!"));
+  }
+
+  basic_bcd angle;
+  basic_bcd result;
+  int quadrant = ReduceAngle(angle);
+  if(quadrant < 0)
+  {
+    return angle;
+  }
+  if(quadrant & 1)
+  {
+    TrigSeries(angle,&result,nullptr);
+  }
+  else
+  {
+    TrigSeries(angle,nullptr,&result);
+  }
+  // Cosine is negative in quadrant 1 and 2
+  return (quadrant == 1 || quadrant == 2) ? -result : result;
+}
+
+// bcd::SinCos
+// Description: Sine and cosine of the same angle in one go
+// Technical:   One reduction of the angle for both (see ReduceAngle)
+//              and both Taylor series in the same loop
+//
+template<int Limbs>
+void
+basic_bcd<Limbs>::SinCos(basic_bcd& p_sine,basic_bcd& p_cosine) const
+{
+  // Check if we can do this
+  if(IsNULL())
+  {
+    p_sine   = basic_bcd(Sign::ISNULL);
+    p_cosine = basic_bcd(Sign::ISNULL);
+    return;
+  }
+  if(!IsValid())
+  {
+    p_sine   = SetInfinity(_T("BCD: Cannot take the sine or cosine of infinity!"));
+    p_cosine = p_sine;
+    return;
+  }
+
+  basic_bcd angle;
+  basic_bcd sine;
+  basic_bcd cosine;
+  int quadrant = ReduceAngle(angle);
+  if(quadrant < 0)
+  {
+    p_sine   = angle;
+    p_cosine = angle;
+    return;
+  }
+  TrigSeries(angle,&sine,&cosine);
+
+  // Rotate by the quadrant
+  p_sine   = (quadrant & 1) ? cosine : sine;
+  p_cosine = (quadrant & 1) ? sine : cosine;
+  if(quadrant >= 2)
+  {
+    p_sine = -p_sine;
+  }
+  if(quadrant == 1 || quadrant == 2)
+  {
+    p_cosine = -p_cosine;
+  }
+}
+
+// bcd::Tangent
+// Description: Tangent of the angle
+// Technical:   Sine / Cosine from one reduction of the angle (see SinCos)
+//
+template<int Limbs>
+basic_bcd<Limbs>
+basic_bcd<Limbs>::Tangent() const
+{
+  // Check if we can do this
+  if(IsNULL())
+  {
+    return basic_bcd(Sign::ISNULL);
+  }
+  if(!IsValid())
+  {
+    return SetInfinity(_T("BCD: Cannot take the tangent of infinity!"));
+  }
+
+  basic_bcd sine;
+  basic_bcd cosine;
+  SinCos(sine,cosine);
+  if(!cosine.IsValid())
+  {
+    return cosine;
+  }
+  if(cosine.IsZero())
+  { 
+    return SetInfinity(_T("BCD: Cannot calculate a tangent from a angle of 1/2 pi or 3/2 pi"),bcd_context::StatusDivideByZero);
+  }
+  return sine / cosine;
+}
+
+// bcd::ReduceAngle
+// Description: Reduce the angle to [-PI/4,PI/4] for the trigonometric functions
+// Technical:   x = n * PI/2 + r. Returns the quadrant (n modulo 4) and sets r.
+//              The product with PI is taken in two parts: the tail of the
+//              constant makes up for the digits that n * PI() lacks,
+//              so even large angles keep all digits of r.
+//              n / 2 must be exact in the mantissa. A larger angle has no
+//              digits left for r: it gets NaN (StatusInvalid) and returns -1.
+//
+template<int Limbs>
+int
+basic_bcd<Limbs>::ReduceAngle(basic_bcd& p_angle) const
+{
+  // Nearest multiple of PI/2
+  basic_bcd multiple;
+  if(m_exponent < 9)
+  {
+    multiple = basic_bcd((long)floor(AsDouble() / acos(0.0) + 0.5));
+  }
+  else
+  {
+    multiple = (*this / PI() * 2 + basic_bcd(_T("0.5"))).Floor();
+  }
+  if(multiple.IsZero())
+  {
+    p_angle = *this;
+    return 0;
+  }
+  if(multiple.m_exponent >= bcdPrecision - 1)
+  {
+    p_angle = SetInfinity(_T("BCD: The angle is too large to reduce to [-PI/4,PI/4]"));
+    p_angle.m_sign = Sign::NaN;
+    return -1;
+  }
+
+  // r = x - (n / 2) * PI
+  basic_bcd factor = -multiple / 2;
+  p_angle = FusedMultiplyAdd(factor,PI(),*this);
+  p_angle = FusedMultiplyAdd(factor,PITail(),p_angle);
+
+  int quadrant = (int)(multiple % 4).AsLong();
+  return (quadrant < 0) ? quadrant + 4 : quadrant;
+}
+
+// bcd::TrigSeries
+// Description: Taylor series of sine and/or cosine of an angle in [-PI/4,PI/4]
+// Technical:   Sin(x) = x - x^3/3! + x^5/5! ...
+//              Cos(x) = 1 - x^2/2! + x^4/4! ...
+//              Both series share the square of the angle and the loop.
+//              The terms go into an accumulator and are rounded once.
+//              Pass a nullptr for a series that is not needed.
+//
+template<int Limbs>
+void
+basic_bcd<Limbs>::TrigSeries(const basic_bcd& p_angle,basic_bcd* p_sine,basic_bcd* p_cosine)
+{
+  Accumulator sine;
+  Accumulator cosine;
+  basic_bcd zero;
+  basic_bcd square = FusedMultiplyAdd(p_angle,p_angle,zero);
+  basic_bcd odd(p_angle);
+  basic_bcd even(1);
+  // Stop if a term is below the last digit of the result
+  int lastOdd  = p_angle.m_exponent - bcdPrecision - 1;
+  int lastEven = -bcdPrecision - 1;
+  bool doOdd   = p_sine   != nullptr;
+  bool doEven  = p_cosine != nullptr;
+
+  for(int step = 2; doOdd || doEven; step += 2)
+  {
+    doOdd  = doOdd  && !odd.IsZero()  && odd.m_exponent  >= lastOdd;
+    doEven = doEven && !even.IsZero() && even.m_exponent >= lastEven;
+    if(doOdd)
+    {
+      sine += odd;
+      odd   = FusedMultiplyAdd(-odd,square,zero) / (step * (step + 1));
+    }
+    if(doEven)
+    {
+      cosine += even;
+      even    = FusedMultiplyAdd(-even,square,zero) / (step * (step - 1));
+    }
+  }
+  if(p_sine)
+  {
+    *p_sine = sine.Result();
+  }
+  if(p_cosine)
+  {
+    *p_cosine = cosine.Result();
+  }
+}
+
+// bcd::Asine
+// Description: ArcSine (angle) of the ratio
+// Technical:   Use Newton by solving the equation Sin(y)=x. Then y is Arcsine(x)
+//              Iterate by Newton y'=y-(sin(y)-x)/cos(y). 
+//              With initial guess using standard double precision arithmetic.
+// 
+template<int Limbs>
+basic_bcd<Limbs>     
+basic_bcd<Limbs>::ArcSine() const
+{
+  long step, reduction, sign;
+  double d;
+  basic_bcd between, number, result, factor;
+  basic_bcd c1(1);
+  basic_bcd c2(2);
+  basic_bcd c05(_T("0.5"));
+  basic_bcd epsilon = Epsilon(5);
+
+  // Check if we can do this
+  if(IsNULL())
+  {
+    return basic_bcd(Sign::ISNULL);
+  }
+  if(!IsValid())
+  {
+    return SetInfinity(_T("BCD: Cannot take the arcsine of infinity!"));
+  }
+
+  number = *this;
+  if(number > c1 || number < -c1)
+  {
+    return SetInfinity(_T("BCD: Cannot calculate an arcsine from a number > 1 or < -1"));
+  }
+
+  // Save the sign
+  sign = number.GetSign();
+  if(sign < 0)
+  {
+    number = -number;
+  }
+
+  // Reduce the argument to below 0.5 to make the newton run faster
+  for(reduction = 0; number > c05; ++reduction)
+  {
+    number /= sqrt(c2) * sqrt( c1 + sqrt( c1 - number * number ));
+  }
+  // Quick approximation of the asin
+  d = ::asin(number.AsDouble());
+  result = basic_bcd( d );
+  factor = basic_bcd( 1.0 / ::cos(d)); // Constant factor 
+
+  // Newton Iteration
+  for( step=0;; step++)
+  {
+    between = ( result.Sine() - number ) * factor;
+    // if( y - r == y )
+    if(between.AbsoluteValue() < epsilon)
+    {
+      break;
+    }
+    result -= between;
+  }
+
+  // Repair the reduction in the result
+  result *= basic_bcd((long) (1 << reduction) );
+
+  // Take care of sign
+  if( sign < 0 )
+  {
+    result = -result;
+  }
+
+  // this is the result
+  return result;
+}
+
+// bcd::ArcCosine
+// Description: ArcCosine (angle) of the ratio
+// Technical:   Use ArcCosine(x) = PI/2 - ArcSine(x)
+template<int Limbs>
+basic_bcd<Limbs>     
+basic_bcd<Limbs>::ArcCosine() const
+{
+  basic_bcd y;
+
+  // Check if we can do this
+  if(IsNULL())
+  {
+    return basic_bcd(Sign::ISNULL);
+  }
+  if(!IsValid())
+  {
+    return SetInfinity(_T("BCD: Cannot take the arc-cosine of infinity!"));
+  }
+
+  y  = PI();
+  y /= basic_bcd(2L);
+  y -= ArcSine();
+
+  return y;
+}
+
+// bcd::ArcTangent
+// Description: ArcTangent (angle) of the ratio
+// Technical:   Use the Taylor series. ArcTan(x) = x - x^3/3 + x^5/5 ...
+//              However first reduce x to abs(x)< 0.5 to improve taylor series
+//              using the identity. ArcTan(x)=2*ArcTan(x/(1+sqrt(1+x^2)))
+//
+template<int Limbs>
+basic_bcd<Limbs>
+basic_bcd<Limbs>::ArcTangent() const
+{
+  basic_bcd  result, square;
+  basic_bcd  between1,between2;
+  basic_bcd  half(_T("0.5"));
+  basic_bcd  one(1);
+  basic_bcd  epsilon = Epsilon(5);
+  long k = 2;
+
+  // Check if we can do this
+  if(IsNULL())
+  {
+    return basic_bcd(Sign::ISNULL);
+  }
+  if(!IsValid())
+  {
+    return SetInfinity(_T("BCD: Cannot take the arc-tangent of infinity!"));
+  }
+
+  result   = *this;
+  // Transform the solution to ArcTan(x)=2*ArcTan(x/(1+sqrt(1+x^2)))
+  result = result / ( one + sqrt( one + (result * result)));
+  if( result.AbsoluteValue() > half) // if still to big then do it again
+  {
+    k = 4;
+    result = result / (one + sqrt(one + (result * result)));
+  }
+  square = result * result;
+  between1  = result;
+  // Now iterate using Taylor expansion
+  for(long step = 3;; step += 2)
+  {
+    between1 *= square;
+    between1  = -between1;
+    between2  = between1 / (int)step;
+    // Tolerance criterion
+    if(between2.AbsoluteValue() < epsilon)
+    {
+      break;
+    }
+    result += between2;
+  }
+
+  // Reapply the reduction/transformation
+  result *= basic_bcd(k);
+
+  // this is the result
+  return result;
+}
+
+// bcd::Atan2
+// Description: Angle of two points
+// Technical:   return the angle (in radians) from the X axis to a point (y,x).
+//              use atan() to calculate atan2()
+//
+template<int Limbs>
+basic_bcd<Limbs>
+basic_bcd<Limbs>::ArcTangent2Points(const basic_bcd& p_x) const
+{
+  basic_bcd result;
+  basic_bcd number = *this;
+  basic_bcd nul, c05(_T("0.5"));
+
+  // Check if we can do this
+  if(IsNULL())
+  {
+    return basic_bcd(Sign::ISNULL);
+  }
+  if(!IsValid() || !p_x.IsValid())
+  {
+    return SetInfinity(_T("BCD: Cannot take the arc-tangent-2 of infinity!"));
+  }
+
+  if( p_x == nul && number == nul)
+  {
+    return nul;
+  }
+  if( p_x == nul )
+  {
+    result = PI();
+    if( number < nul )
+    {
+      result *= -c05;
+    }
+    else
+    {
+      result *= c05;
+    }
+  }
+  else
+  {
+    if( number == nul )
+    {
+      if( p_x < nul )
+      {
+        result = PI();
+      }
+      else
+      {
+        result = nul;
+      }
+    }
+    else
+    {
+      result = basic_bcd( number / p_x ).ArcTangent();
+      if( p_x < nul  && number < nul )
+      {
+        result -= PI();
+      }
+      if( p_x < nul && number >= nul )
+      {
+        result += PI();
+      }
+    }
+  }
+  return result;
+}
+
+//////////////////////////////////////////////////////////////////////////
+//
+// END OF BCD TRIGONOMETRIC FUNCTIONS
+//
+//////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////
+//
+// GET AS SOMETHING DIFFERENT THAN THE BCD
+//
+//////////////////////////////////////////////////////////////////////////
+
+// bcd::AsDouble
+// Description: Get as a double
+//
+template<int Limbs>
+double  
+basic_bcd<Limbs>::AsDouble() const
+{
+  double result = 0.0;
+
+  // Check if we have a result
+  if(!IsValid() || IsNULL())
+  {
+    return result;
+  }
+
+  if(bcdDigits >= 8)
+  {
+    // SHORTCUT FOR PERFORMANCE: 
+    // A double cannot have more than 16 digits
+    // so everything over 16 digits gets discarded
+    result  = ((double)m_mantissa[0]) * 10.0 / (double) bcdBase;
+    result += ((double)m_mantissa[1]) * 10.0 / (double) bcdBase / (double) bcdBase;
+    //result += ((double)m_mantissa[2]) / bcdBase / bcdBase / bcdBase;
+  }
+  else
+  {
+    // Works for ALL implementations of bcdDigits  and bcdLength
+    // Get the mantissa into the result
+    double factor = 1.0;
+    for(int ind = 0; ind < bcdLength; ++ind)
+    {
+      long base    = bcdBase / 10;
+      long between = m_mantissa[ind];
+
+      for(int pos = bcdDigits; pos > 0; --pos)
+      {
+        // Get next number
+        long number = between / base;
+        between %= base;
+        base /= 10;
+
+        // Set in the result
+        result += (double)number * factor;
+        factor /= 10;
+      }
+    }
+  }
+
+  // Take care of exponent
+  if(m_exponent)
+  {
+    result *= ::pow(10.0,m_exponent);
+  }
+  // Take care of the sign
+  if(m_sign == Sign::Negative)
+  {
+    result = -result;
+  }
+  return result;
+}
+
+// bcd::AsShort
+// Description: Get as a short
+template<int Limbs>
+short   
+basic_bcd<Limbs>::AsShort() const
+{
+  // Check if we have a result
+  if(!IsValid() || IsNULL())
+  {
+    return 0;
+  }
+
+  // Quick check for zero
+  if(m_exponent < 0)
+  {
+    return 0;
+  }
+  int exponent = bcdDigits - m_exponent - 1;
+
+  // Get from the mantissa
+  int result = m_mantissa[0];
+
+  // Adjust to exponent
+  while(exponent--)
+  {
+    result /= 10;
+  }
+
+  // Take care of sign and over/under flows
+  if(m_sign == Sign::Positive)
+  {
+    if(result > SHORT_MAX)
+    {
+      ConversionError(_T("BCD: Overflow in conversion to short number."));
+      return 0;
+    }
+  }
+  else
+  {
+    if(result < SHORT_MIN)
+    {
+      ConversionError(_T("BCD: Underflow in conversion to short number."));
+      return 0;
+    }
+    result = -result;
+  }
+  return (short) result;
+}
+
+// bcd::AsUShort
+// Description: Get as an unsigned short
+template<int Limbs>
+ushort  
+basic_bcd<Limbs>::AsUShort() const
+{
+  // Check if we have a result
+  if(!IsValid() || IsNULL())
+  {
+    return 0;
+  }
+
+  // Check for unsigned
+  if(m_sign == Sign::Negative)
+  {
+    ConversionError(_T("BCD: Cannot convert a negative number to an unsigned short number."),bcd_context::StatusInvalid);
+    return 0;
+  }
+  // Quick check for zero
+  if(m_exponent < 0)
+  {
+    return 0;
+  }
+
+  // Get from the mantissa
+  int result = m_mantissa[0];
+
+  // Adjust to exponent
+  int exponent = bcdDigits - m_exponent - 1;
+  while(exponent--)
+  {
+    result /= 10;
+  }
+
+  // Take care of overflow
+  if(result > USHORT_MAX)
+  {
+    ConversionError(_T("BCD: Overflow in conversion to unsigned short number."));
+    return 0;
+  }
+
+  return (short)result;
+}
+
+// bcd::AsLong
+// Description: Get as a long
+template<int Limbs>
+long    
+basic_bcd<Limbs>::AsLong() const
+{
+  // Check if we have a result
+  if(!IsValid() || IsNULL())
+  {
+    return 0;
+  }
+
+  // Quick optimization for really small numbers
+  if(m_exponent < 0)
+  {
+    return 0L;
+  }
+
+  // Get from the mantissa
+  int64 result = ((int64)m_mantissa[0] * bcdBase) + ((int64)m_mantissa[1]);
+
+  // Adjust to exponent
+  int exponent = 2 * bcdDigits - m_exponent - 1;
+  if(exponent > 0)
+  {
+    while(exponent--)
+    {
+      result /= 10;
+    }
+  }
+
+  // Take care of sign and over/under flows
+  if(m_sign == Sign::Positive)
+  {
+    if(result > LONG_MAX)
+    {
+      ConversionError(_T("BCD: Overflow in conversion to integer number."));
+      return 0;
+    }
+  }
+  else
+  {
+    if(result < LONG_MIN)
+    {
+      ConversionError(_T("BCD: Underflow in conversion to integer number."));
+      return 0;
+    }
+    result = -result;
+  }
+  return (long) result;
+}
+
+// bcd::AsULong
+// Get as an unsigned long
+template<int Limbs>
+ulong   
+basic_bcd<Limbs>::AsULong() const
+{
+  // Check if we have a result
+  if(!IsValid() || IsNULL())
+  {
+    return 0;
+  }
+
+  // Check for unsigned
+  if(m_sign == Sign::Negative)
+  {
+    ConversionError(_T("BCD: Cannot convert a negative number to an unsigned long."),bcd_context::StatusInvalid);
+    return 0;
+  }
+
+  // Quick optimization for really small numbers
+  if(m_exponent < 0)
+  {
+    return 0L;
+  }
+
+  // Get from the mantissa
+  int64 result = ((int64)m_mantissa[0] * bcdBase) + ((int64)m_mantissa[1]);
+
+  // Adjust to exponent
+  int exponent = 2 * bcdDigits - m_exponent - 1;
+  while(exponent--)
+  {
+    result /= 10;
+  }
+
+  // Take care of overflow
+  if(result > ULONG_MAX)
+  {
+    ConversionError(_T("BCD: Overflow in conversion to unsigned long integer."));
+    return 0;
+  }
+  return (long)result;
+}
+
+// bcd::AsInt64
+// Description: Get as a 64 bits long number
+//
+template<int Limbs>
+int64
+basic_bcd<Limbs>::AsInt64() const
+{
+  // Check if we have a result
+  if(!IsValid() || IsNULL())
+  {
+    return 0;
+  }
+
+  // Quick optimization for really small numbers
+  if(m_exponent < 0)
+  {
+    return 0L;
+  }
+  int64 result1 = 0L;
+  int64 result2 = 0L;
+  int exponent  = 4 * bcdDigits - m_exponent - 1;
+  int64 base2   = (int64)bcdBase * ((int64)bcdBase);
+  int64 base    = base2 / 10;
+
+  // Get from the mantissa (zero beyond the length of the mantissa)
+  long mantissa[4] = { 0 };
+  memcpy(mantissa,m_mantissa,(bcdLength < 4 ? bcdLength : 4) * sizeof(long));
+  result1 = ((int64)mantissa[0] * bcdBase) + ((int64)mantissa[1]);
+  result2 = ((int64)mantissa[2] * bcdBase) + ((int64)mantissa[3]);
+
+  // Adjust to exponent
+  while(exponent--)
+  {
+    int64 carry = result1 %10;
+    result1 /= 10;
+    result2 /= 10;
+    result2 += carry * base;
+  }
+
+  // Take care of overflow
+  if(result1 > (LLONG_MAX / base2))
+  {
+    ConversionError(_T("BCD: Overflow in conversion to 64 bits integer number."));
+    return 0;
+  }
+  result2 += (result1 * base2);
+
+  // Take care of sign 
+  if(m_sign == Sign::Negative)
+  {
+    result2 = -result2;
+  }
+  return result2;
+}
+
+// Get as an unsigned 64 bits long
+template<int Limbs>
+uint64  
+basic_bcd<Limbs>::AsUInt64() const
+{
+  // Check if we have a result
+  if(!IsValid() || IsNULL())
+  {
+    return 0;
+  }
+
+  // Check for negative
+  if(m_sign == Sign::Negative)
+  {
+    ConversionError(_T("BCD: Cannot convert a negative number to an unsigned 64 bits integer"),bcd_context::StatusInvalid);
+    return 0;
+  }
+  // Quick optimization for really small numbers
+  if(m_exponent < 0)
+  {
+    return 0L;
+  }
+  uint64 result1 = 0L;
+  uint64 result2 = 0L;
+  int exponent   = 4 * bcdDigits - m_exponent - 1;
+  uint64 base2   = (uint64)bcdBase * ((uint64)bcdBase);
+  uint64 base    = base2 / 10;
+
+  // Get from the mantissa (zero beyond the length of the mantissa)
+  long mantissa[4] = { 0 };
+  memcpy(mantissa,m_mantissa,(bcdLength < 4 ? bcdLength : 4) * sizeof(long));
+  result1 = ((uint64)mantissa[0] * bcdBase) + ((uint64)mantissa[1]);
+  result2 = ((uint64)mantissa[2] * bcdBase) + ((uint64)mantissa[3]);
+
+  // Adjust to exponent
+  while(exponent--)
+  {
+    uint64 carry    = result1 %10;
+    result1 /= 10;
+    result2 /= 10;
+    result2 += carry * base;
+  }
+
+  // Take care of overflow
+  if(result1 > (ULLONG_MAX / base2))
+  {
+    ConversionError(_T("BCD: Overflow in conversion to 64 bits unsigned integer number."));
+    return 0;
+  }
+  result2 += (result1 * base2);
+
+  return result2;
+}
+
+// bcd::AsString
+// Description: Get as a mathematical string
+//
+// Engineering format: Convert back to "[sign][digit][.[digit]*][E[sign][digits]+]"
+// Bookkeeping format: Convert back to "[sign]9[digit]*][.[digit]*]"
+// Optionally also print the positive '+' ('-' negative sign is always printed!)
+// Optionally get with fixed decimals, default = 2 decimals (most common default for bookkeeping purposes)
+// Optionally get as much as needed decimals with "p_decimals = 0"
+template<int Limbs>
+XString 
+basic_bcd<Limbs>::AsString(Format p_format /*=Bookkeeping*/,bool p_printPositive /*=false*/,int p_decimals /*=2*/) const
+{
+  // Room for the sign, the digits, the zeros up to the decimal point and the exponent
+  // Only very many fixed decimals need a buffer on the heap
+  char  buffer[3 * bcdPrecision + 16];
+  char* first = buffer;
+  int   size  = 2 * bcdPrecision + 16 + (p_decimals > 0 ? p_decimals : 0);
+  if(size > (int)sizeof(buffer))
+  {
+    first = new char[size];
+  }
+
+  // Optionally print the positive sign
+  char* last = first;
+  if(p_printPositive && m_sign == Sign::Positive)
+  {
+    *last++ = '+';
+  }
+  last  = ToChars(last,first + size - 1,p_format,p_decimals);
+  *last = 0;
+
+  XString result(first);
+  if(first != buffer)
+  {
+    delete [] first;
+  }
+  return result;
+}
+
+// bcd::ToChars
+// Description: Write as a mathematical string into a buffer of the caller
+// Technical:   Same text as AsString (without the optional '+') but no heap allocation.
+//              The string is NOT zero terminated. Returns the position after the last
+//              character, or nullptr if the string does not fit in [p_first,p_last)
+template<int Limbs>
+char*
+basic_bcd<Limbs>::ToChars(char* p_first,char* p_last,Format p_format /*=Bookkeeping*/,int p_decimals /*=2*/) const
+{
+  // Shortcut for infinity and not-a-number
+  const char* special = nullptr;
+  switch(m_sign)
+  {
+    case Sign::NaN:     special =  "NaN"; break;
+    case Sign::INF:     special =  "INF"; break;
+    case Sign::MIN_INF: special = "-INF"; break;
+    case Sign::ISNULL:  special = "NULL"; break;
+  }
+  if(special)
+  {
+    for(; *special; ++special)
+    {
+      if(p_first == p_last)
+      {
+        return nullptr;
+      }
+      *p_first++ = *special;
+    }
+    return p_first;
+  }
+
+  // Check format possibilities
+  int expo = m_exponent;
+  if(expo < -(bcdPrecision / 2) || expo > (bcdPrecision / 2))
+  {
+    p_format = Format::Engineering;
+  }
+
+  // Construct the mantissa digits, stripping trailing zeros
+  char digits[bcdPrecision];
+  int  count = SignificantLimbs();
+  for(int ind = 0; ind < count; ++ind)
+  {
+    LimbToChars(m_mantissa[ind],&digits[ind * bcdDigits]);
+  }
+  count *= bcdDigits;
+  while(count > 0 && digits[count - 1] == '0')
+  {
+    --count;
+  }
+
+  // Exponent digits, backwards
+  char exponent[8];
+  int  expLength = 0;
+  if(p_format == Format::Engineering)
+  {
+    int number = expo < 0 ? -expo : expo;
+    do
+    {
+      exponent[expLength++] = (char)('0' + number % 10);
+      number /= 10;
+    }
+    while(number);
+    if(expo < 0)
+    {
+      exponent[expLength++] = '-';
+    }
+  }
+
+  // Digits before and behind the decimal point in bookkeeping format
+  int before = expo + 1;
+  int behind = count > before ? count - before : 0;
+  if(p_decimals > behind)
+  {
+    behind = p_decimals;
+  }
+
+  // Length of the string, so we only write if it fits
+  int length = (m_sign == Sign::Negative) ? 1 : 0;
+  if(p_format == Format::Engineering)
+  {
+    length += count + 2 + expLength;
+  }
+  else if(expo < 0)
+  {
+    length += 1 - expo + count;
+  }
+  else
+  {
+    length += before + (behind ? 1 + behind : 0);
+  }
+  if(p_last - p_first < length)
+  {
+    return nullptr;
+  }
+
+  // Take care of the sign
+  if(m_sign == Sign::Negative)
+  {
+    *p_first++ = '-';
+  }
+  if(p_format == Format::Engineering)
+  {
+    // "[digit][.[digit]*]E[sign][digits]+"
+    if(count)
+    {
+      *p_first++ = digits[0];
+    }
+    *p_first++ = '.';
+    for(int ind = 1; ind < count; ++ind)
+    {
+      *p_first++ = digits[ind];
+    }
+    *p_first++ = 'E';
+    while(expLength)
+    {
+      *p_first++ = exponent[--expLength];
+    }
+  }
+  else if(expo < 0)
+  {
+    // "0.[0]*[digit]*"
+    *p_first++ = '0';
+    *p_first++ = '.';
+    for(int ind = -1; ind > expo; --ind)
+    {
+      *p_first++ = '0';
+    }
+    for(int ind = 0; ind < count; ++ind)
+    {
+      *p_first++ = digits[ind];
+    }
+  }
+  else
+  {
+    // "[digit]+[.[digit]+]" padded with zeros to the decimal point and the decimals
+    for(int ind = 0; ind < before; ++ind)
+    {
+      *p_first++ = ind < count ? digits[ind] : '0';
+    }
+    if(behind)
+    {
+      *p_first++ = '.';
+      for(int ind = before; ind < before + behind; ++ind)
+      {
+        *p_first++ = ind < count ? digits[ind] : '0';
+      }
+    }
+  }
+  return p_first;
+}
+
+// Display strings are always in Format::Bookkeeping
+// as most users find mathematical exponential notation hard to read.
+template<int Limbs>
+XString 
+basic_bcd<Limbs>::AsDisplayString(int p_decimals /*=2*/) const
+{
+  // Shortcut for infinity and not-a-number
+  switch(m_sign)
+  {
+    case Sign::NaN:     return  _T("NaN");
+    case Sign::INF:     return  _T("INF");
+    case Sign::MIN_INF: return _T("-INF");
+    case Sign::ISNULL:  return _T("NULL");
+  }
+
+  // Locale strings of the current thread
+  const bcd_context& context = bcd_context::Current();
+
+  // Not in the bookkeeping range
+  if(m_exponent > 12 || m_exponent < -2)
+  {
+    return AsString(basic_bcd::Format::Engineering,false,p_decimals);
+  }
+  basic_bcd number(*this);
+  number.Round(p_decimals);
+
+  XString str = number.AsString(Format::Bookkeeping,false,p_decimals);
+  int pos = str.Find('.');
+  if(pos >= 0)
+  {
+    str.Replace(_T("."),context.m_decimalSep);
+  }
+
+  // Apply thousand separators in first part of the number
+  if((pos > 0) || (pos == -1 && str.GetLength() > 3))
+  {
+    XString result = pos > 0 ? str.Mid(pos) : XString();
+    str = pos > 0 ? str.Left(pos) : str;
+    pos = result.GetLength();
+
+    while(str.GetLength() > 3)
+    {
+      result = XString(context.m_thousandSep) + str.Right(3) + result;
+      str = str.Left(str.GetLength() - 3);
+    }
+    str += result;
+  }
+  
+  // Extra zero's for the decimals?
+  if((pos <= 0 && p_decimals > 0) || (0 < pos && pos <= p_decimals))
+  {
+    // Round on this number of decimals
+    int decimals(p_decimals);
+    if(pos < 0)
+    {
+      str += context.m_decimalSep;
+    }
+    else
+    {
+      decimals = p_decimals - pos + 1;
+    }
+    for(int index = 0;index < decimals; ++index)
+    {
+      str += _T("0");
+    }
+  }
+  return str;
+}
+
+// Get as an ODBC SQL NUMERIC
+template<int Limbs>
+void
+basic_bcd<Limbs>::AsNumeric(SQL_NUMERIC_STRUCT* p_numeric) const
+{
+  // Init the value array
+  memset(p_numeric->val,0,SQL_MAX_NUMERIC_LEN);
+
+  // Check if we have a result
+  if(!IsValid() || IsNULL())
+  {
+    return;
+  }
+
+  // Special case for 0.0 or smaller than can be contained (1.0E-38)
+  if(IsZero() || m_exponent < -SQLNUM_MAX_PREC)
+  {
+    return;
+  }
+
+  // Check for overflow. Cannot be greater than 9.999999999E+37
+  if(m_exponent >= SQLNUM_MAX_PREC)
+  {
+    ConversionError(_T("BCD: Overflow in converting bcd to SQL NUMERIC/DECIMAL"));
+    return;
+  }
+
+  SQLCHAR precision = 0;
+  SQLCHAR scale = 0;
+  CalculatePrecisionAndScale(precision,scale);
+  NumericValue(p_numeric,precision,scale);
+}
+
+// Get an array of numbers as ODBC SQL NUMERICs
+// Description: Bulk conversion for binding parameter arrays
+// Technical:   Without a precision, every value gets its own precision and scale
+//              as in AsNumeric. With a precision, all values get NUMERIC(p,s) of the
+//              column, and the precision and scale are not calculated per value.
+//              Large arrays are split over several threads.
+//              Values that do not fit are left zero. In the throwing error mode,
+//              one exception is thrown after the whole array is converted.
+//              Returns the number of values that did not fit.
+template<int Limbs>
+size_t
+basic_bcd<Limbs>::AsNumericArray(const basic_bcd*     p_numbers
+                                ,SQL_NUMERIC_STRUCT*  p_numerics
+                                ,size_t               p_count
+                                ,SQLCHAR              p_precision /*=0*/
+                                ,SQLSCHAR             p_scale     /*=0*/)
+{
+  // Check the column definition
+  if(p_precision > SQLNUM_MAX_PREC || p_scale > (SQLSCHAR)p_precision)
+  {
+    basic_bcd().ConversionError(_T("BCD: Bad precision or scale for a SQL NUMERIC/DECIMAL"),bcd_context::StatusInvalid);
+    return p_count;
+  }
+  size_t failed = BulkConversion(p_count,[&](size_t p_begin,size_t p_end)
+  {
+    size_t overflow = 0;
+    for(size_t ind = p_begin; ind < p_end; ++ind)
+    {
+      const basic_bcd&    number  = p_numbers[ind];
+      SQL_NUMERIC_STRUCT* numeric = &p_numerics[ind];
+
+      // Value can be too big for any NUMERIC
+      bool valid = number.IsValid() && !number.IsNULL() && !number.IsZero();
+      if(p_precision == 0)
+      {
+        overflow += (valid && number.m_exponent >= SQLNUM_MAX_PREC) ? 1 : 0;
+        number.AsNumeric(numeric);
+        continue;
+      }
+      // Column defines the precision and scale
+      // Value can have more digits before the decimal point than the column
+      if(valid && number.m_exponent + 1 > p_precision - p_scale)
+      {
+        number.ConversionError(_T("BCD: Overflow in converting bcd to SQL NUMERIC/DECIMAL"));
+        valid = false;
+        ++overflow;
+      }
+      if(valid)
+      {
+        number.NumericValue(numeric,p_precision,p_scale);
+      }
+      else
+      {
+        memset(numeric->val,0,SQL_MAX_NUMERIC_LEN);
+        numeric->sign      = 1;
+        numeric->precision = p_precision;
+        numeric->scale     = p_scale;
+      }
+    }
+    return overflow;
+  });
+  if(failed)
+  {
+    basic_bcd().ConversionError(_T("BCD: Overflow in converting bcd to SQL NUMERIC/DECIMAL"));
+  }
+  return failed;
+}
+
+// Set an array of numbers from ODBC SQL NUMERICs
+// Description: Bulk conversion for fetching into arrays
+// Technical:   Large arrays are split over several threads
+template<int Limbs>
+void
+basic_bcd<Limbs>::FromNumericArray(const SQL_NUMERIC_STRUCT* p_numerics,basic_bcd* p_numbers,size_t p_count)
+{
+  BulkConversion(p_count,[&](size_t p_begin,size_t p_end)
+  {
+    for(size_t ind = p_begin; ind < p_end; ++ind)
+    {
+      p_numbers[ind].SetValueNumeric(&p_numerics[ind]);
+    }
+    return (size_t)0;
+  });
+}
+
+//////////////////////////////////////////////////////////////////////////
+//
+// END OF "GET AS SOMETHING DIFFERENT"
+//
+//////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////
+//
+// GETTERS of BCD
+//
+//////////////////////////////////////////////////////////////////////////
+
+// bcd::IsNull
+// Description: Gets the fact that bcd is exactly 0.0
+template<int Limbs>
+bool  
+basic_bcd<Limbs>::IsZero() const
+{
+  // Shortcut test
+  if(m_sign == Sign::Negative || m_exponent != 0)
+  {
+    return false;
+  }
+  // The normalized mantissa's first part must be a number
+  // otherwise the total of the bcd is NULL!!
+  // So: No need to scan the whole mantissa!!
+  if(m_mantissa[0])
+  {
+    // Also works for (-)INF, NaN and NULL
+    return false;
+  }
+  return true;
+}
+
+// Is bcd a database NULL
+template<int Limbs>
+bool
+basic_bcd<Limbs>::IsNULL() const
+{
+  return m_sign == Sign::ISNULL;
+}
+
+// bcd::IsNearZero
+// Description: Nearly zero or zero
+template<int Limbs>
+bool
+basic_bcd<Limbs>::IsNearZero()
+{
+  // NULL, NaN or (-)INF is never 'near zero'
+  if(m_sign > Sign::Negative)
+  {
+    return false;
+  }
+  // Rounding errors of the iterations grow with the mantissa length
+  basic_bcd epsilon = Epsilon(Limbs > 5 ? 10 : 5);
+  return AbsoluteValue() < epsilon;
+}
+
+// Not an (-)INF or a NaN
+template<int Limbs>
+bool
+basic_bcd<Limbs>::IsValid() const
+{
+  return m_sign <= Sign::Negative;
+}
+
+// bcd::GetSign
+// Description: Gets the sign
+// Technical:   Returns -1 (negative), 0 or 1 (Positive)
+// Beware;      NaN, (-)INF also returns a 0
+template<int Limbs>
+int   
+basic_bcd<Limbs>::GetSign() const
+{
+  // Negative number returns -1
+  if(m_sign == Sign::Negative)
+  {
+    return -1;
+  }
+  // Positive number returns 1
+  if(m_mantissa[0] || m_exponent)
+  {
+    return 1;
+  }
+  // Number is NULL. Sign = 0, or (-)INF or NaN
+  return 0;
+}
+
+// Gets Signed status Positive, Negative, -INF, INF, NaN
+template<int Limbs>
+typename basic_bcd<Limbs>::Sign
+basic_bcd<Limbs>::GetStatus() const
+{
+  return m_sign;
+}
+
+// bcd::GetLength
+// Description: Total length (before and after decimal point)
+// Technical:   Returns the actual length (not the precision)
+template<int Limbs>
+int   
+basic_bcd<Limbs>::GetLength() const
+{
+  int length  = 0;
+  int counter = 0;
+
+  // Length of the display string
+  switch(m_sign)
+  {
+    case Sign::NaN:     return 3;
+    case Sign::INF:     return 3;
+    case Sign::MIN_INF: return 4;
+    case Sign::ISNULL:  return 4;
+  }
+
+  // Quick optimization
+  if(IsZero())
+  {
+    // Zero (0) has length of 1
+    return 1;
+  }
+
+  // Walk the mantissa
+  for(int pos = 0;pos < bcdLength; ++pos)
+  {
+    long number = m_mantissa[pos];
+    long base   = bcdBase / 10;
+
+    for(int dig = bcdDigits; dig > 0; --dig)
+    {
+      // Actual position
+      ++counter;
+
+      // See if there is a digit here
+      long num = number / base;
+      number  %= base;
+      base    /= 10;
+      if(num)
+      {
+        length = counter;
+      }
+    }
+  }
+  return length;
+}
+
+// bcd::GetPrecision
+// Description: Total precision (length after the decimal point)
+template<int Limbs>
+int   
+basic_bcd<Limbs>::GetPrecision() const
+{
+  // Quick optimization
+  if(IsZero() || !IsValid() || IsNULL())
+  {
+    return 0;
+  }
+
+  // Default max precision
+  int precision = bcdPrecision;
+
+  for(int posLength = bcdLength - 1; posLength >= 0; --posLength)
+  {
+    int mant = m_mantissa[posLength];
+    for(int posDigits =  bcdDigits - 1;posDigits >= 0; --posDigits)
+    {
+      int last = mant % 10;
+      mant /= 10;       // Next pos
+      if(last == 0)
+      {
+        --precision;
+      }
+      else
+      {
+        // Break on first non-zero 
+        // by terminating both loops
+        posDigits = -1;
+        posLength = -1;
+      }
+    }
+  }
+  // Precision is 1 based (1 position for the decimal point implied)
+  precision -= 1;
+  // Precision is inverse to the exponent (higher exponent, means less behind the decimal point)
+  precision -= m_exponent;
+  // Precision cannot be less than zero
+  if(precision < 0)
+  {
+    precision = 0;
+  }
+  // Return the result
+  return precision;
+}
+
+// bcd::GetMaxSize
+// Description: Get the max size of a bcd
+template<int Limbs>
+int 
+basic_bcd<Limbs>::GetMaxSize(int /*p_precision = 0*/)
+{
+  // int size = bcdDigits * bcdLength;
+  return bcdPrecision;
+}
+
+// bcd::GetFitsInLong
+// Gets the fact that it fits in a long
+template<int Limbs>
+bool  
+basic_bcd<Limbs>::GetFitsInLong() const
+{
+  // Infinity does not fit in a long :-)
+  if(!IsValid() || IsNULL())
+  {
+    return false;
+  }
+
+  // Convert without throwing and look at the status
+  bcd_context& context  = bcd_context::Current();
+  bool         throwing = context.m_throwing;
+  unsigned     status   = context.m_status;
+  context.m_throwing = false;
+  context.ClearStatus();
+
+  AsLong();
+  bool fits = !context.TestStatus(bcd_context::StatusOverflow | bcd_context::StatusInvalid);
+
+  context.m_throwing = throwing;
+  context.m_status   = status;
+  return fits;
+}
+
+// bcd::GetFitsInInt64
+// Description: Gets the fact that it fits in an int64
+//
+template<int Limbs>
+bool  
+basic_bcd<Limbs>::GetFitsInInt64() const
+{
+  // Infinity does not fit in an int64 :-)
+  if(!IsValid() || IsNULL())
+  {
+    return false;
+  }
+
+  // Convert without throwing and look at the status
+  bcd_context& context  = bcd_context::Current();
+  bool         throwing = context.m_throwing;
+  unsigned     status   = context.m_status;
+  context.m_throwing = false;
+  context.ClearStatus();
+
+  AsInt64();
+  bool fits = !context.TestStatus(bcd_context::StatusOverflow | bcd_context::StatusInvalid);
+
+  context.m_throwing = throwing;
+  context.m_status   = status;
+  return fits;
+}
+
+// bcd::GetHasDecimals
+// Description: Decimal part (behind the decimal point) is not "000" (zeros)
+template<int Limbs>
+bool  
+basic_bcd<Limbs>::GetHasDecimals() const
+{
+  // Shortcut for ZERO
+  if(IsZero() || !IsValid() || IsNULL())
+  {
+    return false;
+  }
+  // Shortcut: some decimals must exist
+  if(m_exponent < 0)
+  {
+    return true;
+  }
+
+  // Compare the length with the exponent.
+  // If exponent smaller, the rest is behind the decimal point
+  int length = GetLength();
+  if(m_exponent < (length - 1))
+  {
+    return true;
+  }
+  return false;
+}
+
+// bd::GetExponent
+// Description: Gets the 10-based exponent
+template<int Limbs>
+int   
+basic_bcd<Limbs>::GetExponent() const
+{
+  // Infinity has no exponent
+  if(!IsValid() || IsNULL())
+  {
+    return 0;
+  }
+  return m_exponent;
+}
+
+// bcd::GetMantissa
+// Description: Gets the mantissa
+template<int Limbs>
+basic_bcd<Limbs>   
+basic_bcd<Limbs>::GetMantissa() const
+{
+  if(!IsValid() || IsNULL())
+  {
+    return SetInfinity(_T("BCD: Infinity cannot give a mantissa."));
+  }
+
+  basic_bcd number(*this);
+
+  number.m_sign     = Sign::Positive;
+  number.m_exponent = 0;
+  return number;
+}
+
+//////////////////////////////////////////////////////////////////////////
+//
+// END OF GETTERS OF BCD
+//
+//////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////
+//
+// INTERNALS OF BCD
+//
+//////////////////////////////////////////////////////////////////////////
+
+// Take the absolute value of a long
+// This method is taken outside the <math> library or other macro's.
+// It was needed because some versions of std linked wrongly
+template<int Limbs>
+long 
+basic_bcd<Limbs>::long_abs(const long p_value) const
+{
+  if(p_value < 0)
+  {
+    return -p_value;
+  }
+  return p_value;
+}
+
+// bcd::SetValueInt
+// Description: Sets one integer in this bcd number
+template<int Limbs>
+void  
+basic_bcd<Limbs>::SetValueInt(const int p_value)
+{
+  Zero();
+
+  // Shortcut if value is zero
+  if(p_value == 0)
+  {
+    return;
+  }
+  // Take care of sign
+  m_sign = (p_value < 0) ? Sign::Negative : Sign::Positive;
+  // Place in mantissa. An int can have more digits than one element
+  int64 value = (p_value < 0) ? -(int64)p_value : (int64)p_value;
+  m_mantissa[0] = (long)(value / bcdBase);
+  m_mantissa[1] = (long)(value % bcdBase);
+  // And normalize
+  Normalize(2 * bcdDigits - 1);
+}
+
+// bcd::SetValueLong
+// Description: Set the bcd to the value of two longs
+//              Numbers can be set as bcd(12345,4567) -> +1.23454567E+4 = 12,345.4567
+//              Works up to 8 positions before and after the decimal point
+// Parameters:  const long value     // value before the decimal point
+//              const long restValue // Optional value behind the decimal point
+//
+template<int Limbs>
+void
+basic_bcd<Limbs>::SetValueLong(const long p_value, const long p_restValue)
+{
+  Zero();
+
+  if(p_value == 0 && p_restValue == 0)
+  {
+    // Nothing more to do. We are zero
+    return;
+  }
+  // Get the sign
+  if (p_value == 0)
+  {
+    m_sign = (p_restValue < 0) ? Sign::Negative : Sign::Positive;
+  }
+  else
+  {
+    m_sign = (p_value < 0) ? Sign::Negative : Sign::Positive;
+  }
+  // Fill in mantissa. restValue first
+  int norm = 0;
+
+  if(p_restValue)
+  {
+    m_mantissa[0] = long_abs(p_restValue % bcdBase);
+    norm = -1;
+
+    if(p_restValue / bcdBase)
+    {
+      ShiftRight();
+      m_mantissa[0] = long_abs(p_restValue / bcdBase);
+      norm -= bcdDigits;
+    }
+    Normalize(norm);
+    norm = 0;
+    if(p_value)
+    {
+      ShiftRight();
+    }
+  }
+
+  if(p_value % bcdBase)
+  {
+    m_mantissa[0] = long_abs(p_value % bcdBase);
+    norm = bcdDigits - 1;
+  }
+  if(p_value / bcdBase)
+  {
+    ShiftRight();
+    m_mantissa[0] = long_abs(p_value / bcdBase);
+    norm = 2 * bcdDigits - 1;
+  }
+  Normalize(norm);
+}
+
+// bcd::SetValueint64
+// Description: Set the bcd to the value of two longs
+//              Numbers can be set as bcd(12345,4567) -> +1.23454567E+4 = 12,345.4567
+//              Works up to all 19 positions before and after the decimal point
+// Parameters:  const long value     // value before the decimal point
+//              const long restValue // Optional value behind the decimal point
+// Be advised:  The restValues behave as digits left shifted to the decimal marker
+//              5      becomes 0.5
+//              15     becomes 0.15
+//              2376   becomes 0.2376
+template<int Limbs>
+void  
+basic_bcd<Limbs>::SetValueInt64(const int64 p_value, const int64 p_restValue)
+{
+  Zero();
+
+  int64 dblBcdDigits = (int64)bcdBase * (int64)bcdBase;
+
+  if(p_value == 0L && p_restValue == 0L)
+  {
+    // Nothing more to do. We are zero
+    return;
+  }
+  // Get the sign
+  if(p_value == 0L)
+  {
+    m_sign = (p_restValue < 0L) ? Sign::Negative : Sign::Positive;
+  }
+  else
+  {
+    m_sign = (p_value < 0L) ? Sign::Negative : Sign::Positive;
+  }
+  // Fill in mantissa
+  int norm = 0;
+
+  // Part after the decimal point first
+  if(p_restValue % bcdBase)
+  {
+    m_mantissa[0] = long_abs(p_restValue % bcdBase);
+    norm = bcdDigits - 1;
+  }
+  if(p_restValue / bcdBase)
+  {
+    ShiftRight();
+    m_mantissa[0] = long_abs((long)((p_restValue / bcdBase) % bcdBase));
+    norm = 2 * bcdDigits - 1;
+  }
+  if(p_restValue / dblBcdDigits)
+  {
+    ShiftRight();
+    m_mantissa[0] = long_abs((long)(p_restValue / dblBcdDigits));
+    norm = 3 * bcdDigits - 1;
+  }
+
+  if(p_restValue)
+  {
+    // Normalize the rest value to be left shifted
+    Normalize(norm);
+    norm = 0; // reset !!
+  }
+
+  // Part before the decimal point
+  if(p_value % bcdBase)
+  {
+    ShiftRight();
+    m_mantissa[0] = long_abs((long)(p_value % bcdBase));
+    norm = bcdDigits - 1;
+  }
+  if(p_value / bcdBase)
+  {
+    ShiftRight();
+    m_mantissa[0] = long_abs((long)((p_value / bcdBase) % bcdBase));
+    norm = 2 * bcdDigits - 1;
+  }
+  if(p_value / dblBcdDigits)
+  {
+    ShiftRight();
+    m_mantissa[0] = long_abs((long)(p_value / dblBcdDigits));
+    norm = 3 * bcdDigits -1;
+  }
+
+  // Normalize the whole result
+  Normalize(norm);
+}
+
+template<int Limbs>
+void    
+basic_bcd<Limbs>::SetValueUInt64(const uint64 p_value,const int64 p_restValue)
+{
+  uint64 value(p_value);
+  bool extra = false;
+  if(p_value > LONGLONG_MAX)
+  {
+    extra  = true;
+    value -= LONGLONG_MAX;
+    value -= 1;
+  }
+  SetValueInt64(value,p_restValue);
+  if(extra)
+  {
+    *this += basic_bcd(LONGLONG_MAX);
+    *this += basic_bcd(1);
+  }
+  Normalize();
+}
+
+// bcd::SetValueDouble
+// Description: Sets the value from a double
+// Technical:   The shortest decimal that reads back as the same double, so 0.1 gives 0.1
+//              and 1.0/3 gives 0.3333333333333333. The comparisons with a double use
+//              the same number (CompareDouble).
+template<int Limbs>
+void  
+basic_bcd<Limbs>::SetValueDouble(const double p_value)
+{
+  // Make empty
+  Zero();
+
+  // Infinity and NaN
+  if(p_value != p_value)
+  {
+    m_sign = Sign::NaN;
+    return;
+  }
+  if(p_value > DBL_MAX || p_value < -DBL_MAX)
+  {
+    m_sign = (p_value < 0.0) ? Sign::MIN_INF : Sign::INF;
+    return;
+  }
+
+  // A double as it was written: a whole number times 10^-scale
+  int64 whole = 0;
+  int   scale = 0;
+  if(DoubleAsWritten(p_value,whole,scale))
+  {
+    SetValueInt64(whole,0);
+    if(!IsZero())
+    {
+      m_exponent -= (short)scale;
+    }
+    return;
+  }
+
+  // The shortest text (of 15 to 17 digits) that reads back as the same double
+  char text[32];
+  for(int digits = 15; digits <= 17; ++digits)
+  {
+    snprintf(text,sizeof(text),"%.*E",digits - 1,p_value);
+    if(strtod(text,nullptr) == p_value)
+    {
+      break;
+    }
+  }
+  FromChars(text,text + strlen(text));
+}
+
+// bcd::SetValueString
+// Description: Set the value of the bcd from a string
+// Technical:   Scans [sign][digit][.[digit]*][E[sign][digits]+]
+//              part =       1        2          3    
+template<int Limbs>
+void
+basic_bcd<Limbs>::SetValueString(LPCTSTR p_string,bool /*p_fromDB*/)
+{
+  // Zero out this number
+  Zero();
+
+  bool spacing   = true;
+  bool signing   = true;
+  int  mantpos   = 0;
+  int  digitpos  = bcdDigits;
+  int  base      = bcdBase / 10;
+  int  part      = 1;
+  int  exp_extra = 0;
+  Sign exp_sign  = Sign::Positive;
+  
+  // For normalized numbers without a first part
+  m_exponent = -1;
+
+  // Check special cases
+  if(_tcscmp(p_string,_T("INF")) == 0)
+  {
+    m_sign = Sign::INF;
+    return;
+  }
+  if(_tcscmp(p_string,_T("-INF")) == 0)
+  {
+    m_sign = Sign::MIN_INF;
+    return;
+  }
+  if(_tcscmp(p_string,_T("NaN")) == 0)
+  {
+    m_sign = Sign::NaN;
+    return;
+  }
+  if(_tcscmp(p_string,_T("NULL")) == 0)
+  {
+    m_sign = Sign::ISNULL;
+    return;
+  }
+
+  // Scan the entire string
+  for(LPCTSTR pos = p_string; *pos; ++pos)
+  {
+    // Get a char at the next position
+    _TUCHAR c = *pos;
+
+    // Skip whitespace at the beginning
+    if(spacing)
+    {
+      if(isspace(c))
+      {
+        continue;
+      }
+      spacing = false;
+    }
+    // See if a sign is found
+    if(signing && part == 1)
+    {
+      if(c == '-')
+      {
+        m_sign  = Sign::Negative;
+        signing = false;
+        continue;
+      }
+      if(c == '+')
+      {
+        m_sign  = Sign::Positive;
+        signing = false;
+        continue;
+      }
+    }
+    // Get type of next character
+    switch(c)
+    {
+      case '.': part = 2; 
+                break;
+      case 'e': // Fall through
+      case 'E': part = 3; 
+                break;
+      case '-': exp_sign = Sign::Negative;
+                break;
+      case '+': exp_sign = Sign::Positive;
+                break;
+      default:  // Now must be a digit. No other chars allowed
+                if(isdigit(c) == false)
+                {
+                  Zero();
+                  m_sign = Sign::NaN;
+                  ConversionError(_T("BCD: Conversion from string. Bad format in decimal number"),bcd_context::StatusInvalid);
+                  return;
+                }
+                break;
+    }
+    // Decimal point found. Just continue
+    if(part == 2 && c == '.')
+    {
+      continue;
+    }
+    // Exponent just found. Just continue;
+    if(part == 3 && (c == 'e' || c == 'E'))
+    {
+      continue;
+    }
+    // Exponent sign just found. Just continue
+    if(c == '-' || c == '+')
+    {
+      continue;
+    }
+    // Get next char pos
+    int number = c - '0';
+    // Building the mantissa
+    if(part == 1 || part == 2)
+    {
+      // Adjusting exponent
+      if(part == 1)
+      {
+        // Before the decimal point, the exponent grows
+        ++m_exponent;
+      }
+      // Set in the mantissa
+      if(mantpos < bcdLength)
+      {
+        m_mantissa[mantpos] += number * base;
+        base /= 10;
+
+        // Check for next position in the mantissa
+        if(--digitpos == 0)
+        {
+          // Reset for the next long in the mantissa
+          base     = bcdBase / 10;
+          digitpos = bcdDigits;
+
+          // Next position
+          ++mantpos;
+        }
+      }
+      // else skip the latter part of the mantissa
+    }
+    // Building the exponent
+    if(part == 3)
+    {
+      exp_extra *= 10;
+      exp_extra += number;
+    }
+  }
+  // Ready with the string
+
+  // Adjust the exponent from saved variables
+  if(exp_extra)
+  {
+    if(exp_sign == Sign::Negative)
+    {
+      exp_extra = -exp_extra;
+    }
+    m_exponent += (short) exp_extra;
+  }
+  // Normalize for "0.xxx" case
+  Normalize();
+}
+
+// bcd::FromChars
+// Description: Set the value from a character range (as std::from_chars)
+// Technical:   Reads "[sign][digit]*[.[digit]*][(E|e)[sign][digit]+]" or one of
+//              "INF", "-INF", "NaN" and "NULL" from the front of the range.
+//              No whitespace is skipped. Parsing stops at the first character that
+//              does not fit the number, and the result points to that character.
+//              The value is only changed if the status has no StatusInvalid/StatusOverflow.
+//              Digits beyond the precision are truncated (StatusInexact).
+//              Never throws, and does not raise the status of the context.
+template<int Limbs>
+bcd_chars_result
+basic_bcd<Limbs>::FromChars(const char* p_first,const char* p_last)
+{
+  bcd_chars_result result { p_first, bcd_context::StatusInvalid };
+  basic_bcd   number;
+  const char* pos  = p_first;
+  Sign        sign = Sign::Positive;
+
+  if(pos < p_last && (*pos == '-' || *pos == '+'))
+  {
+    sign = (*pos++ == '-') ? Sign::Negative : Sign::Positive;
+  }
+
+  // Special values as printed by AsString and ToChars
+  if(pos < p_last && (*pos == 'I' || *pos == 'N'))
+  {
+    static const char* words[] = { "INF", "NaN", "NULL" };
+    for(const char* word : words)
+    {
+      int length = (int)strlen(word);
+      if(p_last - pos >= length && strncmp(pos,word,length) == 0)
+      {
+        number.m_sign = (word[0] != 'I') ? (word[1] == 'a' ? Sign::NaN : Sign::ISNULL)
+                                         : (sign == Sign::Negative ? Sign::MIN_INF : Sign::INF);
+        result.ptr    = pos + length;
+        result.status = bcd_context::StatusNone;
+        *this = number;
+        return result;
+      }
+    }
+    return result;
+  }
+
+  // Digits before the decimal point. Leading zeros are no part of the mantissa
+  const char* start = pos;
+  while(pos < p_last && *pos == '0')
+  {
+    ++pos;
+  }
+  int  digits   = 0;
+  bool inexact  = false;
+  int  exponent = number.ScanDigits(pos,p_last,digits,inexact) - 1;
+  bool found    = pos > start;
+
+  // Digits behind the decimal point
+  if(pos < p_last && *pos == '.')
+  {
+    start = ++pos;
+    if(digits == 0)
+    {
+      while(pos < p_last && *pos == '0')
+      {
+        ++pos;
+      }
+      exponent = -(int)(pos - start) - 1;
+    }
+    number.ScanDigits(pos,p_last,digits,inexact);
+    found |= pos > start;
+  }
+  if(!found)
+  {
+    return result;
+  }
+
+  // Optional exponent. An 'E' without digits is not part of the number
+  if(pos < p_last && (*pos == 'E' || *pos == 'e'))
+  {
+    const char* expo     = pos + 1;
+    bool        negative = false;
+    if(expo < p_last && (*expo == '-' || *expo == '+'))
+    {
+      negative = (*expo++ == '-');
+    }
+    if(expo < p_last && *expo >= '0' && *expo <= '9')
+    {
+      int value = 0;
+      for(; expo < p_last && *expo >= '0' && *expo <= '9'; ++expo)
+      {
+        // Beyond any exponent range, but stays in an int
+        if(value < 10 * SHRT_MAX)
+        {
+          value = value * 10 + (*expo - '0');
+        }
+      }
+      exponent += negative ? -value : value;
+      pos = expo;
+    }
+  }
+  result.ptr    = pos;
+  result.status = inexact ? bcd_context::StatusInexact : bcd_context::StatusNone;
+
+  // All zeros
+  if(digits == 0)
+  {
+    *this = number;
+    return result;
+  }
+  // Exponent out of range
+  if(exponent > SHRT_MAX || exponent < SHRT_MIN)
+  {
+    result.status = bcd_context::StatusOverflow;
+    return result;
+  }
+  number.m_sign     = sign;
+  number.m_exponent = (short)exponent;
+  *this = number;
+  return result;
+}
+
+// bcd::ScanDigits
+// Description: Append a run of digits to the mantissa
+// Technical:   p_digits is the number of digits already in the mantissa.
+//              On a limb boundary eight digits at a time go in one SWAR step.
+//              Digits beyond the precision are only counted.
+//              Returns the number of digits read.
+template<int Limbs>
+int
+basic_bcd<Limbs>::ScanDigits(const char*& p_pos,const char* p_last,int& p_digits,bool& p_inexact)
+{
+  const char* start = p_pos;
+  while(p_pos < p_last)
+  {
+    // Eight digits in one step
+    if(p_digits % bcdDigits == 0 && p_last - p_pos >= bcdDigits)
+    {
+      uint64 chars;
+      memcpy(&chars,p_pos,sizeof(uint64));
+      if(IsEightDigits(chars))
+      {
+        if(p_digits < bcdPrecision)
+        {
+          m_mantissa[p_digits / bcdDigits] = EightDigitsToLimb(chars);
+        }
+        else
+        {
+          p_inexact |= (chars != 0x3030303030303030ULL);
+        }
+        p_digits += bcdDigits;
+        p_pos    += bcdDigits;
+        continue;
+      }
+    }
+    // One digit at a time
+    if(*p_pos < '0' || *p_pos > '9')
+    {
+      break;
+    }
+    int number = *p_pos++ - '0';
+    if(p_digits < bcdPrecision)
+    {
+      m_mantissa[p_digits / bcdDigits] += number * g_limbPowers[p_digits % bcdDigits];
+    }
+    else
+    {
+      p_inexact |= (number != 0);
+    }
+    ++p_digits;
+  }
+  return (int)(p_pos - start);
+}
+
+// Sets the value from a SQL NUMERIC
+template<int Limbs>
+void  
+basic_bcd<Limbs>::SetValueNumeric(const SQL_NUMERIC_STRUCT* p_numeric)
+{
+  // Start at zero
+  Zero();
+
+  // Value array is a little endian 128 bits integer
+  uint64 high = 0;
+  uint64 low  = 0;
+  for(int ind = 0; ind < 8; ++ind)
+  {
+    low  |= (uint64)p_numeric->val[ind]     << (8 * ind);
+    high |= (uint64)p_numeric->val[ind + 8] << (8 * ind);
+  }
+
+  // Special case: NUMERIC = zero
+  if(high == 0 && low == 0)
+  {
+    return;
+  }
+
+  // Split into mantissa limbs. 2^128 has 39 digits, so 5 limbs will do
+  const int numericLimbs = 5;
+  uint64 limbs[numericLimbs];
+  for(int ind = numericLimbs - 1; ind >= 0; --ind)
+  {
+    limbs[ind] = DivideByBase128(high,low);
+  }
+
+  // Leading zero limbs and digits
+  int first = 0;
+  while(limbs[first] == 0)
+  {
+    ++first;
+  }
+  int shift = 0;
+  for(uint64 number = limbs[first]; number * 10 < bcdBase; number *= 10)
+  {
+    ++shift;
+  }
+
+  // Shift the limbs to the left into the mantissa
+  uint64 factor  = (uint64)g_limbPowers[bcdDigits - 1 - shift];
+  uint64 divisor = bcdBase / factor;
+  bool   inexact = false;
+  for(int ind = 0; first + ind < numericLimbs; ++ind)
+  {
+    uint64 next = (first + ind + 1 < numericLimbs) ? limbs[first + ind + 1] : 0;
+    if(ind < bcdLength)
+    {
+      m_mantissa[ind] = (long)((limbs[first + ind] % divisor) * factor + next / divisor);
+    }
+    else
+    {
+      // Digits beyond the precision of a small bcd fall off
+      inexact |= (limbs[first + ind] % divisor != 0) || (next / divisor != 0);
+    }
+  }
+  RaiseInexact(inexact);
+
+  // Compute the exponent from the number of digits and the scale
+  m_exponent = (short)((numericLimbs - first) * bcdDigits - shift - 1 - p_numeric->scale);
+
+  // Adjust the sign
+  m_sign     = (p_numeric->sign == 1) ? Sign::Positive : Sign::Negative;
+}
+
+// bcd::Normalize
+// Description: Normalize the exponent. 
+//              Always up to first position with implied decimal point
+template<int Limbs>
+void
+basic_bcd<Limbs>::Normalize(int p_startExponent /*=0*/)
+{
+  // Set starting exponent
+  if(p_startExponent)
+  {
+    m_exponent = (short)p_startExponent;
+  }
+  // Check for zero first
+  if(SignificantLimbs() == 0)
+  {
+    m_sign     = Sign::Positive;
+    m_exponent = 0;
+    return;
+  }
+  // Count the leading zero limbs and digits
+  int shift = 0;
+  int first = 0;
+  while(m_mantissa[first] == 0)
+  {
+    shift += bcdDigits;
+    ++first;
+  }
+  for(long number = m_mantissa[first]; (number * 10) / bcdBase == 0; number *= 10)
+  {
+    ++shift;
+  }
+  // See to it that the mantissa is normalized in one go
+  if(shift)
+  {
+    Mult10(shift);
+  }
+  // Calculate exponent from number of shifts
+  m_exponent -= (short) shift;
+}
+
+// bcd::Mult10
+// Description: Multiply the mantissa by 10
+// Technical:   Optimize by doing shifts
+//              Pure internal operation for manipulating the mantissa
+//
+template<int Limbs>
+void
+basic_bcd<Limbs>::Mult10(int p_times /* = 1 */)
+{
+  // If the number of times is bigger than bcdDigits
+  // Optimize by doing shifts instead of MULT
+  if(p_times / bcdDigits)
+  {
+    int shifts = p_times / bcdDigits;
+    p_times   %= bcdDigits;
+    while(shifts--)
+    {
+      ShiftLeft();
+    }
+  }
+  if(p_times)
+  {
+    int64 factor = 10;
+    while(--p_times)
+    {
+      factor *= 10;
+    }
+    int64 carry = 0;
+
+    // Multiply all significant positions by 10^times
+    // The zero limbs after them stay zero
+    for(int ind = SignificantLimbs() - 1; ind >= 0; --ind)
+    {
+      int64 between   = m_mantissa[ind] * factor + carry;
+      carry           = between / bcdBase;
+      m_mantissa[ind] = (long)(between - carry * bcdBase);
+    }
+  }
+}
+
+// bcd::Div10
+// Description: Divide the mantissa by 10
+// Technical:   Optimize by doing shifts
+//              Pure internal operation for manipulating the mantissa
+//              Returns true if non-zero digits fell off the mantissa
+template<int Limbs>
+bool
+basic_bcd<Limbs>::Div10(int p_times /*=1*/)
+{
+  bool lost = false;
+
+  // if the number of times is bigger than bcdDigits
+  // optimize by shifting whole limbs at once instead of divs
+  if(p_times / bcdDigits)
+  {
+    int shifts = min(p_times / bcdDigits,bcdLength);
+    p_times   %= bcdDigits;
+    for(int ind = bcdLength - shifts; ind < bcdLength; ++ind)
+    {
+      lost |= (m_mantissa[ind] != 0);
+    }
+    memmove(&m_mantissa[shifts],&m_mantissa[0],(bcdLength - shifts) * sizeof(long));
+    memset(&m_mantissa[0],0,shifts * sizeof(long));
+  }
+  if(p_times)
+  {
+    // Multiply by 10^(bcdDigits - p_times) and divide by the (constant) bcdBase:
+    // the upper part stays in the limb, the lower part goes to the next limb
+    int64 multiplier = 1;
+    for(int ind = p_times; ind < bcdDigits; ++ind)
+    {
+      multiplier *= 10;
+    }
+    int64 carry = 0;
+
+    // The remainder of the last significant limb flows into one more limb
+    int length = SignificantLimbs();
+    if(length < bcdLength)
+    {
+      ++length;
+    }
+    for(int ind = 0; ind < length; ++ind)
+    {
+      int64 between   = m_mantissa[ind] * multiplier;
+      int64 upper     = between / bcdBase;
+      m_mantissa[ind] = (long)(upper + carry);
+      carry           = between - upper * bcdBase;
+    }
+    // Remainder of the last limb falls off the mantissa
+    lost |= (carry != 0);
+  }
+  return lost;
+}
+
+// bcd::ShiftRight
+// Description: Shift the mantissa members one position right
+template<int Limbs>
+void
+basic_bcd<Limbs>::ShiftRight()
+{
+  for(int ind = bcdLength - 1; ind > 0; --ind)
+  {
+    m_mantissa[ind] = m_mantissa[ind - 1];
+  }
+  m_mantissa[0] = 0;
+}
+
+// bcd::ShiftLeft
+// Description: Shift the mantissa members one position left
+template<int Limbs>
+void
+basic_bcd<Limbs>::ShiftLeft()
+{
+  for(int ind = 0; ind < bcdLength - 1; ++ind)
+  {
+    m_mantissa[ind] = m_mantissa[ind + 1];
+  }
+  m_mantissa[bcdLength - 1] = 0;
+}
+
+// bcd::StringNaarLong
+// Description: Convert a string to a single long value
+template<int Limbs>
+long
+basic_bcd<Limbs>::StringToLong(LPCTSTR p_string) const
+{
+  return _ttoi(p_string);
+}
+
+// bcd::SplitMantissa
+// Description: Split the mantissa for floor/ceiling operations
+template<int Limbs>
+basic_bcd<Limbs>
+basic_bcd<Limbs>::SplitMantissa() const
+{
+  basic_bcd result = *this;
+
+  // Splitting position is 1 more than the exponent
+  // because of the implied first position
+  int position = m_exponent + 1;
+
+  for(int mantpos = 0;mantpos < bcdLength; ++mantpos)
+  {
+    if(position <= 0)
+    {
+      // Result after this position will be zero
+      result.m_mantissa[mantpos] = 0;
+    }
+    else if(position >= bcdDigits)
+    {
+      // Keep these numbers in the mantissa
+      position -= bcdDigits;
+    }
+    else
+    {
+      // Here we will split the bcdDigits somewhere in the middle
+      long base   = bcdBase / 10;
+      long number = result.m_mantissa[mantpos];
+
+      for(int pos = bcdDigits; pos > 0; --pos)
+      {
+        // Find next number
+        long num = number / base;
+        number  %= base;
+
+        // zero out ?
+        if(position <= 0)
+        {
+          result.m_mantissa[mantpos] -= (num * base);
+        }
+        // go to the next position
+        --position;
+        base /= 10;
+      }
+    }
+  }
+  return result;
+}
+
+// bcd::CompareMantissa
+// Description: Compare two mantissa
+// Technical:   returns the following values
+//              -1  p_value is bigger
+//              0   mantissa are equal
+//              1   this is is bigger
+template<int Limbs>
+int   
+basic_bcd<Limbs>::CompareMantissa(const basic_bcd& p_value) const
+{
+  // Now compare the mantissa
+  for(int ind = 0;ind < bcdLength; ++ind)
+  {
+    // Find the first position not equal to the other
+    if(m_mantissa[ind] != p_value.m_mantissa[ind])
+    {
+      // Result by comparing the mantissa positions
+      return (m_mantissa[ind] > p_value.m_mantissa[ind]) ? 1 : -1;
+    }
+  }
+  // Mantissa are equal
+  return 0;
+}
+
+// bcd::CompareAbsolute
+// Description: Compare the absolute values of two valid numbers
+// Technical:   Zero has an exponent of 0, but is smaller than any other number.
+//              The exponents decide, otherwise the mantissa.
+//              Returns -1 (p_value is bigger), 0 (equal) or 1 (this is bigger)
+template<int Limbs>
+int
+basic_bcd<Limbs>::CompareAbsolute(const basic_bcd& p_value) const
+{
+  // A normalized mantissa starts with a non-zero limb, so zero shows in the first limb
+  if(m_mantissa[0] == 0 || p_value.m_mantissa[0] == 0)
+  {
+    return (m_mantissa[0] != 0) - (p_value.m_mantissa[0] != 0);
+  }
+  if(m_exponent != p_value.m_exponent)
+  {
+    return (m_exponent > p_value.m_exponent) ? 1 : -1;
+  }
+  return CompareMantissa(p_value);
+}
+
+// bcd::SignificantLimbs
+// Description: Number of mantissa limbs up to and including the last non-zero limb
+// Technical:   Most numbers (like 1234.56) use only the first one or two limbs.
+//              The kernels bound their loops by it, as the zero limbs after
+//              the last significant limb do not contribute to the result.
+template<int Limbs>
+int
+basic_bcd<Limbs>::SignificantLimbs() const
+{
+  int length = bcdLength;
+  while(length > 0 && m_mantissa[length - 1] == 0)
+  {
+    --length;
+  }
+  return length;
+}
+
+#ifdef _DEBUG
+// Debug print of the mantissa
+template<int Limbs>
+XString
+basic_bcd<Limbs>::DebugPrint(PTCHAR p_name)
+{
+  XString debug;
+
+  // Print the debug name
+  debug.Format(_T("%-14s "),p_name);
+
+  // Print the sign
+  debug.AppendFormat(_T("%c "),m_sign == Sign::Positive ? '+' : '-');
+
+  // Print the exponent
+  debug.AppendFormat(_T("E%+d "),m_exponent);
+
+  // Print the mantissa in special format
+  for(int ind = 0;ind < bcdLength; ++ind)
+  {
+    // Text "%08ld" dependent on bcdDigits
+    debug.AppendFormat(_T(" %08ld"),m_mantissa[ind]);
+  }
+  debug += _T("\n");
+
+  return debug;
+}
+#endif
+
+// bcd::Epsilon
+// Description: Stopping criterion for iterations
+// Technical:   Translates fraction to lowest decimal position
+//               10 -> 0.0000000000000000000000000000000000000010
+//                5 -> 0.0000000000000000000000000000000000000005
+template<int Limbs>
+basic_bcd<Limbs>
+basic_bcd<Limbs>::Epsilon(long p_fraction) const
+{
+  // Calculate stop criterion epsilon
+  // A new number every time, so concurrent iterations do not share it
+  basic_bcd epsilon;
+  epsilon.m_mantissa[0] = p_fraction * bcdBase / 10;
+  epsilon.m_exponent    = 2 - bcdPrecision;
+  return epsilon;
+}
+
+// bcd::NewtonPrecisions
+// Description: Working precisions (in limbs) of a Newton iteration
+// Technical:   Every iteration doubles the number of correct digits. So going down
+//              from the full mantissa, each iteration needs a bit more than half the
+//              limbs of the next one. The first guess from a double is good for
+//              almost 2 limbs, so the first iteration can go up to 4 limbs.
+//              Returns the number of iterations, from small to full.
+template<int Limbs>
+int
+basic_bcd<Limbs>::NewtonPrecisions(int* p_limbs)
+{
+  int steps = 1;
+  for(int limbs = bcdLength; limbs > 4; limbs = (limbs + 2) / 2)
+  {
+    ++steps;
+  }
+  int limbs = bcdLength;
+  for(int step = steps - 1; step >= 0; --step)
+  {
+    p_limbs[step] = limbs;
+    limbs = (limbs + 2) / 2;
+  }
+  return steps;
+}
+
+// bcd::TruncatedLimbs
+// Description: This number with only the first p_limbs limbs of the mantissa
+// Technical:   A product only takes the significant limbs, so the products of
+//              truncated numbers cost no more than their working precision
+template<int Limbs>
+basic_bcd<Limbs>
+basic_bcd<Limbs>::TruncatedLimbs(int p_limbs) const
+{
+  basic_bcd result(*this);
+  for(int ind = p_limbs; ind < bcdLength; ++ind)
+  {
+    result.m_mantissa[ind] = 0;
+  }
+  return result;
+}
+
+// bcd::UnitInLastPlace
+// Description: One unit in the last digit of the mantissa of this number
+template<int Limbs>
+basic_bcd<Limbs>
+basic_bcd<Limbs>::UnitInLastPlace() const
+{
+  basic_bcd unit;
+  unit.m_mantissa[0] = bcdBase / 10;
+  unit.m_exponent    = (short)(m_exponent + 1 - bcdPrecision);
+  return unit;
+}
+
+// Calculate the precision and scale for a SQL_NUMERIC
+// Highly optimized version as we do this a lot when
+// streaming bcd numbers to the database
+template<int Limbs>
+void
+basic_bcd<Limbs>::CalculatePrecisionAndScale(SQLCHAR& p_precision,SQLCHAR& p_scale) const
+{
+  // Default max values
+  p_precision = bcdDigits * bcdLength;
+  p_scale     = 0;
+
+  // Quick check on zero
+  if(IsZero())
+  {
+    p_precision = 1;
+    return;
+  }
+
+  int index;
+  // Find the first non-zero mantissa digit
+  for(index = bcdLength - 1;index >= 0; --index)
+  {
+    if(m_mantissa[index] == 0)
+    {
+      p_precision -= bcdDigits;
+    }
+    else break;
+  }
+  if(index < 0)
+  {
+    return;
+  }
+  // Find the number of digits in this mantissa
+  // Change this optimalization when changing bcdDigits or bcdLength !!
+  if(m_mantissa[index] % 10000)
+  {
+    // Lower half filled
+    if(m_mantissa[index] % 100)
+    {
+      // 7 or 8 digits
+      p_precision -= (m_mantissa[index] % 10) ? 0 : 1;
+    }
+    else
+    {
+      // 5 or 6 digits
+      p_precision -= (m_mantissa[index] % 1000) ? 2 : 3;
+    }
+  }
+  else
+  {
+    // Lower half is empty
+    if(m_mantissa[index] % 1000000)
+    {
+      // 3 or 4 digits
+      p_precision -= (m_mantissa[index] % 100000) ? 4 : 5;
+    }
+    else
+    {
+      // just two digits
+      p_precision -= (m_mantissa[index] % 10000000) ? 6 : 7;
+    }
+  }
+  // Final check on maximum precision
+  // Cannot exceed SQLNUM_MAX_PREC as otherwise 
+  // we **will** crash on certain RDBMS (MS SQL-Server)
+  if(p_precision > SQLNUM_MAX_PREC)
+  {
+    p_precision = SQLNUM_MAX_PREC;
+  }
+
+  // Now adjust the scale to accommodate precision and exponent
+  // m_exponent always below (-)SQLNUM_MAX_PREC, so this is safe
+  if(m_exponent < 0)
+  {
+    p_scale      = p_precision - (SQLCHAR) m_exponent - 1;
+    p_precision -= (SQLCHAR) m_exponent;
+  }
+  else
+  {
+    if((p_precision - 1) > (SQLCHAR) m_exponent)
+    {
+      p_scale = p_precision - (SQLCHAR) m_exponent - 1;
+    }
+    if(p_precision <= m_exponent)
+    {
+      p_precision = (SQLCHAR) m_exponent + 1;
+    }
+  }
+}
+
+// bcd::NumericValue
+// Description: Fill a SQL NUMERIC with a given precision and scale
+// Technical:   The value is the integer (number * 10^scale) of at most 38 digits.
+//              These are the first digits of the mantissa, so we multiply-accumulate
+//              them limb by limb in 128 bits. Digits behind the scale are truncated.
+template<int Limbs>
+void
+basic_bcd<Limbs>::NumericValue(SQL_NUMERIC_STRUCT* p_numeric,SQLCHAR p_precision,SQLSCHAR p_scale) const
+{
+  // Setting the sign, precision and scale
+  p_numeric->sign      = (m_sign == Sign::Positive) ? 1 : 0;
+  p_numeric->precision = p_precision;
+  p_numeric->scale     = p_scale;
+
+  uint64 high   = 0;
+  uint64 low    = 0;
+  int    digits = m_exponent + p_scale + 1;
+  for(int ind = 0; ind < bcdLength && digits > 0; ++ind)
+  {
+    if(digits >= bcdDigits)
+    {
+      MultiplyAdd128(high,low,bcdBase,m_mantissa[ind]);
+      digits -= bcdDigits;
+    }
+    else
+    {
+      MultiplyAdd128(high,low,g_limbPowers[bcdDigits - 1 - digits],m_mantissa[ind] / g_limbPowers[digits - 1]);
+      digits = 0;
+    }
+  }
+  // Zeros after a short mantissa
+  for(; digits > 0; --digits)
+  {
+    MultiplyAdd128(high,low,10,0);
+  }
+
+  // Value array is a little endian 128 bits integer
+  for(int ind = 0; ind < 8; ++ind)
+  {
+    p_numeric->val[ind]     = (SQLCHAR)(low  >> (8 * ind));
+    p_numeric->val[ind + 8] = (SQLCHAR)(high >> (8 * ind));
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////
+//
+// END OF INTERNALS OF BCD
+//
+//////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////
+//
+// BASIC OPERATIONS OF BCD
+//
+//////////////////////////////////////////////////////////////////////////
+
+// Addition operation
+template<int Limbs>
+basic_bcd<Limbs> 
+basic_bcd<Limbs>::Add(const basic_bcd& p_number) const 
+{
+  // Check if we can add
+  if(!IsValid() || !p_number.IsValid())
+  {
+    return SetInfinity(_T("Cannot add to INFINITY"));
+  }
+  // NULL always yield a NULL
+  if(IsNULL() || p_number.IsNULL())
+  {
+    return basic_bcd(Sign::ISNULL);
+  }
+  // Adding zero gives the other number
+  // Aligning the exponents with zero would leave the result unnormalized
+  if(p_number.IsZero())
+  {
+    return *this;
+  }
+  if(IsZero())
+  {
+    return p_number;
+  }
+  // See if we must do addition or subtraction
+  // Probably we need to swap the arguments....
+  // (+x) + (+y) -> Addition,    result positive, Do not swap
+  // (+x) + (-y) -> Subtraction, result pos/neg,  Possibly swap
+  // (-x) + (+y) -> Subtraction, result pos/neg,  Possibly swap
+  // (-x) + (-y) -> Addition,    result negative, Do not swap
+  Sign     signResult   = Sign::Positive;
+  Operator operatorKind = Operator::Addition;
+  basic_bcd      arg1(*this);
+  basic_bcd      arg2(p_number);
+  PositionArguments(arg1, arg2, signResult, operatorKind);
+
+  if (operatorKind == Operator::Addition)
+  {
+    arg1 = PositiveAddition(arg1, arg2);
+  }
+  else
+  {
+    // PositionArguments has put the bigger one first
+    arg1 = PositiveSubtraction(arg1, arg2);
+  }
+  arg1.m_sign = signResult;
+
+  return arg1;
+}
+
+// Subtraction operation
+template<int Limbs>
+basic_bcd<Limbs> 
+basic_bcd<Limbs>::Sub(const basic_bcd& p_number) const 
+{
+  // Check if we can subtract
+  if(!IsValid() || !p_number.IsValid())
+  {
+    return SetInfinity(_T("Cannot subtract with INFINITY"));
+  }
+  // NULL always yield a NULL
+  if(IsNULL() || p_number.IsNULL())
+  {
+    return basic_bcd(Sign::ISNULL);
+  }
+  // x-y is equal to  x+(-y)
+  return *this + (-p_number);
+}
+
+// Multiplication
+template<int Limbs>
+basic_bcd<Limbs> 
+basic_bcd<Limbs>::Mul(const basic_bcd& p_number) const 
+{
+  // Check if we can multiply
+  if(!IsValid() || !p_number.IsValid())
+  {
+    return SetInfinity(_T("Cannot multiply with INFINITY"));
+  }
+  // NULL always yield a NULL
+  if(IsNULL() || p_number.IsNULL())
+  {
+    return basic_bcd(Sign::ISNULL);
+  }
+  // Exponent of the result out of range
+  basic_bcd result;
+  if(ExponentOutOfRange(m_exponent + p_number.m_exponent + 1,CalculateSign(*this,p_number),result))
+  {
+    return result;
+  }
+  // Multiplication without signs
+  result = PositiveMultiplication(*this,p_number);
+
+  // Take care of the sign
+  result.m_sign = result.IsZero() ? Sign::Positive : CalculateSign(*this, p_number);
+
+  return result;
+}
+
+// Division
+template<int Limbs>
+basic_bcd<Limbs> 
+basic_bcd<Limbs>::Div(const basic_bcd& p_number) const 
+{
+  // Check if we can divide
+  if(!IsValid() || !p_number.IsValid())
+  {
+    return SetInfinity(_T("Cannot divide with INFINITY"));
+  }
+  // NULL always yield a NULL
+  if(IsNULL() || p_number.IsNULL())
+  {
+    return basic_bcd(Sign::ISNULL);
+  }
+  // If divisor is zero -> ERROR
+  if(p_number.IsZero())
+  {
+    return SetInfinity(_T("BCD: Division by zero."),bcd_context::StatusDivideByZero);
+  }
+  // Shortcut: result is zero if this is zero
+  if(IsZero())
+  {
+    return *this;
+  }
+  // Exponent of the result out of range
+  basic_bcd result;
+  if(ExponentOutOfRange(m_exponent - p_number.m_exponent,CalculateSign(*this,p_number),result))
+  {
+    return result;
+  }
+  // Division without signs
+  result = PositiveDivision(*this,p_number);
+
+  // Take care of the sign
+  result.m_sign = result.IsZero() ? Sign::Positive : CalculateSign(*this, p_number);
+
+  return result;
+}
+
+// Modulo
+template<int Limbs>
+basic_bcd<Limbs> 
+basic_bcd<Limbs>::Mod(const basic_bcd& p_number) const 
+{
+  // Check if we can do a modulo
+  if(!IsValid() || !p_number.IsValid())
+  {
+    return SetInfinity(_T("Cannot do a modulo with INFINITY"));
+  }
+  // NULL always yield a NULL
+  if(IsNULL() || p_number.IsNULL())
+  {
+    return basic_bcd(Sign::ISNULL);
+  }
+  basic_bcd quotient;
+  basic_bcd remainder;
+  DivMod(p_number,quotient,remainder);
+  return remainder;
+}
+
+// Multiplication by a small integer
+// Description: Skips the construction of a bcd and the general multiplication
+template<int Limbs>
+basic_bcd<Limbs>
+basic_bcd<Limbs>::MulInt(const int p_value) const
+{
+  // Check if we can multiply
+  if(!IsValid())
+  {
+    return SetInfinity(_T("Cannot multiply with INFINITY"));
+  }
+  // NULL always yield a NULL
+  if(IsNULL())
+  {
+    return basic_bcd(Sign::ISNULL);
+  }
+  if(IsZero() || p_value == 0)
+  {
+    return basic_bcd();
+  }
+  // Multiplication without signs
+  basic_bcd result = ScalarMultiplication(p_value < 0 ? (uint64)(-(int64)p_value) : (uint64)p_value);
+
+  // Take care of the sign
+  bool negative = (m_sign == Sign::Negative) != (p_value < 0);
+  if(!result.IsValid())
+  {
+    result.m_sign = negative ? Sign::MIN_INF : Sign::INF;
+  }
+  else if(!result.IsZero())
+  {
+    result.m_sign = negative ? Sign::Negative : Sign::Positive;
+  }
+  return result;
+}
+
+// Division by a small integer
+// Description: Skips the construction of a bcd and the general division
+template<int Limbs>
+basic_bcd<Limbs>
+basic_bcd<Limbs>::DivInt(const int p_value) const
+{
+  // Check if we can divide
+  if(!IsValid())
+  {
+    return SetInfinity(_T("Cannot divide with INFINITY"));
+  }
+  // NULL always yield a NULL
+  if(IsNULL())
+  {
+    return basic_bcd(Sign::ISNULL);
+  }
+  // If divisor is zero -> ERROR
+  if(p_value == 0)
+  {
+    return SetInfinity(_T("BCD: Division by zero."),bcd_context::StatusDivideByZero);
+  }
+  // Shortcut: result is zero if this is zero
+  if(IsZero())
+  {
+    return *this;
+  }
+  // Division without signs
+  basic_bcd result = ScalarDivision(p_value < 0 ? (uint64)(-(int64)p_value) : (uint64)p_value);
+
+  // Take care of the sign
+  bool negative = (m_sign == Sign::Negative) != (p_value < 0);
+  if(!result.IsValid())
+  {
+    result.m_sign = negative ? Sign::MIN_INF : Sign::INF;
+  }
+  else if(!result.IsZero())
+  {
+    result.m_sign = negative ? Sign::Negative : Sign::Positive;
+  }
+  return result;
+}
+
+// Modulo by a small integer
+// Description: Same result as Mod(bcd(p_value))
+// Technical:   The remainder of the integer part is taken in one pass over its digits
+//              The fraction is added to it afterwards
+template<int Limbs>
+basic_bcd<Limbs>
+basic_bcd<Limbs>::ModInt(const int p_value) const
+{
+  // Zero divisors and numbers beyond the mantissa take the general way
+  if(p_value == 0 || !IsValid() || IsNULL() || m_exponent >= bcdPrecision)
+  {
+    return Mod(basic_bcd(p_value));
+  }
+  // The sign of the divisor does not matter for a truncated quotient
+  int64 divisor = p_value < 0 ? -(int64)p_value : (int64)p_value;
+
+  // Remainder of the digits before the decimal point
+  // These digits are cleared, so what remains is the fraction
+  basic_bcd fraction(*this);
+  fraction.m_sign = Sign::Positive;
+  int64 remainder = 0;
+  if(m_exponent >= 0)
+  {
+    int digits = m_exponent + 1;
+    for(int ind = 0; digits > 0; ++ind)
+    {
+      if(digits >= bcdDigits)
+      {
+        remainder = (remainder * bcdBase + m_mantissa[ind]) % divisor;
+        fraction.m_mantissa[ind] = 0;
+        digits   -= bcdDigits;
+      }
+      else
+      {
+        int64 power = 1;
+        for(int pos = 0; pos < digits; ++pos)
+        {
+          power *= 10;
+        }
+        remainder = (remainder * power + m_mantissa[ind] / (bcdBase / power)) % divisor;
+        fraction.m_mantissa[ind] %= (long)(bcdBase / power);
+        digits    = 0;
+      }
+    }
+    fraction.Normalize();
+  }
+  basic_bcd mod(basic_bcd((long)remainder) + fraction);
+
+  // Remainder gets the sign of this number
+  if(m_sign == Sign::Negative && !mod.IsZero())
+  {
+    mod.m_sign = Sign::Negative;
+  }
+  return mod;
+}
+
+// Position the arguments for a positive addition or subtraction
+// For a subtraction the bigger absolute value becomes the first argument
+// Only called from within Add()
+template<int Limbs>
+void
+basic_bcd<Limbs>::PositionArguments(basic_bcd&       arg1,
+                       basic_bcd&       arg2,
+                       Sign&      signResult,
+                       Operator&  operatorKind) const
+{
+  // Same signs: addition, and the sign stays
+  // (-x) + (-y) becomes -(x + y)
+  if(arg1.m_sign == arg2.m_sign)
+  {
+    signResult   = arg1.m_sign;
+    operatorKind = Operator::Addition;
+    arg1.m_sign  = Sign::Positive;
+    arg2.m_sign  = Sign::Positive;
+    return;
+  }
+  // Different signs: the sign of the bigger absolute value
+  // x + (-y) becomes x - y, and (-x) + y becomes y - x
+  operatorKind = Operator::Subtraction;
+  int compare  = arg1.CompareAbsolute(arg2);
+  if(compare == 0)
+  {
+    signResult = Sign::Positive;
+  }
+  else if(compare > 0)
+  {
+    signResult = arg1.m_sign;
+  }
+  else
+  {
+    signResult = arg2.m_sign;
+    basic_bcd bigger(arg2);
+    arg2 = arg1;
+    arg1 = bigger;
+  }
+  arg1.m_sign = Sign::Positive;
+  arg2.m_sign = Sign::Positive;
+}
+
+template<int Limbs>
+typename basic_bcd<Limbs>::Sign
+basic_bcd<Limbs>::CalculateSign(const basic_bcd& p_arg1, const basic_bcd& p_arg2) const
+{
+  // Find the sign for multiplication / division
+  // (+x) * (+y) -> positive
+  // (-x) * (+y) -> negative
+  // (-x) * (-y) -> positive
+  // (+x) * (-y) -> negative
+  if (p_arg1.IsZero() || p_arg2.IsZero())
+  {
+    return Sign::Positive;
+  }
+  if(p_arg1.m_sign != p_arg2.m_sign)
+  {
+    return Sign::Negative;
+  }
+  return Sign::Positive;
+}
+
+// Addition of two mantissa (no signs/exponents)
+template<int Limbs>
+basic_bcd<Limbs>
+basic_bcd<Limbs>::PositiveAddition(basic_bcd& arg1,basic_bcd& arg2) const
+{
+  // Take care of the exponents
+  if(arg1.m_exponent != arg2.m_exponent)
+  {
+    // If numbers differ more than this, an addition is useless
+    int border = bcdDigits * bcdLength;
+
+    if(arg1.m_exponent > arg2.m_exponent)
+    {
+      int shift = arg1.m_exponent - arg2.m_exponent;
+      if(shift > border)
+      {
+        // Adding arg2 will not result in a difference
+        RaiseInexact(!arg2.IsZero());
+        return arg1;
+      }
+      // Shift arg2 to the right;
+      RaiseInexact(arg2.Div10(shift));
+    }
+    else
+    {
+      int shift = arg2.m_exponent - arg1.m_exponent;
+      if(shift > border)
+      {
+        // Adding arg1 will not result in a difference
+        RaiseInexact(!arg1.IsZero());
+        return arg2;
+      }
+      // Shift arg1 to the right
+      RaiseInexact(arg1.Div10(shift));
+      arg1.m_exponent += (short) shift;
+    }
+  }
+  // Do the addition of the significant limbs of the mantissa
+  int length = max(arg1.SignificantLimbs(),arg2.SignificantLimbs());
+  int64 carry = 0L;
+  for(int ind = length - 1;ind >= 0; --ind)
+  {
+    int64 reg = ((int64)arg1.m_mantissa[ind]) + ((int64)arg2.m_mantissa[ind]) + carry;
+    carry = reg / bcdBase;
+    arg1.m_mantissa[ind] = reg % bcdBase;
+  }
+  // Take care of carry
+  if(carry)
+  {
+    RaiseInexact(arg1.Div10());
+    arg2.Div10();
+    arg1.m_exponent++;
+    arg1.m_mantissa[0] += (long)(carry * (bcdBase / 10));
+  }
+  return arg1;
+}
+
+// Subtraction of two mantissa (no signs/exponents)
+// Precondition arg1 > arg2
+template<int Limbs>
+basic_bcd<Limbs>
+basic_bcd<Limbs>::PositiveSubtraction(basic_bcd& arg1,basic_bcd& arg2) const
+{
+  // Take care of the exponents
+  if(arg1.m_exponent != arg2.m_exponent)
+  {
+    // If numbers differ more than this, an addition is useless
+    int border = bcdDigits * bcdLength;
+
+    int shift = arg1.m_exponent - arg2.m_exponent;
+    if(shift > border)
+    {
+      // Adding arg2 will not result in a difference
+      RaiseInexact(!arg2.IsZero());
+      return arg1;
+    }
+    if (shift > 0)
+    {
+      // Shift arg2 to the right;
+      RaiseInexact(arg2.Div10(shift));
+    }
+    else
+    {
+      arg2.Mult10(-shift);
+    }
+  }
+  // Do the subtraction of the significant limbs of the mantissa
+  int length = max(arg1.SignificantLimbs(),arg2.SignificantLimbs());
+  for(int ind = length - 1;ind >= 0; --ind)
+  {
+    if(arg1.m_mantissa[ind] >= arg2.m_mantissa[ind])
+    {
+      arg1.m_mantissa[ind] -= arg2.m_mantissa[ind];
+    }
+    else
+    {
+      int64 reg = ((int64)bcdBase + arg1.m_mantissa[ind]) - arg2.m_mantissa[ind];
+      arg1.m_mantissa[ind] = (long) reg;
+      // Take care of carry
+      if(ind > 0)
+      {
+        arg1.m_mantissa[ind - 1] -= 1;
+      }
+    }
+  }
+  // Normalize the mantissa/exponent
+  arg1.Normalize();
+
+  // Return the result
+  return arg1;
+}
+
+// bcd::MultiplyColumns
+// Description: Column sums of the product of two limb arrays of the same length
+// Technical:   The result gets (2 * p_length - 1) columns, not yet normalized to bcdBase
+// Karatsuba: (a1.X + a0)(b1.X + b0) = a1b1.X^2 + ((a1 + a0)(b1 + b0) - a1b1 - a0b0).X + a0b0
+// The middle term is the sum of the cross products, so no column ever gets negative.
+// Each split doubles the size of the limbs, but (length * 2^splits * 1E16) stays below 2^64.
+template<int Limbs>
+void
+basic_bcd<Limbs>::MultiplyColumns(const uint64* p_one,const uint64* p_two,const int p_length,uint64* p_result)
+{
+  if(p_length < BCD_KARATSUBA_LIMBS || p_length < 2)
+  {
+    memset(p_result,0,(2 * p_length - 1) * sizeof(uint64));
+    for(int i = 0; i < p_length; ++i)
+    {
+      // Zero limbs (the tail of a shorter mantissa) add nothing
+      uint64 number = p_one[i];
+      if(number == 0)
+      {
+        continue;
+      }
+      for(int j = 0; j < p_length; ++j)
+      {
+        p_result[i + j] += number * p_two[j];
+      }
+    }
+    return;
+  }
+
+  // Split in a lower part and a (possibly one longer) upper part
+  int lower = p_length / 2;
+  int upper = p_length - lower;
+
+  uint64 sumOne[bcdLength];
+  uint64 sumTwo[bcdLength];
+  uint64 middle[2 * bcdLength];
+  for(int ind = 0; ind < upper; ++ind)
+  {
+    sumOne[ind] = p_one[lower + ind] + (ind < lower ? p_one[ind] : 0);
+    sumTwo[ind] = p_two[lower + ind] + (ind < lower ? p_two[ind] : 0);
+  }
+
+  // The lower and upper products go directly into the result
+  uint64* lowerPart = p_result;
+  uint64* upperPart = p_result + 2 * lower;
+  MultiplyColumns(p_one,        p_two,        lower,lowerPart);
+  MultiplyColumns(p_one + lower,p_two + lower,upper,upperPart);
+  MultiplyColumns(sumOne,       sumTwo,       upper,middle);
+  lowerPart[2 * lower - 1] = 0;
+
+  // Middle term is the cross product, added one part further
+  for(int ind = 0; ind < 2 * lower - 1; ++ind)
+  {
+    middle[ind] -= lowerPart[ind];
+  }
+  for(int ind = 0; ind < 2 * upper - 1; ++ind)
+  {
+    middle[ind] -= upperPart[ind];
+  }
+  for(int ind = 0; ind < 2 * upper - 1; ++ind)
+  {
+    p_result[lower + ind] += middle[ind];
+  }
+}
+
+// bcd::PositiveMultiplication
+// Description: Multiplication of two mantissa (no signs)
+// Technical:   1) addition of the exponents
+//              2) multiplication of the mantissa in column sums
+//                 (schoolbook or Karatsuba, see MultiplyColumns)
+//              3) take-in carry and normalize in one sweep
+template<int Limbs>
+basic_bcd<Limbs>
+basic_bcd<Limbs>::PositiveMultiplication(const basic_bcd& p_arg1,const basic_bcd& p_arg2) const
+{
+  basic_bcd result;
+  uint64 res[2 * bcdLength] = { 0 };
+
+  int limbs = FullProduct(p_arg1,p_arg2,res);
+  if(limbs == 0)
+  {
+    return result;
+  }
+
+  // Possibly perform rounding of res[bcdLength] -> res[bcdLength-1]
+  // Columns that fall off the mantissa make the result inexact
+  bool inexact = false;
+  for(int ind = bcdLength; ind < limbs; ++ind)
+  {
+    inexact |= (res[ind] != 0);
+  }
+  RaiseInexact(inexact);
+
+  // Put the resulting mantissa's in the result
+  for(int ind = 0; ind < bcdLength; ++ind)
+  {
+    result.m_mantissa[ind] = (long)res[ind];
+  }
+
+  // Take care of exponents
+  // Multiplication is the addition of the exponents
+  // Add 1 for the implied 1 position of the second argument
+  result.m_exponent = p_arg1.m_exponent + p_arg2.m_exponent + 1;
+
+  // Normalize to implied dec.point position
+  result.Normalize();
+
+  return result;
+}
+
+// bcd::FullProduct
+// Description: Full product of two mantissa (no signs)
+// Technical:   Every product is below bcdBase^2 (1E16), so a column of
+//              bcdLength products stays well below the 64 bits limit (1.8E19)
+//              and we can defer the carries until all products are added.
+//              The first limb is left free for the carry of the first column,
+//              so the product has the exponent (exponent1 + exponent2 + 1).
+//              Only the significant limbs take part. The columns after them stay zero.
+//              The shorter mantissa goes first, so the schoolbook loop skips its tail.
+//              p_product must have room for 2 * bcdLength limbs, all zero.
+template<int Limbs>
+int
+basic_bcd<Limbs>::FullProduct(const basic_bcd& p_arg1,const basic_bcd& p_arg2,uint64* p_product)
+{
+  uint64 one[bcdLength];
+  uint64 two[bcdLength];
+
+  int limbs1 = p_arg1.SignificantLimbs();
+  int limbs2 = p_arg2.SignificantLimbs();
+  int length = max(limbs1,limbs2);
+  if(length == 0)
+  {
+    return 0;
+  }
+  const basic_bcd& shorter = (limbs1 <= limbs2) ? p_arg1 : p_arg2;
+  const basic_bcd& longer  = (limbs1 <= limbs2) ? p_arg2 : p_arg1;
+  for(int ind = 0; ind < length; ++ind)
+  {
+    one[ind] = (uint64)shorter.m_mantissa[ind];
+    two[ind] = (uint64)longer .m_mantissa[ind];
+  }
+  MultiplyColumns(one,two,length,&p_product[1]);
+
+  // Normalize resulting mantissa to bcdBase
+  // The columns after the sum of the significant limbs are zero
+  uint64 carry = 0;
+  for(int ind = limbs1 + limbs2 - 1;ind >= 0; --ind)
+  {
+    uint64 number = p_product[ind] + carry;
+    carry = DivideByBase(number);
+    p_product[ind] = number - carry * bcdBase;
+  }
+  return 2 * length;
+}
+
+// bcd::ColumnAddition
+// Description: Set this to (p_one + p_two) or (p_one - p_two) of two valid numbers
+// Technical:   As Add(), but the absolute values are compared only once to find
+//              the order of a subtraction and the sign of the result.
+//              This may be one of the arguments.
+template<int Limbs>
+void
+basic_bcd<Limbs>::ColumnAddition(const basic_bcd& p_one,const basic_bcd& p_two,bool p_subtract)
+{
+  // Signs of the arguments, before this gets written. Sign of the second as it is added
+  Sign signOne = p_one.m_sign;
+  Sign signTwo = p_two.m_sign;
+  if(p_subtract)
+  {
+    signTwo = (signTwo == Sign::Positive) ? Sign::Negative : Sign::Positive;
+  }
+  // Adding zero gives the other number
+  if(p_two.IsZero())
+  {
+    *this = p_one;
+    return;
+  }
+  if(p_one.IsZero())
+  {
+    *this  = p_two;
+    m_sign = signTwo;
+    return;
+  }
+  basic_bcd arg1(p_one);
+  basic_bcd arg2(p_two);
+  arg1.m_sign = Sign::Positive;
+  arg2.m_sign = Sign::Positive;
+
+  // Same signs: addition and the sign stays
+  if(signOne == signTwo)
+  {
+    *this  = PositiveAddition(arg1,arg2);
+    m_sign = signTwo;
+    return;
+  }
+  // Different signs: subtract the smaller from the bigger absolute value
+  int compare = arg1.CompareAbsolute(arg2);
+  if(compare == 0)
+  {
+    Zero();
+  }
+  else if(compare > 0)
+  {
+    *this  = PositiveSubtraction(arg1,arg2);
+    m_sign = IsZero() ? Sign::Positive : signOne;
+  }
+  else
+  {
+    *this  = PositiveSubtraction(arg2,arg1);
+    m_sign = IsZero() ? Sign::Positive : signTwo;
+  }
+}
+
+// bcd::ColumnMultiplication
+// Description: Set this to (p_one * p_two) of two valid numbers
+// Technical:   As Mul() but without the checks on NULL and INF.
+//              This may be one of the arguments.
+template<int Limbs>
+void
+basic_bcd<Limbs>::ColumnMultiplication(const basic_bcd& p_one,const basic_bcd& p_two)
+{
+  Sign sign = CalculateSign(p_one,p_two);
+  if(ExponentOutOfRange(p_one.m_exponent + p_two.m_exponent + 1,sign,*this))
+  {
+    return;
+  }
+  *this  = PositiveMultiplication(p_one,p_two);
+  m_sign = IsZero() ? Sign::Positive : sign;
+}
+
+// bcd::PositiveDivision
+// Description: Division of two mantissa (no signs)
+// Technical:   Long division in base bcdBase, one whole mantissa limb per step
+//              (Knuth, The Art of Computer Programming Vol.2 Algorithm D)
+//              1) Scale dividend and divisor so the first divisor limb >= bcdBase/2
+//              2) Estimate a quotient limb from the first limbs of the dividend
+//              3) Multiply and subtract. The estimate is at most one too high
+//                 so we must add back at most once.
+//              4) Shift the quotient limbs to the implied decimal point position
+template<int Limbs>
+basic_bcd<Limbs>
+basic_bcd<Limbs>::PositiveDivision(const basic_bcd& p_arg1,const basic_bcd& p_arg2) const
+{
+  basic_bcd result;
+  int64 dividend[2 * bcdLength + 2] = { 0 };
+  int64 divisor [bcdLength]         = { 0 };
+  int64 quotient[bcdLength + 2]     = { 0 };
+
+  // Trailing zero limbs of the divisor do not take part in the division
+  int length = max(p_arg2.SignificantLimbs(),1);
+
+  // Scaling factor. As the mantissa is normalized, this is always 1..9
+  int64 factor = bcdBase / ((int64)p_arg2.m_mantissa[0] + 1);
+
+  // Scale the divisor. Cannot overflow into an extra limb
+  int64 carry = 0;
+  for(int ind = length - 1; ind >= 0; --ind)
+  {
+    int64 number  = (int64)p_arg2.m_mantissa[ind] * factor + carry;
+    divisor[ind]  = number % bcdBase;
+    carry         = number / bcdBase;
+  }
+
+  // Scale the dividend. One extra limb in front to catch the overflow
+  // The zero limbs behind it give us (bcdLength + 2) quotient limbs
+  carry = 0;
+  for(int ind = p_arg1.SignificantLimbs() - 1; ind >= 0; --ind)
+  {
+    int64 number      = (int64)p_arg1.m_mantissa[ind] * factor + carry;
+    dividend[ind + 1] = number % bcdBase;
+    carry             = number / bcdBase;
+  }
+  dividend[0] = carry;
+
+  // Get one quotient limb per step
+  for(int step = 0; step < bcdLength + 2; ++step)
+  {
+    // Estimate the quotient limb from the first two limbs of the dividend
+    int64 number = dividend[step] * bcdBase + dividend[step + 1];
+    int64 guess  = number / divisor[0];
+    int64 rest   = number % divisor[0];
+
+    // Refine the estimate with the second limb of the divisor
+    // After this the estimate is exact or at most one too high
+    while(guess >= bcdBase || (length > 1 && guess * divisor[1] > rest * bcdBase + dividend[step + 2]))
+    {
+      --guess;
+      rest += divisor[0];
+      if(rest >= bcdBase)
+      {
+        break;
+      }
+    }
+
+    // Multiply and subtract: dividend -= guess * divisor
+    int64 borrow = 0;
+    carry = 0;
+    for(int ind = length - 1; ind >= 0; --ind)
+    {
+      int64 product = guess * divisor[ind] + carry;
+      carry = product / bcdBase;
+      int64 limb = dividend[step + 1 + ind] - (product % bcdBase) - borrow;
+      borrow = 0;
+      if(limb < 0)
+      {
+        limb  += bcdBase;
+        borrow = 1;
+      }
+      dividend[step + 1 + ind] = limb;
+    }
+    int64 first = dividend[step] - carry - borrow;
+
+    // Estimate was one too high: add back the divisor once
+    if(first < 0)
+    {
+      --guess;
+      carry = 0;
+      for(int ind = length - 1; ind >= 0; --ind)
+      {
+        int64 limb = dividend[step + 1 + ind] + divisor[ind] + carry;
+        carry = limb / bcdBase;
+        dividend[step + 1 + ind] = limb % bcdBase;
+      }
+      first += carry;
+    }
+    dividend[step] = first;
+    quotient[step] = guess;
+  }
+
+  // A remainder, or quotient digits that fall off the mantissa, make the result inexact
+  bool inexact = quotient[0] ? (quotient[bcdLength] % 10 != 0) : false;
+  inexact |= (quotient[bcdLength + 1] != 0);
+  for(int ind = 0; ind < 2 * bcdLength + 2; ++ind)
+  {
+    inexact |= (dividend[ind] != 0);
+  }
+  RaiseInexact(inexact);
+
+  // Subtraction of the exponents
+  result.m_exponent = p_arg1.m_exponent - p_arg2.m_exponent;
+
+  // The first quotient limb is the integer part (0..9) of the mantissa quotient
+  if(quotient[0])
+  {
+    // Shift the quotient limbs 1 digit less than a limb to the right
+    for(int ind = 0; ind < bcdLength; ++ind)
+    {
+      result.m_mantissa[ind] = (long)((quotient[ind] % 10) * (bcdBase / 10) + quotient[ind + 1] / 10);
+    }
+  }
+  else
+  {
+    // Quotient is smaller than one, and the next limb is already normalized
+    for(int ind = 0; ind < bcdLength; ++ind)
+    {
+      result.m_mantissa[ind] = (long)quotient[ind + 1];
+    }
+    result.m_exponent--;
+  }
+
+  // Return the result
+  return result;
+}
+
+// bcd::PositiveDivMod
+// Description: Truncated quotient and exact remainder of two mantissa (no signs)
+// Technical:   Both mantissa are read as integers of bcdLength limbs.
+//              The dividend is shifted (exponent1 - exponent2) digits to the left,
+//              so both integers get the unit of the last digit of the divisor.
+//              The long division in base bcdBase (Knuth Algorithm D) streams the
+//              dividend limbs through a window of (bcdLength + 1) limbs.
+//              What is left in the window is the remainder, in the unit of the divisor.
+//              Precondition: p_arg1.m_exponent >= p_arg2.m_exponent
+template<int Limbs>
+void
+basic_bcd<Limbs>::PositiveDivMod(const basic_bcd& p_arg1,const basic_bcd& p_arg2,basic_bcd& p_quotient,basic_bcd& p_remainder) const
+{
+  int64  front[bcdLength + 1] = { 0 };
+  int64  divisor[bcdLength];
+  int64  window[bcdLength + 1];
+  uint64 quotient[bcdLength + 2] = { 0 };
+
+  // Whole zero limbs and digits the dividend is shifted to the left
+  int shift  = p_arg1.m_exponent - p_arg2.m_exponent;
+  int zeros  = shift / bcdDigits;
+  int64 multiplier = 1;
+  for(int ind = 0; ind < shift % bcdDigits; ++ind)
+  {
+    multiplier *= 10;
+  }
+
+  // Scaling factor. As the mantissa is normalized, this is always 1..9
+  int64 factor = bcdBase / ((int64)p_arg2.m_mantissa[0] + 1);
+
+  // Scale the divisor. Cannot overflow into an extra limb
+  int64 carry = 0;
+  for(int ind = bcdLength - 1; ind >= 0; --ind)
+  {
+    int64 number = (int64)p_arg2.m_mantissa[ind] * factor + carry;
+    divisor[ind] = number % bcdBase;
+    carry        = number / bcdBase;
+  }
+
+  // Shift and scale the dividend. One extra limb in front to catch the overflow
+  carry = 0;
+  for(int ind = bcdLength - 1; ind >= 0; --ind)
+  {
+    int64 number   = (int64)p_arg1.m_mantissa[ind] * multiplier + carry;
+    carry          = number / bcdBase;
+    front[ind + 1] = number % bcdBase;
+  }
+  front[0] = carry;
+  carry = 0;
+  for(int ind = bcdLength; ind >= 0; --ind)
+  {
+    int64 number = front[ind] * factor + carry;
+    front[ind]   = number % bcdBase;
+    carry        = number / bcdBase;
+  }
+
+  // First window is a zero limb and the first dividend limbs
+  window[0] = 0;
+  for(int ind = 0; ind < bcdLength; ++ind)
+  {
+    window[ind + 1] = front[ind];
+  }
+
+  // One quotient limb per step. After the first step, the next dividend limb
+  // (the last limb of the front, then the zero limbs) moves into the window.
+  int  steps   = zeros + 2;
+  int  first   = -1;
+  bool dropped = false;
+  for(int step = 0; step < steps; ++step)
+  {
+    if(step > 0)
+    {
+      for(int ind = 0; ind < bcdLength; ++ind)
+      {
+        window[ind] = window[ind + 1];
+      }
+      window[bcdLength] = (step == 1) ? front[bcdLength] : 0;
+    }
+
+    // Estimate the quotient limb from the first two limbs of the window
+    int64 number = window[0] * bcdBase + window[1];
+    int64 guess  = number / divisor[0];
+    int64 rest   = number % divisor[0];
+
+    // Refine the estimate with the second limb of the divisor
+    while(guess >= bcdBase || guess * divisor[1] > rest * bcdBase + window[2])
+    {
+      --guess;
+      rest += divisor[0];
+      if(rest >= bcdBase)
+      {
+        break;
+      }
+    }
+
+    // Multiply and subtract: window -= guess * divisor
+    int64 borrow = 0;
+    carry = 0;
+    for(int ind = bcdLength - 1; ind >= 0; --ind)
+    {
+      int64 product = guess * divisor[ind] + carry;
+      carry = product / bcdBase;
+      int64 limb = window[ind + 1] - (product % bcdBase) - borrow;
+      borrow = 0;
+      if(limb < 0)
+      {
+        limb  += bcdBase;
+        borrow = 1;
+      }
+      window[ind + 1] = limb;
+    }
+    int64 top = window[0] - carry - borrow;
+
+    // Estimate was one too high: add back the divisor once
+    if(top < 0)
+    {
+      --guess;
+      carry = 0;
+      for(int ind = bcdLength - 1; ind >= 0; --ind)
+      {
+        int64 limb = window[ind + 1] + divisor[ind] + carry;
+        carry = limb / bcdBase;
+        window[ind + 1] = limb % bcdBase;
+      }
+      top += carry;
+    }
+    window[0] = top;
+
+    // Keep the leading quotient limbs
+    if(first < 0 && guess)
+    {
+      first = step;
+    }
+    if(first >= 0 && step - first < bcdLength + 2)
+    {
+      quotient[step - first] = (uint64)guess;
+    }
+    else if(guess)
+    {
+      dropped = true;
+    }
+  }
+
+  // Unscale the remainder. The division by the factor is exact
+  p_remainder.Zero();
+  int64 remainder = 0;
+  for(int ind = 0; ind < bcdLength; ++ind)
+  {
+    int64 number = remainder * bcdBase + window[ind + 1];
+    p_remainder.m_mantissa[ind] = (long)(number / factor);
+    remainder = number % factor;
+  }
+  p_remainder.Normalize(p_arg2.m_exponent);
+
+  // The integer quotient, shifted to the implied decimal point position
+  p_quotient.Zero();
+  if(first < 0)
+  {
+    return;
+  }
+  int leading = 0;
+  for(uint64 number = quotient[0]; number * 10 < bcdBase; number *= 10)
+  {
+    ++leading;
+  }
+  uint64 power = 1;
+  for(int ind = 0; ind < leading; ++ind)
+  {
+    power *= 10;
+  }
+  uint64 divide = bcdBase / power;
+  for(int ind = 0; ind < bcdLength; ++ind)
+  {
+    p_quotient.m_mantissa[ind] = (long)((quotient[ind] % divide) * power + quotient[ind + 1] / divide);
+  }
+  p_quotient.m_exponent = (short)((steps - first) * bcdDigits - leading - 1);
+
+  // Quotient digits that fall off the mantissa make the quotient inexact
+  RaiseInexact(dropped || quotient[bcdLength] % divide != 0 || quotient[bcdLength + 1] != 0);
+}
+
+// bcd::ScalarMultiplication
+// Description: Multiplication of the mantissa by one 32 bits value (no signs)
+// Technical:   One carry pass from the last limb to the first
+//              The carry out of the first limb (up to 10 digits) is
+//              shifted in from the front in one remainder pass
+template<int Limbs>
+basic_bcd<Limbs>
+basic_bcd<Limbs>::ScalarMultiplication(const uint64 p_value) const
+{
+  basic_bcd result;
+
+  // Every product is below bcdBase * 2^32, so the carry stays in 64 bits
+  uint64 carry = 0;
+  for(int ind = SignificantLimbs() - 1; ind >= 0; --ind)
+  {
+    uint64 number = (uint64)m_mantissa[ind] * p_value + carry;
+    carry = DivideByBase(number);
+    result.m_mantissa[ind] = (long)(number - carry * bcdBase);
+  }
+  int shift = 0;
+  for(uint64 top = carry; top > 0; top /= 10)
+  {
+    ++shift;
+  }
+  // Exponent of the result out of range
+  if(ExponentOutOfRange(m_exponent + shift,Sign::Positive,result))
+  {
+    return result;
+  }
+  result.m_exponent = (short)(m_exponent + shift);
+
+  // Shift the carry in from the front
+  if(shift)
+  {
+    uint64 divisor = 1;
+    for(int ind = 0; ind < shift; ++ind)
+    {
+      divisor *= 10;
+    }
+    // With more than bcdDigits to shift, the remainder flows two limbs further
+    uint64 remainder = carry;
+    int length = min(result.SignificantLimbs() + 2,bcdLength);
+    for(int ind = 0; ind < length; ++ind)
+    {
+      uint64 number = remainder * bcdBase + result.m_mantissa[ind];
+      result.m_mantissa[ind] = (long)(number / divisor);
+      remainder = number % divisor;
+    }
+    RaiseInexact(remainder != 0);
+  }
+  return result;
+}
+
+// bcd::ScalarDivision
+// Description: Division of the mantissa by one 32 bits value (no signs)
+// Technical:   One remainder pass from the first limb to the last
+//              Two extra quotient limbs cover the leading zero digits of a
+//              quotient smaller than one, as the divisor has at most 10 digits
+template<int Limbs>
+basic_bcd<Limbs>
+basic_bcd<Limbs>::ScalarDivision(const uint64 p_value) const
+{
+  basic_bcd result;
+  uint64 quotient[bcdLength + 3];
+
+  // The remainder stays below 2^32, so (remainder * bcdBase) stays in 64 bits
+  uint64 remainder = 0;
+  int    length    = SignificantLimbs();
+  for(int ind = 0; ind < bcdLength + 3; ++ind)
+  {
+    uint64 number = remainder * bcdBase + (ind < length ? (uint64)m_mantissa[ind] : 0);
+    quotient[ind] = number / p_value;
+    remainder     = number % p_value;
+  }
+
+  // Leading zero limbs and digits of the quotient
+  int first = 0;
+  while(quotient[first] == 0)
+  {
+    ++first;
+  }
+  int shift = 0;
+  for(uint64 number = quotient[first]; number * 10 < bcdBase; number *= 10)
+  {
+    ++shift;
+  }
+  // Exponent of the result out of range
+  int exponent = m_exponent - first * bcdDigits - shift;
+  if(ExponentOutOfRange(exponent,Sign::Positive,result))
+  {
+    return result;
+  }
+  result.m_exponent = (short)exponent;
+
+  // Shift the quotient limbs to the left
+  uint64 factor = 1;
+  for(int ind = 0; ind < shift; ++ind)
+  {
+    factor *= 10;
+  }
+  uint64 divisor = bcdBase / factor;
+  for(int ind = 0; ind < bcdLength; ++ind)
+  {
+    uint64 next = (first + ind + 1 < bcdLength + 3) ? quotient[first + ind + 1] : 0;
+    result.m_mantissa[ind] = (long)((quotient[first + ind] % divisor) * factor + next / divisor);
+  }
+
+  // A remainder, or quotient digits that fall off the mantissa, make the result inexact
+  bool inexact = (remainder != 0);
+  int  last    = first + bcdLength;
+  if(last < bcdLength + 3)
+  {
+    inexact |= (quotient[last] % divisor != 0);
+    for(int ind = last + 1; ind < bcdLength + 3; ++ind)
+    {
+      inexact |= (quotient[ind] != 0);
+    }
+  }
+  RaiseInexact(inexact);
+  return result;
+}
+
+// On overflow we set negative or positive infinity
+// The status is raised in the context of the current thread
+// Only the throwing mode builds an exception from the reason
+template<int Limbs>
+basic_bcd<Limbs>
+basic_bcd<Limbs>::SetInfinity(LPCTSTR p_reason /*= ""*/,unsigned p_status /*= StatusInvalid*/) const
+{
+  bcd_context& context = bcd_context::Current();
+  context.RaiseStatus(p_status);
+  if(context.m_throwing)
+  {
+    throw StdException(p_reason);
+  }
+  // NaN AND previous infinity is set to positive infinity !!
+  basic_bcd inf;
+  inf.m_sign = (m_sign == Sign::Negative) ? Sign::MIN_INF : Sign::INF;
+  return inf;
+}
+
+// Exponent of a multiplication or division out of the range of m_exponent
+// Overflow gives (-)INF, underflow gives zero (inexact)
+template<int Limbs>
+bool
+basic_bcd<Limbs>::ExponentOutOfRange(int p_exponent,Sign p_sign,basic_bcd& p_result) const
+{
+  if(p_exponent > SHRT_MAX)
+  {
+    basic_bcd sign;
+    sign.m_sign = p_sign;
+    p_result = sign.SetInfinity(_T("BCD: Overflow of the exponent."),bcd_context::StatusOverflow);
+    return true;
+  }
+  if(p_exponent < SHRT_MIN)
+  {
+    bcd_context::Current().RaiseStatus(bcd_context::StatusInexact);
+    p_result.Zero();
+    return true;
+  }
+  return false;
+}
+
+// Conversion to another datatype is not possible
+// Throws, or raises the status for the caller to check
+template<int Limbs>
+void
+basic_bcd<Limbs>::ConversionError(LPCTSTR p_reason,unsigned p_status /*= StatusOverflow*/) const
+{
+  bcd_context& context = bcd_context::Current();
+  context.RaiseStatus(p_status);
+  if(context.m_throwing)
+  {
+    throw StdException(p_reason);
+  }
+}
+
+// Raise the inexact status if digits were lost
+template<int Limbs>
+void
+basic_bcd<Limbs>::RaiseInexact(bool p_inexact) const
+{
+  if(p_inexact)
+  {
+    bcd_context::Current().RaiseStatus(bcd_context::StatusInexact);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////
+//
+// END OF BASIC OPERATIONS OF BCD
+//
+//////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////
+//
+// COLUMN OPERATIONS OF BCD
+//
+//////////////////////////////////////////////////////////////////////////
+
+// Column addition: p_result[i] = p_one[i] + p_two[i]
+// The result may be one of the arguments (in place).
+// With p_clean the caller guarantees that no argument is NULL, INF or NaN,
+// so the element loop does not branch on that.
+template<int Limbs>
+void
+basic_bcd<Limbs>::Add(const basic_bcd* p_one,const basic_bcd* p_two,basic_bcd* p_result,size_t p_count,bool p_clean /*=false*/)
+{
+  for(size_t ind = 0; ind < p_count; ++ind)
+  {
+    if(p_clean || (p_one[ind].IsValid() && p_two[ind].IsValid()))
+    {
+      p_result[ind].ColumnAddition(p_one[ind],p_two[ind],false);
+    }
+    else
+    {
+      p_result[ind] = p_one[ind].Add(p_two[ind]);
+    }
+  }
+}
+
+// Column subtraction: p_result[i] = p_one[i] - p_two[i]
+template<int Limbs>
+void
+basic_bcd<Limbs>::Sub(const basic_bcd* p_one,const basic_bcd* p_two,basic_bcd* p_result,size_t p_count,bool p_clean /*=false*/)
+{
+  for(size_t ind = 0; ind < p_count; ++ind)
+  {
+    if(p_clean || (p_one[ind].IsValid() && p_two[ind].IsValid()))
+    {
+      p_result[ind].ColumnAddition(p_one[ind],p_two[ind],true);
+    }
+    else
+    {
+      p_result[ind] = p_one[ind].Sub(p_two[ind]);
+    }
+  }
+}
+
+// Column multiplication: p_result[i] = p_one[i] * p_two[i]
+template<int Limbs>
+void
+basic_bcd<Limbs>::Mul(const basic_bcd* p_one,const basic_bcd* p_two,basic_bcd* p_result,size_t p_count,bool p_clean /*=false*/)
+{
+  for(size_t ind = 0; ind < p_count; ++ind)
+  {
+    if(p_clean || (p_one[ind].IsValid() && p_two[ind].IsValid()))
+    {
+      p_result[ind].ColumnMultiplication(p_one[ind],p_two[ind]);
+    }
+    else
+    {
+      p_result[ind] = p_one[ind].Mul(p_two[ind]);
+    }
+  }
+}
+
+// Column scaling: p_result[i] = p_numbers[i] * p_factor
+// The factor is checked once for the whole column
+template<int Limbs>
+void
+basic_bcd<Limbs>::Scale(const basic_bcd* p_numbers,const basic_bcd& p_factor,basic_bcd* p_result,size_t p_count,bool p_clean /*=false*/)
+{
+  // Results may overwrite the factor
+  basic_bcd factor(p_factor);
+  if(!factor.IsValid())
+  {
+    for(size_t ind = 0; ind < p_count; ++ind)
+    {
+      p_result[ind] = p_numbers[ind].Mul(factor);
+    }
+    return;
+  }
+  for(size_t ind = 0; ind < p_count; ++ind)
+  {
+    if(p_clean || p_numbers[ind].IsValid())
+    {
+      p_result[ind].ColumnMultiplication(p_numbers[ind],factor);
+    }
+    else
+    {
+      p_result[ind] = p_numbers[ind].Mul(factor);
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////
+//
+// END OF COLUMN OPERATIONS OF BCD
+//
+//////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////
+//
+// ACCUMULATOR OF BCD
+//
+//////////////////////////////////////////////////////////////////////////
+
+// A number adds less than 1.1 * bcdBase to a bin, so 64 bits bins can take
+// this many numbers before the carries must be propagated
+static const unsigned accumulatorCarryInterval = 0x40000000;
+// Extra bins when the register grows, so it does not grow for every new exponent
+static const int      accumulatorSlack         = 4;
+
+template<int Limbs>
+basic_bcd<Limbs>::Accumulator::Accumulator()
+{
+}
+
+template<int Limbs>
+basic_bcd<Limbs>::Accumulator::Accumulator(const Accumulator& p_other)
+{
+  *this = p_other;
+}
+
+template<int Limbs>
+basic_bcd<Limbs>::Accumulator::~Accumulator()
+{
+  if(m_bins != m_local)
+  {
+    delete [] m_bins;
+  }
+}
+
+template<int Limbs>
+typename basic_bcd<Limbs>::Accumulator&
+basic_bcd<Limbs>::Accumulator::operator=(const Accumulator& p_other)
+{
+  if(this != &p_other)
+  {
+    Clear();
+    if(p_other.m_size)
+    {
+      m_bins = (p_other.m_size <= localBins) ? m_local : new int64[p_other.m_size];
+      memcpy(m_bins,p_other.m_bins,p_other.m_size * sizeof(int64));
+    }
+    m_low     = p_other.m_low;
+    m_size    = p_other.m_size;
+    m_count   = p_other.m_count;
+    m_pending = p_other.m_pending;
+    m_special = p_other.m_special;
+    m_result  = p_other.m_result;
+  }
+  return *this;
+}
+
+// bcd::Accumulator::Add
+// Description: Add one number to the sum
+// Technical:   A valid number only adds its limbs to the bins
+//              A NULL, INF or NaN makes the sum what the operator + would give
+template<int Limbs>
+void
+basic_bcd<Limbs>::Accumulator::Add(const basic_bcd& p_number)
+{
+  if(m_special || !p_number.IsValid())
+  {
+    AddSpecial(p_number,false);
+  }
+  else
+  {
+    AddLimbs(p_number.m_mantissa,p_number.SignificantLimbs(),p_number.m_exponent,p_number.m_sign == Sign::Negative);
+  }
+  ++m_count;
+}
+
+// bcd::Accumulator::Sub
+// Description: Subtract one number from the sum
+template<int Limbs>
+void
+basic_bcd<Limbs>::Accumulator::Sub(const basic_bcd& p_number)
+{
+  if(m_special || !p_number.IsValid())
+  {
+    AddSpecial(p_number,true);
+  }
+  else
+  {
+    AddLimbs(p_number.m_mantissa,p_number.SignificantLimbs(),p_number.m_exponent,p_number.m_sign == Sign::Positive);
+  }
+  ++m_count;
+}
+
+template<int Limbs>
+typename basic_bcd<Limbs>::Accumulator&
+basic_bcd<Limbs>::Accumulator::operator+=(const basic_bcd& p_number)
+{
+  Add(p_number);
+  return *this;
+}
+
+template<int Limbs>
+typename basic_bcd<Limbs>::Accumulator&
+basic_bcd<Limbs>::Accumulator::operator-=(const basic_bcd& p_number)
+{
+  Sub(p_number);
+  return *this;
+}
+
+// bcd::Accumulator::Add
+// Description: Add an array of p_count numbers to the sum
+template<int Limbs>
+void
+basic_bcd<Limbs>::Accumulator::Add(const basic_bcd* p_numbers,size_t p_count)
+{
+  for(size_t ind = 0; ind < p_count; ++ind)
+  {
+    Add(p_numbers[ind]);
+  }
+}
+
+// bcd::Accumulator::AddProduct
+// Description: Add the exact product of two numbers to the sum
+// Technical:   All 2 * bcdLength limbs of the full product go into the bins,
+//              so the product is neither normalized nor truncated
+//              A NULL, INF or NaN goes the way of the operators * and +
+template<int Limbs>
+void
+basic_bcd<Limbs>::Accumulator::AddProduct(const basic_bcd& p_one,const basic_bcd& p_two)
+{
+  if(m_special || !p_one.IsValid() || !p_two.IsValid())
+  {
+    AddSpecial(p_one.Mul(p_two),false);
+  }
+  else
+  {
+    uint64 product[2 * bcdLength] = { 0 };
+    long   limbs  [2 * bcdLength];
+    int    length = FullProduct(p_one,p_two,product);
+    for(int ind = 0; ind < length; ++ind)
+    {
+      limbs[ind] = (long) product[ind];
+    }
+    AddLimbs(limbs,length,p_one.m_exponent + p_two.m_exponent + 1,p_one.m_sign != p_two.m_sign);
+  }
+  ++m_count;
+}
+
+// bcd::Accumulator::Add
+// Description: Add the sum of another accumulator to this sum
+// Technical:   The bins are added one by one, so partial sums of (e.g.) several
+//              threads give exactly the same sum as one accumulator for all numbers
+template<int Limbs>
+void
+basic_bcd<Limbs>::Accumulator::Add(const Accumulator& p_other)
+{
+  if(this == &p_other)
+  {
+    Accumulator other(p_other);
+    Add(other);
+    return;
+  }
+  if(p_other.m_special)
+  {
+    AddSpecial(p_other.m_result,false);
+  }
+  else if(m_special)
+  {
+    AddSpecial(p_other.Result(),false);
+  }
+  else if(p_other.m_size)
+  {
+    // Room for the bins of the other and their carries
+    Reserve(p_other.m_low,p_other.m_low + p_other.m_size + 1);
+    int64* bins = m_bins + (p_other.m_low - m_low);
+    for(int ind = 0; ind < p_other.m_size; ++ind)
+    {
+      bins[ind] += p_other.m_bins[ind];
+    }
+    m_pending += p_other.m_pending;
+    if(m_pending >= accumulatorCarryInterval)
+    {
+      m_bins[m_size - 1] += Carry(m_bins,m_size) * bcdBase;
+      m_pending = 0;
+    }
+  }
+  m_count += p_other.m_count;
+}
+
+// bcd::Accumulator::Clear
+// Description: Start again from zero
+template<int Limbs>
+void
+basic_bcd<Limbs>::Accumulator::Clear()
+{
+  if(m_bins != m_local)
+  {
+    delete [] m_bins;
+  }
+  m_bins    = nullptr;
+  m_low     = 0;
+  m_size    = 0;
+  m_count   = 0;
+  m_pending = 0;
+  m_special = false;
+  m_result.Zero();
+}
+
+template<int Limbs>
+uint64
+basic_bcd<Limbs>::Accumulator::GetCount() const
+{
+  return m_count;
+}
+
+// bcd::Accumulator::Result
+// Description: The sum, rounded to the precision of the bcd
+// Technical:   The carries are propagated in a copy of the bins, so adding can go on.
+//              Then the first bcdLength limbs are taken from the first non-zero digit,
+//              and the digits after that are rounded half away from zero (as Round).
+//              Lost digits raise the inexact status, an exponent out of range gives
+//              (-)INF or zero as for the other operations.
+template<int Limbs>
+basic_bcd<Limbs>
+basic_bcd<Limbs>::Accumulator::Result() const
+{
+  if(m_special)
+  {
+    return m_result;
+  }
+  basic_bcd result;
+  if(m_size == 0)
+  {
+    return result;
+  }
+
+  // Only the bins from the first to the last non-zero one (and its carries) take part
+  int first = 0;
+  int last  = m_size - 1;
+  while(first < m_size && m_bins[first] == 0)
+  {
+    ++first;
+  }
+  while(last > first && m_bins[last] == 0)
+  {
+    --last;
+  }
+  if(first == m_size)
+  {
+    return result;
+  }
+  int size = min(last + 3,m_size) - first;
+
+  // Most sums span only a few bins
+  int64  buffer[4 * bcdMaxLength];
+  int64* bins = (size <= 4 * bcdMaxLength) ? buffer : new int64[size];
+  for(int ind = 0; ind < size; ++ind)
+  {
+    bins[ind] = m_bins[first + ind];
+  }
+
+  // A carry out of the last bin means a negative sum: take the magnitude
+  Sign sign = Sign::Positive;
+  if(Carry(bins,size) < 0)
+  {
+    for(int ind = 0; ind < size; ++ind)
+    {
+      bins[ind] = -m_bins[first + ind];
+    }
+    Carry(bins,size);
+    sign = Sign::Negative;
+  }
+
+  int top = size - 1;
+  while(top >= 0 && bins[top] == 0)
+  {
+    --top;
+  }
+  if(top < 0)
+  {
+    if(bins != buffer)
+    {
+      delete [] bins;
+    }
+    return result;
+  }
+
+  // Digits in the first bin, and the shift to normalize the mantissa
+  int digits = bcdDigits;
+  while(bins[top] < g_limbPowers[bcdDigits - digits])
+  {
+    --digits;
+  }
+  // Shifted up by this factor, every bin splits in a high part for the limb
+  // before it, and a low part for its own limb. Both are constant divisions.
+  int64 up = g_limbPowers[digits - 1];
+
+  // The mantissa and one extra limb for the rounding
+  int64 limbs[bcdLength + 1];
+  for(int ind = 0; ind <= bcdLength; ++ind)
+  {
+    int   pos  = top - ind;
+    int64 high = (pos >= 0) ? bins[pos]     * up : 0;
+    int64 low  = (pos >  0) ? bins[pos - 1] * up : 0;
+    limbs[ind] = high % bcdBase + low / bcdBase;
+  }
+  // Any digits after the extra limb
+  int  pos  = top - bcdLength - 1;
+  bool rest = (pos >= 0) && (bins[pos] * up % bcdBase != 0);
+  for(--pos; pos >= 0 && !rest; --pos)
+  {
+    rest = bins[pos] != 0;
+  }
+  if(bins != buffer)
+  {
+    delete [] bins;
+  }
+
+  int exponent = bcdDigits * (m_low + first + top) + digits - 1;
+  result.RaiseInexact(limbs[bcdLength] != 0 || rest);
+  if(limbs[bcdLength] >= bcdBase / 2)
+  {
+    int ind = bcdLength - 1;
+    while(ind >= 0 && ++limbs[ind] == bcdBase)
+    {
+      limbs[ind--] = 0;
+    }
+    // Rounded up to the next power of 10 (9.99 -> 10.0)
+    if(ind < 0)
+    {
+      limbs[0] = bcdBase / 10;
+      ++exponent;
+    }
+  }
+  if(!result.ExponentOutOfRange(exponent,sign,result))
+  {
+    result.m_sign     = sign;
+    result.m_exponent = (short) exponent;
+    for(int ind = 0; ind < bcdLength; ++ind)
+    {
+      result.m_mantissa[ind] = (long) limbs[ind];
+    }
+  }
+  return result;
+}
+
+// bcd::Accumulator::AddLimbs
+// Description: Add the limbs of a mantissa to the bins
+// Technical:   The last digit of limb 'ind' has the value 10^(exponent - 7 - 8 * ind).
+//              With that position split in a bin and a digit shift, the shifted limb
+//              is split over that bin and the next one. The shift is the same for all
+//              limbs of the number, so no exponents are aligned and nothing is normalized.
+template<int Limbs>
+void
+basic_bcd<Limbs>::Accumulator::AddLimbs(const long* p_limbs,int p_count,int p_exponent,bool p_negative)
+{
+  int limbs = p_count;
+  if(limbs == 0)
+  {
+    return;
+  }
+  int   position = p_exponent - (bcdDigits - 1);
+  int   bin      = (position >= 0) ? position / bcdDigits : -((bcdDigits - 1 - position) / bcdDigits);
+  int64 factor   = g_limbPowers[bcdDigits - 1 - (position - bin * bcdDigits)];
+
+  // Room for the limbs, and two bins above them for the carries
+  if(bin - limbs + 1 < m_low || bin + 3 >= m_low + m_size)
+  {
+    Reserve(bin - limbs + 1,bin + 3);
+  }
+  int64* bins = m_bins + (bin - m_low);
+  if(p_negative)
+  {
+    for(int ind = 0; ind < limbs; ++ind)
+    {
+      int64 value = p_limbs[ind] * factor;
+      int64 high  = value / bcdBase;
+      bins[1 - ind] -= high;
+      bins[ -ind]   -= value - high * bcdBase;
+    }
+  }
+  else
+  {
+    for(int ind = 0; ind < limbs; ++ind)
+    {
+      int64 value = p_limbs[ind] * factor;
+      int64 high  = value / bcdBase;
+      bins[1 - ind] += high;
+      bins[ -ind]   += value - high * bcdBase;
+    }
+  }
+  if(++m_pending == accumulatorCarryInterval)
+  {
+    m_bins[m_size - 1] += Carry(m_bins,m_size) * bcdBase;
+    m_pending = 0;
+  }
+}
+
+// bcd::Accumulator::AddSpecial
+// Description: Add a NULL, INF or NaN, or any number after that
+// Technical:   The sum goes the way of the operators + and -, so it throws
+//              (and stays unchanged) or becomes NULL or (-)INF as they do.
+template<int Limbs>
+void
+basic_bcd<Limbs>::Accumulator::AddSpecial(const basic_bcd& p_number,bool p_negate)
+{
+  basic_bcd sum = m_special ? m_result : Result();
+  m_result  = p_negate ? sum.Sub(p_number) : sum.Add(p_number);
+  m_special = true;
+}
+
+// bcd::Accumulator::Reserve
+// Description: Make room for the limb positions p_low up to and including p_high
+template<int Limbs>
+void
+basic_bcd<Limbs>::Accumulator::Reserve(int p_low,int p_high)
+{
+  if(m_size && p_low >= m_low && p_high < m_low + m_size)
+  {
+    return;
+  }
+  int low  = (m_size == 0 || p_low < m_low) ? p_low - accumulatorSlack : m_low;
+  int high = (m_size == 0 || p_high >= m_low + m_size) ? p_high + accumulatorSlack : m_low + m_size - 1;
+
+  // Small registers stay in the accumulator itself
+  int    size  = high - low + 1;
+  int64  saved[localBins];
+  int64* bins  = (size <= localBins) ? m_local : new int64[size];
+  int64* moved = m_bins;
+  if(m_bins == m_local && bins == m_local)
+  {
+    memcpy(saved,m_local,m_size * sizeof(int64));
+    moved = saved;
+  }
+  memset(bins,0,size * sizeof(int64));
+  if(m_size)
+  {
+    memcpy(bins + (m_low - low),moved,m_size * sizeof(int64));
+  }
+  if(m_bins != m_local)
+  {
+    delete [] m_bins;
+  }
+  m_bins = bins;
+  m_low  = low;
+  m_size = high - low + 1;
+}
+
+// bcd::Accumulator::Carry
+// Description: Propagate the carries of the bins
+// Technical:   Afterwards every bin is in the range 0..bcdBase-1 (also for a negative sum)
+//              Returns the carry out of the last bin: negative for a negative sum.
+template<int Limbs>
+int64
+basic_bcd<Limbs>::Accumulator::Carry(int64* p_bins,int p_size)
+{
+  int64 carry = 0;
+  for(int ind = 0; ind < p_size; ++ind)
+  {
+    int64 value = p_bins[ind] + carry;
+    carry = value / bcdBase;
+    value -= carry * bcdBase;
+    if(value < 0)
+    {
+      value += bcdBase;
+      --carry;
+    }
+    p_bins[ind] = value;
+  }
+  return carry;
+}
+
+//////////////////////////////////////////////////////////////////////////
+//
+// END OF ACCUMULATOR OF BCD
+//
+//////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////
+//
+// REDUCTIONS OF BCD
+//
+//////////////////////////////////////////////////////////////////////////
+
+// bcd::Sum
+// Description: SUM of an array of numbers
+// Technical:   Every chunk adds its numbers to an exact accumulator. The partial
+//              sums are merged in the order of the chunks and rounded once, so the
+//              sum does not depend on the number of threads or the chunk sizes.
+//              The first -INF, INF or NaN in the array (if any) makes the sum (-)INF.
+template<int Limbs>
+basic_bcd<Limbs>
+basic_bcd<Limbs>::Sum(const basic_bcd* p_numbers,size_t p_count,unsigned p_threads /*=0*/)
+{
+  Accumulator partial [bcdBulkThreads];
+  size_t      specials[bcdBulkThreads];
+  for(size_t ind = 0; ind < bcdBulkThreads; ++ind)
+  {
+    specials[ind] = p_count;
+  }
+  BulkChunks(p_count,p_threads,[&](size_t p_chunk,size_t p_begin,size_t p_end)
+  {
+    Accumulator& sum = partial[p_chunk];
+    for(size_t ind = p_begin; ind < p_end; ++ind)
+    {
+      const basic_bcd& number = p_numbers[ind];
+      if(number.IsValid())
+      {
+        sum.Add(number);
+      }
+      else if(!number.IsNULL() && specials[p_chunk] == p_count)
+      {
+        specials[p_chunk] = ind;
+      }
+    }
+    return (size_t)0;
+  });
+
+  Accumulator total;
+  size_t      special = p_count;
+  for(size_t ind = 0; ind < bcdBulkThreads; ++ind)
+  {
+    total.Add(partial[ind]);
+    special = min(special,specials[ind]);
+  }
+  if(special < p_count)
+  {
+    basic_bcd sign;
+    sign.m_sign = (p_numbers[special].m_sign == Sign::MIN_INF) ? Sign::Negative : Sign::Positive;
+    return sign.SetInfinity(_T("BCD: Cannot sum INFINITY or NaN"));
+  }
+  if(total.GetCount() == 0)
+  {
+    return basic_bcd(Sign::ISNULL);
+  }
+  return total.Result();
+}
+
+// bcd::Average
+// Description: AVG of an array of numbers
+// Technical:   The (exact) sum divided once by the number of non-NULL numbers
+template<int Limbs>
+basic_bcd<Limbs>
+basic_bcd<Limbs>::Average(const basic_bcd* p_numbers,size_t p_count,unsigned p_threads /*=0*/)
+{
+  basic_bcd sum = Sum(p_numbers,p_count,p_threads);
+  if(!sum.IsValid())
+  {
+    return sum;
+  }
+  size_t count = 0;
+  for(size_t ind = 0; ind < p_count; ++ind)
+  {
+    count += p_numbers[ind].IsNULL() ? 0 : 1;
+  }
+  return sum.Div(basic_bcd((uint64)count));
+}
+
+// bcd::Minimum
+// Description: MIN of an array of numbers
+template<int Limbs>
+basic_bcd<Limbs>
+basic_bcd<Limbs>::Minimum(const basic_bcd* p_numbers,size_t p_count,unsigned p_threads /*=0*/)
+{
+  size_t index = ReduceExtreme(p_numbers,p_count,p_threads,-1);
+  return (index < p_count) ? p_numbers[index] : basic_bcd(Sign::ISNULL);
+}
+
+// bcd::Maximum
+// Description: MAX of an array of numbers
+template<int Limbs>
+basic_bcd<Limbs>
+basic_bcd<Limbs>::Maximum(const basic_bcd* p_numbers,size_t p_count,unsigned p_threads /*=0*/)
+{
+  size_t index = ReduceExtreme(p_numbers,p_count,p_threads,1);
+  return (index < p_count) ? p_numbers[index] : basic_bcd(Sign::ISNULL);
+}
+
+// bcd::ReduceExtreme
+// Description: Index of the first smallest or greatest number of an array (NULL's skipped)
+// Technical:   Every chunk finds its first extreme. The chunks are merged in their
+//              order and only a strictly better number wins, so the index is the
+//              same for any number of threads. Returns p_count for no numbers.
+template<int Limbs>
+size_t
+basic_bcd<Limbs>::ReduceExtreme(const basic_bcd* p_numbers,size_t p_count,unsigned p_threads,int p_order)
+{
+  size_t extremes[bcdBulkThreads];
+  for(size_t ind = 0; ind < bcdBulkThreads; ++ind)
+  {
+    extremes[ind] = p_count;
+  }
+  BulkChunks(p_count,p_threads,[&](size_t p_chunk,size_t p_begin,size_t p_end)
+  {
+    size_t extreme = p_count;
+    for(size_t ind = p_begin; ind < p_end; ++ind)
+    {
+      if(!p_numbers[ind].IsNULL() &&
+         (extreme == p_count || p_numbers[ind].Compare(p_numbers[extreme]) == p_order))
+      {
+        extreme = ind;
+      }
+    }
+    extremes[p_chunk] = extreme;
+    return (size_t)0;
+  });
+
+  size_t extreme = p_count;
+  for(size_t ind = 0; ind < bcdBulkThreads; ++ind)
+  {
+    size_t index = extremes[ind];
+    if(index < p_count && (extreme == p_count || p_numbers[index].Compare(p_numbers[extreme]) == p_order))
+    {
+      extreme = index;
+    }
+  }
+  return extreme;
+}
+
+//////////////////////////////////////////////////////////////////////////
+//
+// END OF REDUCTIONS OF BCD
+//
+//////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////
+//
+// FUSED OPERATIONS OF BCD
+//
+//////////////////////////////////////////////////////////////////////////
+
+// bcd::FusedMultiplyAdd
+// Description: (p_one * p_two) + p_three, rounded once
+// Technical:   The full product (2 * bcdLength limbs) and the addend go into an
+//              accumulator, so the product is not normalized and truncated before
+//              the addition. Only the result is rounded to the precision.
+template<int Limbs>
+basic_bcd<Limbs>
+basic_bcd<Limbs>::FusedMultiplyAdd(const basic_bcd& p_one,const basic_bcd& p_two,const basic_bcd& p_three)
+{
+  Accumulator sum;
+  sum.AddProduct(p_one,p_two);
+  sum.Add(p_three);
+  return sum.Result();
+}
+
+// bcd::DotProduct
+// Description: Sum of the products p_one[i] * p_two[i], rounded once
+// Technical:   All full products are added exactly in one accumulator
+template<int Limbs>
+basic_bcd<Limbs>
+basic_bcd<Limbs>::DotProduct(const basic_bcd* p_one,const basic_bcd* p_two,size_t p_count)
+{
+  Accumulator sum;
+  for(size_t ind = 0; ind < p_count; ++ind)
+  {
+    sum.AddProduct(p_one[ind],p_two[ind]);
+  }
+  return sum.Result();
+}
+
+//////////////////////////////////////////////////////////////////////////
+//
+// END OF FUSED OPERATIONS OF BCD
+//
+//////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////
+//
+// FILE STREAM FUNCTIONS
+// Used for binary storage in a binary-mode file stream!
+//
+//////////////////////////////////////////////////////////////////////////
+
+template<int Limbs>
+bool
+basic_bcd<Limbs>::WriteToFile (FILE* p_fp)
+{
+  // Write out the sign
+  if(putc((char)m_sign,p_fp)      == EOF) return false;
+  // Write out the exponent (little endian)
+  if(putc(m_exponent >> 8,  p_fp) == EOF) return false;
+  if(putc(m_exponent & 0xFF,p_fp) == EOF) return false;
+  // Write out the mantissa (little endian)
+  for(unsigned int ind = 0;ind < bcdLength; ++ind)
+  {
+    ulong num = (ulong) m_mantissa[ind];
+    if(putc((num & 0xFF000000) >> 24,p_fp) == EOF) return false;
+    if(putc((num & 0x00FF0000) >> 16,p_fp) == EOF) return false;
+    if(putc((num & 0x0000FF00) >>  8,p_fp) == EOF) return false;
+    if(putc((num & 0x000000FF)      ,p_fp) == EOF) return false;
+  }
+  return true;
+}
+
+template<int Limbs>
+bool
+basic_bcd<Limbs>::ReadFromFile(FILE* p_fp)
+{
+  int ch = 0;
+
+  // Read in the sign
+  m_sign = (Sign) getc(p_fp);
+  // Read in the exponent
+  ch = getc(p_fp);
+  m_exponent = (short) (ch << 8);
+  ch = getc(p_fp);
+  m_exponent += (short) ch;
+
+  // Read in the mantissa
+  for(unsigned int ind = 0; ind < bcdLength; ++ind)
+  {
+    ulong num = 0L;
+    ch = getc(p_fp); num += ((ulong)ch) << 24;
+    ch = getc(p_fp); num += ((ulong)ch) << 16;
+    ch = getc(p_fp); num += ((ulong)ch) <<  8;
+    ch = getc(p_fp); num +=  (ulong)ch;
+    m_mantissa[ind] = num;
+  }
+
+  // BCD is invalid in case of file error
+  if(ferror(p_fp))
+  {
+    Zero();
+    return false;
+  }
+  return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+//
+// END OF FILE STREAM FUNCTIONS
+//
+//////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////
+//
+// WIDTHS OF THE BCD
+// Any other width in use needs its own line here
+//
+//////////////////////////////////////////////////////////////////////////
+
+template class basic_bcd< 3>;   // bcd24
+template class basic_bcd< 5>;   // bcd
+template class basic_bcd<15>;   // bcd120
+template class basic_bcd<25>;   // bcd200
+
+//////////////////////////////////////////////////////////////////////////
+//
+// END OF BCD IMPLEMENTATION
+//
+//////////////////////////////////////////////////////////////////////////
@@ -1,513 +1,906 @@
-/////////////////////////////////////////////////////////////////////////////////
-//
-// SourceFile: bcd.h
-//
-// BaseLibrary: Indispensable general objects and functions
-//
-// Copyright (c) 2014-2025 ir. W.E. Huisman
-// All rights reserved
-//
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files(the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions :
-//
-// The above copyright notice and this permission notice shall be included in
-// all copies or substantial portions of the Software.
-//
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
-// THE SOFTWARE.
-//
-//////////////////////////////////////////////////////////////////////////
-//
-// BCD
-//
-// Floating Point Precision Number class (Binary Coded Decimal)
-// A number always has the format [sign][[digit]*][.[digit]*][E[sign][digits]+] where sign is either '+' or '-'
-// Numbers are stored in 1E8 based mantissa with a digital . implied at the second position
-// The mantissa array exists of a series of integers with 8 functional digits each
-//
-// Copyright (c) 2014-2022 ir W. E. Huisman
-// Version 1.5 of 03-01-2022
-//
-#pragma once
-#include <intsafe.h>    // Min/Max sizes of integer datatypes
-#include <sqltypes.h>   // Needed for conversions of SQL_NUMERIC_STRUCT
-
-#define XString CString
-
-// The ODBC standard has a maximum of 38 decimal places
-// At least one database (Oracle) implements these numbers
-#ifndef SQLNUM_MAX_PREC
-#define SQLNUM_MAX_PREC 38
-#endif
-
-// Constants that controls the actual precision:
-const int bcdBase      = 100000000L; // Base of the numbers in m_mantissa
-const int bcdDigits    = 8;          // Number of digits in one mantissa element
-const int bcdLength    = 5;          // Number of elements in the mantissa    
-const int bcdPrecision = bcdDigits * bcdLength;
-// When rethinking one of these four constants, 
-// be sure to edit the following points in the implementation class
-// - The constants:   PI, LN2, LN10
-// - The conversions: AsLong, AsInt64, AsNumeric
-// - The setters:     SetValueLong, SetValueInt64, SetValueNumeric
-// - Some generals:   DebugPrint ("%08d")
-
-// Handy typedefs of used basic datatypes
-using uchar  = unsigned char;
-using ushort = unsigned short;
-using ulong  = unsigned long;
-
-#ifndef int64
-using int64  = __int64;
-#endif
-
-#ifndef uint64
-using uint64 = unsigned __int64;
-#endif
-
-// Forward declaration of our class
-class bcd;
-
-// Overloaded standard mathematical functions
-bcd floor(const bcd& p_number);
-bcd ceil (const bcd& p_number);
-bcd fabs (const bcd& p_number);
-bcd sqrt (const bcd& p_number);
-bcd log10(const bcd& p_number);
-bcd log  (const bcd& p_number);
-bcd exp  (const bcd& p_number);
-bcd pow  (const bcd& p_number,const bcd& p_power);
-bcd frexp(const bcd& p_number,int* p_exponent);
-bcd ldexp(const bcd& p_number,int  p_power);
-bcd modf (const bcd& p_number,bcd* p_intpart);
-bcd fmod (const bcd& p_number,const bcd& p_divisor);
-
-// Overloaded standard trigonometric functions on a bcd number
-bcd sin  (const bcd& p_number);
-bcd cos  (const bcd& p_number);
-bcd tan  (const bcd& p_number);
-bcd asin (const bcd& p_number);
-bcd acos (const bcd& p_number);
-bcd atan (const bcd& p_number);
-bcd atan2(const bcd& p_y,const bcd& p_x);
-
-// One-time initialization for printing numbers in the current locale
-void InitValutaString();
-
-// string format number and money format functions
-extern bool  g_locale_valutaInit;
-extern TCHAR g_locale_decimalSep[];
-extern TCHAR g_locale_thousandSep[];
-extern TCHAR g_locale_strCurrency[];
-extern int   g_locale_decimalSepLen;
-extern int   g_locale_thousandSepLen;
-extern int   g_locale_strCurrencyLen;
-
-//////////////////////////////////////////////////////////////////////////
-//
-// The Binary Coded Decimal class
-//
-//////////////////////////////////////////////////////////////////////////
-
-class bcd
-{
-public:
-  // CONSTRUCTORS/DESTRUCTORS
-
-  // Default constructor.
-  bcd();
-
-  // Copy constructor.
-  bcd(const bcd& icd);
-
-  // BCD from a char value
-  explicit bcd(const TCHAR p_value);
-
-#ifndef UNICODE
-  // BCD from an unsigned char value
-  explicit bcd(const _TUCHAR p_value);
-#endif
-  // BCD from a short value
-  explicit bcd(const short p_value);
-
-  // BCD from an unsigned short value
-  explicit bcd(const unsigned short p_value);
-
-  // BCD from an integer
-  explicit bcd(const int p_value);
-
-  // BCD from an unsigned integer
-  explicit bcd(const unsigned int p_value);
-
-  // BCD from a long
-  explicit bcd(const long p_value, const long p_restValue = 0);
-
-  // BCD from an unsigned long
-  explicit bcd(const unsigned long p_value, const unsigned long p_restValue = 0);
-
-  // BCD from a 64bits int
-  explicit bcd(const int64 p_value,const int64 p_restvalue = 0);
-
-  // BCD from an unsigned 64bits int
-  explicit bcd(const uint64 p_value,const int64 p_restvalue = 0);
-
-  // BCD from a float
-  explicit bcd(const float p_value);
-
-  // BCD from a double
-  explicit bcd(const double p_value);
-
-  // BCD From a character string
-  explicit bcd(PCTSTR p_string,bool p_fromDB = false);
-
-  // BCD from a SQL_NUMERIC_STRUCT
-  explicit bcd(const SQL_NUMERIC_STRUCT* p_numeric);
-
-  // ENUMERATIONS
-
-  // Keep sign status in this order!
-  enum class Sign
-  {
-     Positive  // bcd number >= 0
-    ,Negative  // bcd number  < 0
-    ,ISNULL    // bcd number is NULL in the database
-    ,MIN_INF   // bcd number in negative infinity
-    ,INF       // bcd number in positive infinity
-    ,NaN       // Not a Number (e.g. a string)
-  };
-  // Formatting of a string (As<X>String())
-  enum class Format
-  {
-     Engineering
-    ,Bookkeeping
-  };
-  // For internal processing
-  enum class Operator
-  {
-     Addition
-    ,Subtraction
-  };
-
-  // BCD constructs as a NULL from the database
-  explicit bcd(const bcd::Sign p_sign);
-
-  // CONSTANTS
-
-  static bcd PI();          // Circumference/Radius ratio of a circle
-  static bcd LN2();         // Natural logarithm of 2
-  static bcd LN10();        // Natural logarithm of 10
-
-  static bcd MIN_BCD();     // Maximum number a bcd can hold
-  static bcd MAX_BCD();     // Minimum number a bcd can hold
-  static bcd MIN_EPSILON(); // Smallest number a bcd can hold
-
-  // ERROR HANDLING
-
-  // BCD throws on error or sets status (-INF, INF, NAN)
-  // BEWARE: Not thread safe to change in flight
-  // Applications must use ONE (1) setting at startup
-  static void ErrorThrows(bool p_throws = true);
-
-  // OPERATORS
-
-  // Standard mathematical operators
-  const bcd  operator+(const bcd&   p_value) const;
-  const bcd  operator-(const bcd&   p_value) const;
-  const bcd  operator*(const bcd&   p_value) const;
-  const bcd  operator/(const bcd&   p_value) const;
-  const bcd  operator%(const bcd&   p_value) const;
-
-  const bcd  operator+(const int    p_value) const;
-  const bcd  operator-(const int    p_value) const;
-  const bcd  operator*(const int    p_value) const;
-  const bcd  operator/(const int    p_value) const;
-  const bcd  operator%(const int    p_value) const;
-
-  const bcd  operator+(const double p_value) const;
-  const bcd  operator-(const double p_value) const;
-  const bcd  operator*(const double p_value) const;
-  const bcd  operator/(const double p_value) const;
-  const bcd  operator%(const double p_value) const;
-
-  const bcd  operator+(LPCTSTR p_value) const;
-  const bcd  operator-(LPCTSTR p_value) const;
-  const bcd  operator*(LPCTSTR p_value) const;
-  const bcd  operator/(LPCTSTR p_value) const;
-  const bcd  operator%(LPCTSTR p_value) const;
-
-  // Standard math/assignment operators
-  bcd& operator+=(const bcd& p_value);
-  bcd& operator-=(const bcd& p_value);
-  bcd& operator*=(const bcd& p_value);
-  bcd& operator/=(const bcd& p_value);
-  bcd& operator%=(const bcd& p_value);
-
-  bcd& operator+=(const int p_value);
-  bcd& operator-=(const int p_value);
-  bcd& operator*=(const int p_value);
-  bcd& operator/=(const int p_value);
-  bcd& operator%=(const int p_value);
-
-  bcd& operator+=(const double p_value);
-  bcd& operator-=(const double p_value);
-  bcd& operator*=(const double p_value);
-  bcd& operator/=(const double p_value);
-  bcd& operator%=(const double p_value);
-
-  bcd& operator+=(LPCTSTR p_value);
-  bcd& operator-=(LPCTSTR p_value);
-  bcd& operator*=(LPCTSTR p_value);
-  bcd& operator/=(LPCTSTR p_value);
-  bcd& operator%=(LPCTSTR p_value);
-
-  // Prefix unary minus (negation)
-  bcd  operator-() const;
-
-  // Prefix/Postfix increment/decrement operators
-  bcd  operator++(int);  // Postfix increment
-  bcd& operator++();     // Prefix  increment
-  bcd  operator--(int);  // Postfix decrement
-  bcd& operator--();     // Prefix  decrement
-
-  // Assignment operators
-  bcd& operator=(const bcd&    p_value);
-  bcd& operator=(const int     p_value);
-  bcd& operator=(const double  p_value);
-  bcd& operator=(const PCTSTR  p_value);
-  bcd& operator=(const __int64 p_value);
-
-  // comparison operators
-  bool operator==(const bcd&   p_value) const;
-  bool operator!=(const bcd&   p_value) const;
-  bool operator< (const bcd&   p_value) const;
-  bool operator> (const bcd&   p_value) const;
-  bool operator<=(const bcd&   p_value) const;
-  bool operator>=(const bcd&   p_value) const;
-
-  bool operator==(const int    p_value) const;
-  bool operator!=(const int    p_value) const;
-  bool operator< (const int    p_value) const;
-  bool operator> (const int    p_value) const;
-  bool operator<=(const int    p_value) const;
-  bool operator>=(const int    p_value) const;
-
-  bool operator==(const double p_value) const;
-  bool operator!=(const double p_value) const;
-  bool operator< (const double p_value) const;
-  bool operator> (const double p_value) const;
-  bool operator<=(const double p_value) const;
-  bool operator>=(const double p_value) const;
-
-  bool operator==(LPCTSTR p_value) const;
-  bool operator!=(LPCTSTR p_value) const;
-  bool operator< (LPCTSTR p_value) const;
-  bool operator> (LPCTSTR p_value) const;
-  bool operator<=(LPCTSTR p_value) const;
-  bool operator>=(LPCTSTR p_value) const;
-
-  // MAKING AN EXACT NUMERIC value
-  
-  // Set the mantissa/exponent/sign to the number zero (0)
-  void    Zero();
-  // Set to database NULL
-  void    SetNULL();
-  // Round to a specified fraction (decimals behind the .)
-  void    Round(int p_precision = 0);
-  // Truncate to a specified fraction (decimals behind the .)
-  void    Truncate(int p_precision = 0);  
-  // Change length and precision
-  void    SetLengthAndPrecision(int p_precision = bcdPrecision,int p_scale = (bcdPrecision / 2));
-  // Change the sign
-  void    Negate();
-  
-  // MATHEMATICAL FUNCTIONS
-
-  // Value before the decimal point
-  bcd     Floor() const;
-  // Value behind the decimal point
-  bcd     Fraction() const;
-  // Value after the decimal point
-  bcd     Ceiling() const;
-  // Square root of the bcd
-  bcd     SquareRoot() const;
-  // This bcd to the power x
-  bcd     Power(const bcd& p_power) const;
-  // Absolute value (ABS)
-  bcd     AbsoluteValue() const;
-  // Reciproke / Inverse = 1/x
-  bcd     Reciprocal() const;
-  // Natural logarithm
-  bcd     Log() const;
-  // Exponent e tot the power 'this number'
-  bcd     Exp() const;
-  // Log with base 10
-  bcd     Log10() const;
-  // Ten Power
-  bcd     TenPower(int n);
-
-  // TRIGONOMETRIC FUNCTIONS
-
-  // Sinus of the angle
-  bcd     Sine() const;
-  // Cosine of the angle
-  bcd     Cosine() const;
-  // Tangent of the angle
-  bcd     Tangent() const;
-  // Arc sines (angle) of the ratio
-  bcd     ArcSine() const;
-  // Arc cosine (angle) of the ratio
-  bcd     ArcCosine() const;
-  // Arctangent (angle) of the ratio
-  bcd     ArcTangent() const;
-  // Angle of two points (x,y)
-  bcd     ArcTangent2Points(const bcd& p_x) const;
-
-  // GET AS SOMETHING DIFFERENT
-
-  // Get as a double
-  double  AsDouble() const;
-  // Get as a short
-  short   AsShort() const;
-  // Get as an unsigned short
-  ushort  AsUShort() const;
-  // Get as a long
-  long    AsLong() const;
-  // Get as an unsigned long
-  ulong   AsULong() const;
-  // Get as a 64bits long
-  int64   AsInt64() const;
-  // Get as an unsigned 64 bits long
-  uint64  AsUInt64() const;
-  // Get as a mathematical string
-  XString AsString(bcd::Format p_format = Format::Bookkeeping,bool p_printPositive = false,int p_decimals = 2) const;
-  // Get as a display string (by desktop locale)
-  XString AsDisplayString(int p_decimals = 2) const;
-  // Get as an ODBC SQL NUMERIC(p,s)
-  void    AsNumeric(SQL_NUMERIC_STRUCT* p_numeric) const;
-
-  // GETTER FUNCTIES
-
-  // Is bcd exactly 0.0? (used to be called IsNull)
-  bool    IsZero() const; 
-  // Is bcd a database NULL
-  bool    IsNULL() const;
-  // Not an (-)INF or a NAN
-  bool    IsValid() const;
-  // Is bcd nearly 0.0 (smaller than epsilon)
-  bool    IsNearZero();
-  // Gets the sign 0 (= 0.0), 1 (greater than 0) of -1 (smaller than 0)
-  int     GetSign() const;
-  // Gets Signed status Positive, Negative, -INF, INF, NaN
-  Sign    GetStatus() const;
-  // Total length (before and after decimal point)
-  int     GetLength() const;
-  // Total precision (length after the decimal point)
-  int     GetPrecision() const;
-  // Get the max size of a bcd
-  static int GetMaxSize(int p_precision = 0);
-  // Gets the fact that it fits in a long
-  bool    GetFitsInLong() const;
-  // Gets the fact that it fits in an int64
-  bool    GetFitsInInt64() const;
-  // Decimal part (behind the decimal point) is not "000" (zeros)
-  bool    GetHasDecimals() const;
-  // Gets the exponent
-  int     GetExponent() const;
-  // Gets the mantissa
-  bcd     GetMantissa() const;
-
-  // FILE STREAM FUNCTIONS
-  bool    WriteToFile (FILE* p_fp);
-  bool    ReadFromFile(FILE* p_fp);
-
-#ifdef _DEBUG
-  // Debug print of the mantissa
-  XString DebugPrint(PTCHAR p_name);
-#endif
-
-private:
-
-  // INTERNALS
-
-  // Set infinity for overflows
-  bcd     SetInfinity(XString p_reason = _T("")) const;
-  // Sets one integer in this bcd number
-  void    SetValueInt(const int p_value);
-  // Sets one or two longs in this bcd number
-  void    SetValueLong(const long p_value, const long p_restValue);
-  // Sets one or two longs in this bcd number
-  void    SetValueInt64 (const  int64 p_value,const int64 p_restValue);
-  void    SetValueUInt64(const uint64 p_value,const int64 p_restValue);
-  // Sets the value from a double
-  void    SetValueDouble(const double p_value);
-  // Sets the value from a string
-  void    SetValueString(LPCTSTR p_string,bool p_fromDB = false);
-  // Sets the value from a SQL NUMERIC
-  void    SetValueNumeric(const SQL_NUMERIC_STRUCT* p_numeric);
-  // Take the absolute value of a long
-  long    long_abs(const long p_value) const;
-  // Normalize the mantissa/exponent
-  void    Normalize(int p_startExponent = 0);
-  // Multiply the mantissa by 10
-  void    Mult10(int p_times = 1);
-  // Divide the mantissa by 10
-  void    Div10(int p_times = 1);
-  // Shift mantissa 1 position right
-  void    ShiftRight();
-  // Shift mantissa 1 position left
-  void    ShiftLeft();
-  // Convert a string to a single long value
-  long    StringToLong(LPCTSTR p_string) const;
-  // Convert a long to a string
-  XString LongToString(long p_value) const;
-  // Split the mantissa for floor/ceiling operations
-  bcd     SplitMantissa() const;
-  // Compare two mantissa
-  int     CompareMantissa(const bcd& p_value) const;
-  // Calculate the precision and scale for a SQL_NUMERIC
-  void    CalculatePrecisionAndScale(SQLCHAR& p_precision,SQLCHAR& p_scale) const;
-  // Stopping criterion for internal iterations
-  bcd&    Epsilon(long p_fraction) const;
-
-  // BASIC OPERATIONS
-
-  // Addition operation
-  bcd Add(const bcd& p_number) const;
-  // Subtraction operation
-  bcd Sub(const bcd& p_number) const;
-  // Multiplication
-  bcd Mul(const bcd& p_number) const;
-  // Division
-  bcd Div(const bcd& p_number) const;
-  // Modulo
-  bcd Mod(const bcd& p_number) const;
-
-  // Helpers for the basic operations
-
-  // Position arguments and signs for the next operation
-  void PositionArguments(bcd& arg1,bcd& arg2,Sign& signResult,Operator& operatorKind) const;
-  // Calculate the sign for multiplication or division
-  Sign CalculateSign(const bcd& p_arg1, const bcd& p_arg2) const;
-  // Addition of two mantissa (no signs/exponents)
-  bcd  PositiveAddition(bcd& arg1,bcd& arg2) const;
-  // Subtraction of two mantissa (no signs/exponents)
-  bcd  PositiveSubtraction(bcd& arg1,bcd& arg2) const;
-  // Multiplication of two mantissa (no signs)
-  bcd  PositiveMultiplication(const bcd& p_arg1,const bcd& p_arg2) const;
-  // Division of two mantissa (no signs)
-  bcd  PositiveDivision(bcd& p_arg1,bcd& p_arg2) const;
-
-  // STORAGE OF THE NUMBER
-  Sign          m_sign;                // 0 = Positive, 1 = Negative (INF, NaN)
-  short         m_exponent;            // +/- 10E32767
-  long          m_mantissa[bcdLength]; // Up to (bcdDigits * bcdLength) digits
-};
+/////////////////////////////////////////////////////////////////////////////////
+//
+// SourceFile: bcd.h
+//
+// BaseLibrary: Indispensable general objects and functions
+//
+// Copyright (c) 2014-2025 ir. W.E. Huisman
+// All rights reserved
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////
+//
+// BCD
+//
+// Floating Point Precision Number class (Binary Coded Decimal)
+// A number always has the format [sign][[digit]*][.[digit]*][E[sign][digits]+] where sign is either '+' or '-'
+// Numbers are stored in 1E8 based mantissa with a digital . implied at the second position
+// The mantissa array exists of a series of integers with 8 functional digits each
+// The number of mantissa elements (Limbs) is the template parameter of basic_bcd,
+// so several precisions (bcd24, bcd, bcd120, bcd200) can live in one program.
+//
+// Copyright (c) 2014-2022 ir W. E. Huisman
+// Version 1.5 of 03-01-2022
+//
+#pragma once
+#include <intsafe.h>    // Min/Max sizes of integer datatypes
+#include <sqltypes.h>   // Needed for conversions of SQL_NUMERIC_STRUCT
+
+#define XString CString
+
+// The ODBC standard has a maximum of 38 decimal places
+// At least one database (Oracle) implements these numbers
+#ifndef SQLNUM_MAX_PREC
+#define SQLNUM_MAX_PREC 38
+#endif
+
+// Constants that controls the actual precision:
+const int bcdBase      = 100000000L; // Base of the numbers in m_mantissa
+const int bcdDigits    = 8;          // Number of digits in one mantissa element
+const int bcdMaxLength = 64;         // Maximum number of elements (512 digits)
+// The number of elements in the mantissa is the template parameter of basic_bcd
+// bcdLength and bcdPrecision are the class constants of each width.
+// The constants PI, LN2 and LN10 (and their tails) are taken from tables of 2 * bcdMaxLength elements.
+
+// Handy typedefs of used basic datatypes
+using uchar  = unsigned char;
+using ushort = unsigned short;
+using ulong  = unsigned long;
+
+#ifndef int64
+using int64  = __int64;
+#endif
+
+#ifndef uint64
+using uint64 = unsigned __int64;
+#endif
+
+// Forward declaration of our class
+template<int Limbs>
+class basic_bcd;
+
+// The column store of the bcd numbers (bcd_column.h)
+template<int Limbs>
+class basic_bcd_column;
+
+// The widths of the bcd in use
+using bcd24  = basic_bcd< 3>;   //  24 digits
+using bcd    = basic_bcd< 5>;   //  40 digits
+using bcd120 = basic_bcd<15>;   // 120 digits
+using bcd200 = basic_bcd<25>;   // 200 digits
+
+// Theoretical maximum of numerical separators
+const int bcdSeparatorLength = 10;
+
+//////////////////////////////////////////////////////////////////////////
+//
+// The numeric context of the bcd classes
+// Every thread has its own context, so calculations and the printing
+// of numbers can run concurrently on all threads without data races.
+// A thread can take over the settings of another context by assigning
+// it to bcd_context::Current().
+//
+//////////////////////////////////////////////////////////////////////////
+
+class bcd_context
+{
+public:
+  bcd_context();
+
+  // The context of the current thread
+  static bcd_context& Current();
+
+  // Sticky status flags (IEEE 754 style)
+  // Raised by the calculations until cleared, also when throwing
+  enum Status : unsigned
+  {
+    StatusNone         = 0x00
+   ,StatusInvalid      = 0x01  // Operation on NULL/INF/NaN or outside its domain
+   ,StatusDivideByZero = 0x02  // Division by zero or a pole of a function
+   ,StatusOverflow     = 0x04  // Result does not fit the exponent or the target type
+   ,StatusInexact      = 0x08  // Result was rounded or truncated
+  };
+
+  // Re-read the separators of the current locale
+  void  InitLocale();
+  // Raise, test and clear the sticky status flags
+  void  RaiseStatus(unsigned p_status) { m_status |= p_status; }
+  bool  TestStatus (unsigned p_status) const { return (m_status & p_status) != 0; }
+  void  ClearStatus() { m_status = StatusNone; }
+
+  // Error handling throws or we silently return -INF, INF, NaN
+  // When not throwing, errors never allocate and only raise the status
+  bool  m_throwing { true };
+  // Sticky status flags since the last ClearStatus
+  unsigned m_status { StatusNone };
+
+  // string format number and money format separators
+  TCHAR m_decimalSep [bcdSeparatorLength + 1];
+  TCHAR m_thousandSep[bcdSeparatorLength + 1];
+  TCHAR m_strCurrency[bcdSeparatorLength + 1];
+  int   m_decimalSepLen  { 0 };
+  int   m_thousandSepLen { 0 };
+  int   m_strCurrencyLen { 0 };
+};
+
+// Re-read the locale for printing numbers on the current thread
+void InitValutaString();
+
+// Result of basic_bcd::FromChars (as std::from_chars_result)
+struct bcd_chars_result
+{
+  const char* ptr;      // First character that is not part of the number
+  unsigned    status;   // bcd_context::Status flags of the conversion
+};
+
+//////////////////////////////////////////////////////////////////////////
+//
+// The Binary Coded Decimal class
+// Implemented in bcd.cpp for the widths of the above 'using' list
+//
+//////////////////////////////////////////////////////////////////////////
+
+template<int Limbs>
+class basic_bcd
+{
+  static_assert(Limbs >= 3 && Limbs <= bcdMaxLength,"BCD: Mantissa must hold an int64 and fit the constant tables");
+
+public:
+  // Number of elements in the mantissa and the resulting precision
+  static const int bcdLength    = Limbs;
+  static const int bcdPrecision = bcdDigits * Limbs;
+
+  // CONSTRUCTORS/DESTRUCTORS
+
+  // Default constructor.
+  basic_bcd();
+
+  // Copy constructor.
+  basic_bcd(const basic_bcd& icd);
+
+  // BCD from a char value
+  explicit basic_bcd(const TCHAR p_value);
+
+#ifndef UNICODE
+  // BCD from an unsigned char value
+  explicit basic_bcd(const _TUCHAR p_value);
+#endif
+  // BCD from a short value
+  explicit basic_bcd(const short p_value);
+
+  // BCD from an unsigned short value
+  explicit basic_bcd(const unsigned short p_value);
+
+  // BCD from an integer
+  explicit basic_bcd(const int p_value);
+
+  // BCD from an unsigned integer
+  explicit basic_bcd(const unsigned int p_value);
+
+  // BCD from a long
+  explicit basic_bcd(const long p_value, const long p_restValue = 0);
+
+  // BCD from an unsigned long
+  explicit basic_bcd(const unsigned long p_value, const unsigned long p_restValue = 0);
+
+  // BCD from a 64bits int
+  explicit basic_bcd(const int64 p_value,const int64 p_restvalue = 0);
+
+  // BCD from an unsigned 64bits int
+  explicit basic_bcd(const uint64 p_value,const int64 p_restvalue = 0);
+
+  // BCD from a float
+  explicit basic_bcd(const float p_value);
+
+  // BCD from a double
+  explicit basic_bcd(const double p_value);
+
+  // BCD From a character string
+  explicit basic_bcd(PCTSTR p_string,bool p_fromDB = false);
+
+  // BCD from a SQL_NUMERIC_STRUCT
+  explicit basic_bcd(const SQL_NUMERIC_STRUCT* p_numeric);
+
+  // BCD from a bcd of another width
+  template<int Other>
+  explicit basic_bcd(const basic_bcd<Other>& p_other);
+
+  // ENUMERATIONS
+
+  // Keep sign status in this order!
+  enum class Sign
+  {
+     Positive  // bcd number >= 0
+    ,Negative  // bcd number  < 0
+    ,ISNULL    // bcd number is NULL in the database
+    ,MIN_INF   // bcd number in negative infinity
+    ,INF       // bcd number in positive infinity
+    ,NaN       // Not a Number (e.g. a string)
+  };
+  // Formatting of a string (As<X>String())
+  enum class Format
+  {
+     Engineering
+    ,Bookkeeping
+  };
+  // For internal processing
+  enum class Operator
+  {
+     Addition
+    ,Subtraction
+  };
+
+  // BCD constructs as a NULL from the database
+  explicit basic_bcd(const basic_bcd::Sign p_sign);
+
+  // CONSTANTS
+
+  static basic_bcd PI();          // Circumference/Radius ratio of a circle
+  static basic_bcd LN2();         // Natural logarithm of 2
+  static basic_bcd LN10();        // Natural logarithm of 10
+
+  static basic_bcd MIN_BCD();     // Maximum number a bcd can hold
+  static basic_bcd MAX_BCD();     // Minimum number a bcd can hold
+  static basic_bcd MIN_EPSILON(); // Smallest number a bcd can hold
+
+  // ERROR HANDLING
+
+  // BCD throws on error or sets status (-INF, INF, NAN)
+  // The setting is part of the bcd_context of the current thread
+  static void ErrorThrows(bool p_throws = true);
+
+  // OPERATORS
+
+  // Standard mathematical operators
+  const basic_bcd  operator+(const basic_bcd& p_value) const;
+  const basic_bcd  operator-(const basic_bcd& p_value) const;
+  const basic_bcd  operator*(const basic_bcd& p_value) const;
+  const basic_bcd  operator/(const basic_bcd& p_value) const;
+  const basic_bcd  operator%(const basic_bcd& p_value) const;
+
+  const basic_bcd  operator+(const int    p_value) const;
+  const basic_bcd  operator-(const int    p_value) const;
+  const basic_bcd  operator*(const int    p_value) const;
+  const basic_bcd  operator/(const int    p_value) const;
+  const basic_bcd  operator%(const int    p_value) const;
+
+  const basic_bcd  operator+(const double p_value) const;
+  const basic_bcd  operator-(const double p_value) const;
+  const basic_bcd  operator*(const double p_value) const;
+  const basic_bcd  operator/(const double p_value) const;
+  const basic_bcd  operator%(const double p_value) const;
+
+  const basic_bcd  operator+(LPCTSTR p_value) const;
+  const basic_bcd  operator-(LPCTSTR p_value) const;
+  const basic_bcd  operator*(LPCTSTR p_value) const;
+  const basic_bcd  operator/(LPCTSTR p_value) const;
+  const basic_bcd  operator%(LPCTSTR p_value) const;
+
+  // Standard math/assignment operators
+  basic_bcd& operator+=(const basic_bcd& p_value);
+  basic_bcd& operator-=(const basic_bcd& p_value);
+  basic_bcd& operator*=(const basic_bcd& p_value);
+  basic_bcd& operator/=(const basic_bcd& p_value);
+  basic_bcd& operator%=(const basic_bcd& p_value);
+
+  basic_bcd& operator+=(const int p_value);
+  basic_bcd& operator-=(const int p_value);
+  basic_bcd& operator*=(const int p_value);
+  basic_bcd& operator/=(const int p_value);
+  basic_bcd& operator%=(const int p_value);
+
+  basic_bcd& operator+=(const double p_value);
+  basic_bcd& operator-=(const double p_value);
+  basic_bcd& operator*=(const double p_value);
+  basic_bcd& operator/=(const double p_value);
+  basic_bcd& operator%=(const double p_value);
+
+  basic_bcd& operator+=(LPCTSTR p_value);
+  basic_bcd& operator-=(LPCTSTR p_value);
+  basic_bcd& operator*=(LPCTSTR p_value);
+  basic_bcd& operator/=(LPCTSTR p_value);
+  basic_bcd& operator%=(LPCTSTR p_value);
+
+  // Prefix unary minus (negation)
+  basic_bcd  operator-() const;
+
+  // Prefix/Postfix increment/decrement operators
+  basic_bcd  operator++(int);  // Postfix increment
+  basic_bcd& operator++();     // Prefix  increment
+  basic_bcd  operator--(int);  // Postfix decrement
+  basic_bcd& operator--();     // Prefix  decrement
+
+  // Assignment operators
+  basic_bcd& operator=(const basic_bcd& p_value);
+  basic_bcd& operator=(const int     p_value);
+  basic_bcd& operator=(const double  p_value);
+  basic_bcd& operator=(const PCTSTR  p_value);
+  basic_bcd& operator=(const __int64 p_value);
+
+  // comparison operators
+  bool operator==(const basic_bcd& p_value) const;
+  bool operator!=(const basic_bcd& p_value) const;
+  bool operator< (const basic_bcd& p_value) const;
+  bool operator> (const basic_bcd& p_value) const;
+  bool operator<=(const basic_bcd& p_value) const;
+  bool operator>=(const basic_bcd& p_value) const;
+
+  bool operator==(const int    p_value) const;
+  bool operator!=(const int    p_value) const;
+  bool operator< (const int    p_value) const;
+  bool operator> (const int    p_value) const;
+  bool operator<=(const int    p_value) const;
+  bool operator>=(const int    p_value) const;
+
+  bool operator==(const int64  p_value) const;
+  bool operator!=(const int64  p_value) const;
+  bool operator< (const int64  p_value) const;
+  bool operator> (const int64  p_value) const;
+  bool operator<=(const int64  p_value) const;
+  bool operator>=(const int64  p_value) const;
+
+  bool operator==(const double p_value) const;
+  bool operator!=(const double p_value) const;
+  bool operator< (const double p_value) const;
+  bool operator> (const double p_value) const;
+  bool operator<=(const double p_value) const;
+  bool operator>=(const double p_value) const;
+
+  bool operator==(LPCTSTR p_value) const;
+  bool operator!=(LPCTSTR p_value) const;
+  bool operator< (LPCTSTR p_value) const;
+  bool operator> (LPCTSTR p_value) const;
+  bool operator<=(LPCTSTR p_value) const;
+  bool operator>=(LPCTSTR p_value) const;
+
+  // Three way comparison: -1 (smaller), 0 (equal) or 1 (greater)
+  // All numbers are in order: NULL < -INF < negative < zero < positive < INF < NaN
+  int  Compare(const basic_bcd& p_value) const;
+
+  // MAKING AN EXACT NUMERIC value
+  
+  // Set the mantissa/exponent/sign to the number zero (0)
+  void       Zero();
+  // Set to database NULL
+  void       SetNULL();
+  // Round to a specified fraction (decimals behind the .)
+  void       Round(int p_precision = 0);
+  // Truncate to a specified fraction (decimals behind the .)
+  void       Truncate(int p_precision = 0);  
+  // Change length and precision
+  void       SetLengthAndPrecision(int p_precision = bcdPrecision,int p_scale = (bcdPrecision / 2));
+  // Change the sign
+  void       Negate();
+  
+  // MATHEMATICAL FUNCTIONS
+
+  // Value before the decimal point
+  basic_bcd  Floor() const;
+  // Value behind the decimal point
+  basic_bcd  Fraction() const;
+  // Truncated quotient and exact remainder of a division in one pass
+  void       DivMod(const basic_bcd& p_divisor,basic_bcd& p_quotient,basic_bcd& p_remainder) const;
+  // Value after the decimal point
+  basic_bcd  Ceiling() const;
+  // Square root of the bcd
+  basic_bcd  SquareRoot() const;
+  // This bcd to the power x
+  basic_bcd  Power(const basic_bcd& p_power) const;
+  // Absolute value (ABS)
+  basic_bcd  AbsoluteValue() const;
+  // Reciproke / Inverse = 1/x
+  basic_bcd  Reciprocal() const;
+  // Natural logarithm
+  basic_bcd  Log() const;
+  // Exponent e tot the power 'this number'
+  basic_bcd  Exp() const;
+  // Log with base 10
+  basic_bcd  Log10() const;
+  // Ten Power
+  basic_bcd  TenPower(int n);
+
+  // TRIGONOMETRIC FUNCTIONS
+
+  // Sinus of the angle
+  basic_bcd  Sine() const;
+  // Cosine of the angle
+  basic_bcd  Cosine() const;
+  // Tangent of the angle
+  basic_bcd  Tangent() const;
+  // Sine and cosine of the same angle, with one reduction of the angle
+  void       SinCos(basic_bcd& p_sine,basic_bcd& p_cosine) const;
+  // Arc sines (angle) of the ratio
+  basic_bcd  ArcSine() const;
+  // Arc cosine (angle) of the ratio
+  basic_bcd  ArcCosine() const;
+  // Arctangent (angle) of the ratio
+  basic_bcd  ArcTangent() const;
+  // Angle of two points (x,y)
+  basic_bcd  ArcTangent2Points(const basic_bcd& p_x) const;
+
+  // GET AS SOMETHING DIFFERENT
+
+  // Get as a double
+  double     AsDouble() const;
+  // Get as a short
+  short      AsShort() const;
+  // Get as an unsigned short
+  ushort     AsUShort() const;
+  // Get as a long
+  long       AsLong() const;
+  // Get as an unsigned long
+  ulong      AsULong() const;
+  // Get as a 64bits long
+  int64      AsInt64() const;
+  // Get as an unsigned 64 bits long
+  uint64     AsUInt64() const;
+  // Get as a mathematical string
+  XString    AsString(basic_bcd::Format p_format = Format::Bookkeeping,bool p_printPositive = false,int p_decimals = 2) const;
+  // Get as a display string (by desktop locale)
+  XString    AsDisplayString(int p_decimals = 2) const;
+  // Write as a mathematical string into a buffer, without allocating
+  char*      ToChars(char* p_first,char* p_last,basic_bcd::Format p_format = Format::Bookkeeping,int p_decimals = 2) const;
+  // Set from a mathematical string in a buffer (as std::from_chars)
+  bcd_chars_result FromChars(const char* p_first,const char* p_last);
+  // Get as an ODBC SQL NUMERIC(p,s)
+  void       AsNumeric(SQL_NUMERIC_STRUCT* p_numeric) const;
+  // Get an array as ODBC SQL NUMERICs, optionally all as NUMERIC(p,s)
+  static size_t AsNumericArray(const basic_bcd* p_numbers,SQL_NUMERIC_STRUCT* p_numerics,size_t p_count,SQLCHAR p_precision = 0,SQLSCHAR p_scale = 0);
+  // Set an array from ODBC SQL NUMERICs
+  static void   FromNumericArray(const SQL_NUMERIC_STRUCT* p_numerics,basic_bcd* p_numbers,size_t p_count);
+
+  // GETTER FUNCTIES
+
+  // Is bcd exactly 0.0? (used to be called IsNull)
+  bool       IsZero() const; 
+  // Is bcd a database NULL
+  bool       IsNULL() const;
+  // Not an (-)INF or a NAN
+  bool       IsValid() const;
+  // Is bcd nearly 0.0 (smaller than epsilon)
+  bool       IsNearZero();
+  // Gets the sign 0 (= 0.0), 1 (greater than 0) of -1 (smaller than 0)
+  int        GetSign() const;
+  // Gets Signed status Positive, Negative, -INF, INF, NaN
+  Sign       GetStatus() const;
+  // Total length (before and after decimal point)
+  int        GetLength() const;
+  // Total precision (length after the decimal point)
+  int        GetPrecision() const;
+  // Get the max size of a bcd
+  static int GetMaxSize(int p_precision = 0);
+  // Gets the fact that it fits in a long
+  bool       GetFitsInLong() const;
+  // Gets the fact that it fits in an int64
+  bool       GetFitsInInt64() const;
+  // Decimal part (behind the decimal point) is not "000" (zeros)
+  bool       GetHasDecimals() const;
+  // Gets the exponent
+  int        GetExponent() const;
+  // Gets the mantissa
+  basic_bcd  GetMantissa() const;
+
+  // COLUMN OPERATIONS
+  // On arrays of p_count numbers. The result may be one of the arguments (in place).
+  // With p_clean the caller guarantees that there are no NULL, INF or NaN numbers.
+
+  static void Add  (const basic_bcd* p_one,const basic_bcd* p_two,basic_bcd* p_result,size_t p_count,bool p_clean = false);
+  static void Sub  (const basic_bcd* p_one,const basic_bcd* p_two,basic_bcd* p_result,size_t p_count,bool p_clean = false);
+  static void Mul  (const basic_bcd* p_one,const basic_bcd* p_two,basic_bcd* p_result,size_t p_count,bool p_clean = false);
+  static void Scale(const basic_bcd* p_numbers,const basic_bcd& p_factor,basic_bcd* p_result,size_t p_count,bool p_clean = false);
+
+  // ACCUMULATION
+  // Exact sum of many numbers, rounded once when the result is read
+  class Accumulator;
+
+  // REDUCTIONS
+  // Of an array of p_count numbers, in chunks on p_threads threads (0 = as the hardware allows)
+  // NULL numbers are skipped (as in SQL). Without other numbers the result is NULL.
+  // The result is the same for any number of threads, as the sum is exact until it is rounded.
+  static basic_bcd Sum    (const basic_bcd* p_numbers,size_t p_count,unsigned p_threads = 0);
+  static basic_bcd Average(const basic_bcd* p_numbers,size_t p_count,unsigned p_threads = 0);
+  static basic_bcd Minimum(const basic_bcd* p_numbers,size_t p_count,unsigned p_threads = 0);
+  static basic_bcd Maximum(const basic_bcd* p_numbers,size_t p_count,unsigned p_threads = 0);
+
+  // FUSED OPERATIONS
+  // The full product is kept and the result is rounded only once
+
+  // (p_one * p_two) + p_three
+  static basic_bcd FusedMultiplyAdd(const basic_bcd& p_one,const basic_bcd& p_two,const basic_bcd& p_three);
+  // Sum of the products p_one[i] * p_two[i] of two arrays of p_count numbers
+  static basic_bcd DotProduct(const basic_bcd* p_one,const basic_bcd* p_two,size_t p_count);
+
+  // FILE STREAM FUNCTIONS
+  bool       WriteToFile (FILE* p_fp);
+  bool       ReadFromFile(FILE* p_fp);
+
+#ifdef _DEBUG
+  // Debug print of the mantissa
+  XString    DebugPrint(PTCHAR p_name);
+#endif
+
+private:
+
+  // INTERNALS
+
+  // Set infinity for overflows
+  basic_bcd  SetInfinity(LPCTSTR p_reason = _T(""),unsigned p_status = bcd_context::StatusInvalid) const;
+  // Exponent of a result out of range: (-)INF or zero
+  bool       ExponentOutOfRange(int p_exponent,Sign p_sign,basic_bcd& p_result) const;
+  // Conversion to another type not possible
+  void       ConversionError(LPCTSTR p_reason,unsigned p_status = bcd_context::StatusOverflow) const;
+  // Raise the inexact status if digits were lost
+  void       RaiseInexact(bool p_inexact) const;
+  // Sets one integer in this bcd number
+  void       SetValueInt(const int p_value);
+  // Sets one or two longs in this bcd number
+  void       SetValueLong(const long p_value, const long p_restValue);
+  // Sets one or two longs in this bcd number
+  void       SetValueInt64 (const  int64 p_value,const int64 p_restValue);
+  void       SetValueUInt64(const uint64 p_value,const int64 p_restValue);
+  // Sets the value from a double
+  void       SetValueDouble(const double p_value);
+  // Sets the value from a string
+  void       SetValueString(LPCTSTR p_string,bool p_fromDB = false);
+  // Append a run of digits to the mantissa
+  int        ScanDigits(const char*& p_pos,const char* p_last,int& p_digits,bool& p_inexact);
+  // Sets the value from a SQL NUMERIC
+  void       SetValueNumeric(const SQL_NUMERIC_STRUCT* p_numeric);
+  // Take the absolute value of a long
+  long       long_abs(const long p_value) const;
+  // Normalize the mantissa/exponent
+  void       Normalize(int p_startExponent = 0);
+  // Multiply the mantissa by 10
+  void       Mult10(int p_times = 1);
+  // Divide the mantissa by 10 (true if non-zero digits fell off)
+  bool       Div10(int p_times = 1);
+  // Shift mantissa 1 position right
+  void       ShiftRight();
+  // Shift mantissa 1 position left
+  void       ShiftLeft();
+  // Convert a string to a single long value
+  long       StringToLong(LPCTSTR p_string) const;
+  // Split the mantissa for floor/ceiling operations
+  basic_bcd  SplitMantissa() const;
+  // Compare two mantissa
+  int        CompareMantissa(const basic_bcd& p_value) const;
+  // Compare the absolute values of two valid numbers
+  int        CompareAbsolute(const basic_bcd& p_value) const;
+  // Three way comparison of a valid number with an integer (times 10^-p_scale) or a double
+  int        CompareInteger(const int64 p_value,const int p_scale = 0) const;
+  int        CompareDouble(const double p_value) const;
+  // Number of a string for the comparisons, parsed once while it stays in the cache
+  static basic_bcd CachedString(LPCTSTR p_string);
+  // Number of limbs up to the last non-zero limb
+  int        SignificantLimbs() const;
+  // Calculate the precision and scale for a SQL_NUMERIC
+  void       CalculatePrecisionAndScale(SQLCHAR& p_precision,SQLCHAR& p_scale) const;
+  // Fill a SQL_NUMERIC with a given precision and scale
+  void       NumericValue(SQL_NUMERIC_STRUCT* p_numeric,SQLCHAR p_precision,SQLSCHAR p_scale) const;
+  // Stopping criterion for internal iterations
+  basic_bcd  Epsilon(long p_fraction) const;
+  // Digits of ln(10) and PI after the mantissa of LN10() and PI()
+  static basic_bcd LN10Tail();
+  static basic_bcd PITail();
+  // Taylor series of exp for a small number, summed in one accumulator
+  static basic_bcd ExpSeries(const basic_bcd& p_number);
+  // Tables of exp(p_step / expTableSteps[p_level]) for the reduction of Exp
+  static const basic_bcd& ExpTable(int p_level,int p_step);
+  // Taylor series of ln((1 + z) / (1 - z)) for a small z, summed in one accumulator
+  static basic_bcd LogSeries(const basic_bcd& p_ratio);
+  // Tables of ln(1 + p_step / logTableSteps[p_level]) for the reduction of Log
+  static const basic_bcd& LogTable(int p_level,int p_step);
+  // Reduce an angle to [-PI/4,PI/4]. Returns the quadrant, or -1 for an angle too large to reduce
+  int        ReduceAngle(basic_bcd& p_angle) const;
+  // Taylor series of sine and/or cosine of a reduced angle, summed in accumulators
+  static void TrigSeries(const basic_bcd& p_angle,basic_bcd* p_sine,basic_bcd* p_cosine);
+  // Working precisions (in limbs) of a Newton iteration with doubling precision
+  static int NewtonPrecisions(int* p_limbs);
+  // This number with only the first p_limbs limbs of the mantissa
+  basic_bcd  TruncatedLimbs(int p_limbs) const;
+  // One unit in the last digit of the mantissa
+  basic_bcd  UnitInLastPlace() const;
+
+  // BASIC OPERATIONS
+
+  // Addition operation
+  basic_bcd Add(const basic_bcd& p_number) const;
+  // Subtraction operation
+  basic_bcd Sub(const basic_bcd& p_number) const;
+  // Multiplication
+  basic_bcd Mul(const basic_bcd& p_number) const;
+  // Division
+  basic_bcd Div(const basic_bcd& p_number) const;
+  // Modulo
+  basic_bcd Mod(const basic_bcd& p_number) const;
+  // Multiplication, division and modulo by a small integer
+  basic_bcd MulInt(const int p_value) const;
+  basic_bcd DivInt(const int p_value) const;
+  basic_bcd ModInt(const int p_value) const;
+
+  // Helpers for the basic operations
+
+  // Position arguments and signs for the next operation
+  void PositionArguments(basic_bcd& arg1,basic_bcd& arg2,Sign& signResult,Operator& operatorKind) const;
+  // Calculate the sign for multiplication or division
+  Sign CalculateSign(const basic_bcd& p_arg1, const basic_bcd& p_arg2) const;
+  // Addition of two mantissa (no signs/exponents)
+  basic_bcd  PositiveAddition(basic_bcd& arg1,basic_bcd& arg2) const;
+  // Subtraction of two mantissa (no signs/exponents)
+  basic_bcd  PositiveSubtraction(basic_bcd& arg1,basic_bcd& arg2) const;
+  // Multiplication of two mantissa (no signs)
+  basic_bcd  PositiveMultiplication(const basic_bcd& p_arg1,const basic_bcd& p_arg2) const;
+  // Full product of two mantissa in base bcdBase (no signs). Returns the number of limbs
+  static int FullProduct(const basic_bcd& p_arg1,const basic_bcd& p_arg2,uint64* p_product);
+  // Addition/subtraction and multiplication of two valid numbers into this one
+  void       ColumnAddition(const basic_bcd& p_one,const basic_bcd& p_two,bool p_subtract);
+  void       ColumnMultiplication(const basic_bcd& p_one,const basic_bcd& p_two);
+  // Division of two mantissa (no signs)
+  basic_bcd  PositiveDivision(const basic_bcd& p_arg1,const basic_bcd& p_arg2) const;
+  // Truncated quotient and remainder of two mantissa (no signs)
+  void       PositiveDivMod(const basic_bcd& p_arg1,const basic_bcd& p_arg2,basic_bcd& p_quotient,basic_bcd& p_remainder) const;
+  // Multiplication and division of the mantissa by one 32 bits value (no signs)
+  basic_bcd  ScalarMultiplication(const uint64 p_value) const;
+  basic_bcd  ScalarDivision(const uint64 p_value) const;
+  // Column sums of the product of two mantissa
+  static void MultiplyColumns(const uint64* p_one,const uint64* p_two,const int p_length,uint64* p_result);
+
+  // Helpers for the reductions
+
+  // Index of the first smallest (p_order = -1) or greatest (p_order = 1) number
+  static size_t ReduceExtreme(const basic_bcd* p_numbers,size_t p_count,unsigned p_threads,int p_order);
+
+  // All widths can reach each others storage for the conversions
+  template<int Other>
+  friend class basic_bcd;
+  // The column store converts directly from and to the storage
+  friend class basic_bcd_column<Limbs>;
+
+  // STORAGE OF THE NUMBER
+  Sign          m_sign;                // 0 = Positive, 1 = Negative (INF, NaN)
+  short         m_exponent;            // +/- 10E32767
+  long          m_mantissa[bcdLength]; // Up to (bcdDigits * bcdLength) digits
+};
+
+//////////////////////////////////////////////////////////////////////////
+//
+// The accumulator of a sum of bcd numbers
+// Every number is added exactly into a register of 64 bits bins, one bin for
+// each limb position (power of bcdBase) of the exponent range in use.
+// Adding a number only adds its limbs to the bins: there is no alignment of
+// the exponents, no comparison of the signs and no normalization.
+// The carries are propagated when the result is read, and only then the
+// sum is rounded (once) to the precision of the bcd. As the sum is exact,
+// the order of the numbers does not matter.
+//
+//////////////////////////////////////////////////////////////////////////
+
+template<int Limbs>
+class basic_bcd<Limbs>::Accumulator
+{
+public:
+  Accumulator();
+  Accumulator(const Accumulator& p_other);
+ ~Accumulator();
+  Accumulator& operator=(const Accumulator& p_other);
+
+  // Add or subtract one number
+  void       Add(const basic_bcd& p_number);
+  void       Sub(const basic_bcd& p_number);
+  Accumulator& operator+=(const basic_bcd& p_number);
+  Accumulator& operator-=(const basic_bcd& p_number);
+  // Add an array of p_count numbers
+  void       Add(const basic_bcd* p_numbers,size_t p_count);
+  // Add the exact product of two numbers
+  void       AddProduct(const basic_bcd& p_one,const basic_bcd& p_two);
+  // Add the sum of another accumulator
+  void       Add(const Accumulator& p_other);
+  // Start again from zero
+  void       Clear();
+  // Number of numbers added and subtracted
+  uint64     GetCount() const;
+  // The sum, rounded to the precision of the bcd
+  basic_bcd  Result() const;
+
+private:
+  // Add p_count limbs to the bins. The first limb has the exponent p_exponent
+  void       AddLimbs(const long* p_limbs,int p_count,int p_exponent,bool p_negative);
+  // Add a NULL, INF or NaN (or anything after that) as the operators do
+  void       AddSpecial(const basic_bcd& p_number,bool p_negate);
+  // Make room for the limb positions p_low up to p_high
+  void       Reserve(int p_low,int p_high);
+  // Propagate the carries of the bins p_bins. Returns the carry out of the last bin
+  static int64 Carry(int64* p_bins,int p_size);
+
+  // Bins of a sum without far apart exponents (as a full product) need no heap
+  static const int localBins = 2 * bcdLength + 12;
+
+  int64*     m_bins    { nullptr }; // The bins, the first one at limb position m_low
+  int        m_low     { 0 };       // Limb position: bin value * bcdBase^m_low
+  int        m_size    { 0 };       // Number of bins
+  uint64     m_count   { 0 };       // Numbers added
+  unsigned   m_pending { 0 };       // Numbers added since the last carry propagation
+  bool       m_special { false };   // A NULL, INF or NaN was added
+  basic_bcd  m_result;              // The sum after a NULL, INF or NaN
+  int64      m_local[localBins];    // The bins while they fit
+};
+
+// Definition of the class constants of each width
+template<int Limbs> const int basic_bcd<Limbs>::bcdLength;
+template<int Limbs> const int basic_bcd<Limbs>::bcdPrecision;
+
+// bcd::bcd(basic_bcd<Other>)
+// Description: BCD from a bcd of another width
+// Technical:   Mantissa elements that do not fit are dropped (truncated)
+//              Missing mantissa elements become zero
+template<int Limbs>
+template<int Other>
+basic_bcd<Limbs>::basic_bcd(const basic_bcd<Other>& p_other)
+{
+  // Sign status enumerations are in the same order for all widths
+  m_sign     = (Sign) p_other.m_sign;
+  m_exponent = p_other.m_exponent;
+
+  for(int ind = 0; ind < bcdLength; ++ind)
+  {
+    m_mantissa[ind] = (ind < basic_bcd<Other>::bcdLength) ? p_other.m_mantissa[ind] : 0L;
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////
+//
+// OVERLOADED MATH FUNCTIONS (Everybody has come to expect)
+//
+//////////////////////////////////////////////////////////////////////////
+
+// Overloaded math precision floating point functions equivalent with the std C functions
+// Overloaded to work with the BCD number class, always yielding a bcd number.
+
+template<int Limbs>
+inline basic_bcd<Limbs> modf(const basic_bcd<Limbs>& p_number,basic_bcd<Limbs>* p_intpart)
+{
+  *p_intpart = p_number.Floor();
+  return p_number.Fraction();
+}
+
+template<int Limbs>
+inline basic_bcd<Limbs> fmod(const basic_bcd<Limbs>& p_number,const basic_bcd<Limbs>& p_divisor)
+{
+  return p_number % p_divisor;
+}
+
+template<int Limbs>
+inline basic_bcd<Limbs> floor(const basic_bcd<Limbs>& p_number)
+{
+  return p_number.Floor();
+}
+
+template<int Limbs>
+inline basic_bcd<Limbs> ceil(const basic_bcd<Limbs>& p_number)
+{
+  return p_number.Ceiling();
+}
+
+template<int Limbs>
+inline basic_bcd<Limbs> fabs(const basic_bcd<Limbs>& p_number)
+{
+  return p_number.AbsoluteValue();
+}
+
+template<int Limbs>
+inline basic_bcd<Limbs> sqrt(const basic_bcd<Limbs>& p_number)
+{
+  return p_number.SquareRoot();
+}
+
+template<int Limbs>
+inline basic_bcd<Limbs> log10(const basic_bcd<Limbs>& p_number)
+{
+  return p_number.Log10();
+}
+
+template<int Limbs>
+inline basic_bcd<Limbs> log(const basic_bcd<Limbs>& p_number)
+{
+  return p_number.Log();
+}
+
+template<int Limbs>
+inline basic_bcd<Limbs> exp(const basic_bcd<Limbs>& p_number)
+{
+  return p_number.Exp();
+}
+
+template<int Limbs>
+inline basic_bcd<Limbs> pow(const basic_bcd<Limbs>& p_number,const basic_bcd<Limbs>& p_power)
+{
+  return p_number.Power(p_power);
+}
+
+template<int Limbs>
+inline basic_bcd<Limbs> frexp(const basic_bcd<Limbs>& p_number,int* p_exponent)
+{
+  *p_exponent = p_number.GetExponent();
+  return p_number.GetMantissa();
+}
+
+template<int Limbs>
+inline basic_bcd<Limbs> ldexp(const basic_bcd<Limbs>& p_number,int p_power)
+{
+  if(p_power == 0)
+  {
+    return p_number;
+  }
+  if(p_power > 0 && p_power <= 31)
+  {
+    return p_number * basic_bcd<Limbs>((long) (((unsigned)1) << p_power));
+  }
+  return p_number * pow(basic_bcd<Limbs>(2L),basic_bcd<Limbs>((long)p_power));
+}
+
+// Overloaded trigonometric functions on a bcd number
+
+template<int Limbs>
+inline basic_bcd<Limbs> atan(const basic_bcd<Limbs>& p_number)
+{
+  return p_number.ArcTangent();
+}
+
+template<int Limbs>
+inline basic_bcd<Limbs> atan2(const basic_bcd<Limbs>& p_y,const basic_bcd<Limbs>& p_x)
+{
+  return p_y.ArcTangent2Points(p_x);
+}
+
+template<int Limbs>
+inline basic_bcd<Limbs> asin(const basic_bcd<Limbs>& p_number)
+{
+  return p_number.ArcSine();
+}
+
+template<int Limbs>
+inline basic_bcd<Limbs> acos(const basic_bcd<Limbs>& p_number)
+{
+  return p_number.ArcCosine();
+}
+
+template<int Limbs>
+inline basic_bcd<Limbs> sin(const basic_bcd<Limbs>& p_number)
+{
+  return p_number.Sine();
+}
+
+template<int Limbs>
+inline basic_bcd<Limbs> cos(const basic_bcd<Limbs>& p_number)
+{
+  return p_number.Cosine();
+}
+
+template<int Limbs>
+inline basic_bcd<Limbs> tan(const basic_bcd<Limbs>& p_number)
+{
+  return p_number.Tangent();
+}
+
+template<int Limbs>
+inline void sincos(const basic_bcd<Limbs>& p_number,basic_bcd<Limbs>& p_sine,basic_bcd<Limbs>& p_cosine)
+{
+  p_number.SinCos(p_sine,p_cosine);
+}
@@ -0,0 +1,1036 @@
+/////////////////////////////////////////////////////////////////////////////////
+//
+// SourceFile: bcd_column.cpp
+//
+// BaseLibrary: Indispensable general objects and functions
+//
+// Copyright (c) 2014-2022 ir. W.E. Huisman
+// All rights reserved
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////
+//
+// BCD COLUMN
+//
+// A column of bcd numbers stored as a structure of arrays.
+// See bcd_column.h for the layout of the storage.
+//
+// The AVX2 kernels work on 8 numbers in the 32 bits lanes of a register.
+// A limb (< 1E8) fits a lane, and so do the sums of two limbs.
+// Divisions by powers of 10 are done by a multiplication with the reciprocal.
+// The kernels follow the steps of the basic_bcd operations exactly,
+// including the digits that fall off the mantissa (truncation and inexact).
+// The AVX2 instructions are only used when the processor has them.
+//
+// Copyright (c) 2014-2022 ir W. E. Huisman
+// Version 1.5 of 03-01-2022
+//
+#include "stdafx.h"         // Precompiled headers
+#include "bcd_column.h"     // OUR INTERFACE
+#include "StdException.h"   // Exceptions
+#include <malloc.h>         // Aligned allocation of the arrays
+#ifdef _M_X64
+#include <intrin.h>         // AVX2 and CPUID intrinsics
+#endif
+
+#ifdef _DEBUG
+#define new DEBUG_NEW
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#endif
+
+// Alignment of the arrays: one AVX2 register
+const size_t bcdColumnAlign = 32;
+
+#ifdef _M_X64
+
+//////////////////////////////////////////////////////////////////////////
+//
+// AVX2 HELPERS
+//
+//////////////////////////////////////////////////////////////////////////
+
+// Processor and operating system support the AVX2 instructions
+static bool
+DetectAVX2()
+{
+  int info[4];
+  __cpuid(info,0);
+  if(info[0] < 7)
+  {
+    return false;
+  }
+  // OSXSAVE and AVX, and the operating system saves the YMM registers
+  __cpuid(info,1);
+  if((info[2] & (1 << 27)) == 0 || (info[2] & (1 << 28)) == 0)
+  {
+    return false;
+  }
+  if((_xgetbv(0) & 6) != 6)
+  {
+    return false;
+  }
+  __cpuidex(info,7,0);
+  return (info[1] & (1 << 5)) != 0;
+}
+
+// Checked once for the program
+static bool
+ColumnAVX2()
+{
+  static const bool avx2 = DetectAVX2();
+  return avx2;
+}
+
+// Division of the lanes by a constant: multiplication by the reciprocal
+// (2^shift / divisor rounded up) and a shift back. Exact for all lanes below 2^28.
+struct LaneDivisor
+{
+  int      m_divisor;
+  unsigned m_reciprocal;
+  int      m_shift;
+};
+
+static const LaneDivisor g_divide10    = { 10,       0x1999999AU,32 };
+static const LaneDivisor g_divide100   = { 100,      0x028F5C29U,32 };
+static const LaneDivisor g_divide10000 = { 10000,    0x068DB8BBU,40 };
+static const LaneDivisor g_divide1E6   = { 1000000,  0x431BDE83U,50 };
+static const LaneDivisor g_divide1E7   = { 10000000, 0x06B5FCA7U,50 };
+
+// Shifting 1, 2 or 4 digits to the right: divisor and the factor of the remainder
+static const LaneDivisor* g_shiftDivisor[3] = { &g_divide10,&g_divide100,&g_divide10000 };
+static const int          g_shiftFactor [3] = { 10000000,   1000000,     10000         };
+// Shifting 1, 2 or 4 digits to the left: divisor of the digits that go to the previous limb
+static const LaneDivisor* g_leftDivisor [3] = { &g_divide1E7,&g_divide1E6,&g_divide10000 };
+static const int          g_leftFactor  [3] = { 10,          100,         10000         };
+
+// Quotient of the lanes by a constant
+// The even and the odd lanes are multiplied to 64 bits separately
+static inline __m256i
+DivideLanes(const __m256i p_value,const LaneDivisor& p_divisor)
+{
+  const __m256i reciprocal = _mm256_set1_epi32((int)p_divisor.m_reciprocal);
+  const __m128i shiftEven  = _mm_cvtsi32_si128(p_divisor.m_shift);
+  const __m128i shiftOdd   = _mm_cvtsi32_si128(p_divisor.m_shift - 32);
+
+  __m256i even = _mm256_srl_epi64(_mm256_mul_epu32(p_value,reciprocal),shiftEven);
+  __m256i odd  = _mm256_srl_epi64(_mm256_mul_epu32(_mm256_srli_epi64(p_value,32),reciprocal),shiftOdd);
+  return _mm256_blend_epi32(even,odd,0xAA);
+}
+
+// Remainder of the lanes after DivideLanes
+static inline __m256i
+RemainderLanes(const __m256i p_value,const __m256i p_quotient,const LaneDivisor& p_divisor)
+{
+  return _mm256_sub_epi32(p_value,_mm256_mullo_epi32(p_quotient,_mm256_set1_epi32(p_divisor.m_divisor)));
+}
+
+// Lanes that are not zero (all bits set) or zero
+static inline __m256i
+NonZeroLanes(const __m256i p_value)
+{
+  return _mm256_xor_si256(_mm256_cmpeq_epi32(p_value,_mm256_setzero_si256()),_mm256_set1_epi32(-1));
+}
+
+// Select p_one where the mask is set, otherwise p_two
+static inline __m256i
+SelectLanes(const __m256i p_mask,const __m256i p_one,const __m256i p_two)
+{
+  return _mm256_blendv_epi8(p_two,p_one,p_mask);
+}
+
+// Lanes with a number the kernels can handle: a sign of a valid number and either
+// an exact zero (as IsZero) or a normalized mantissa. Also gives the zero lanes.
+template<int Limbs>
+static inline __m256i
+UsableLanes(const __m256i p_sign,const __m256i p_exponent,const __m256i* p_limbs,__m256i& p_zero)
+{
+  const __m256i zero = _mm256_setzero_si256();
+
+  __m256i any = p_limbs[0];
+  for(int ind = 1; ind < Limbs; ++ind)
+  {
+    any = _mm256_or_si256(any,p_limbs[ind]);
+  }
+  __m256i positive   = _mm256_cmpeq_epi32(p_sign,zero);
+  __m256i valid      = _mm256_or_si256(positive,_mm256_cmpeq_epi32(p_sign,_mm256_set1_epi32(1)));
+  __m256i normalized = _mm256_cmpgt_epi32(p_limbs[0],_mm256_set1_epi32(bcdBase / 10 - 1));
+
+  p_zero = _mm256_and_si256(_mm256_and_si256(positive,_mm256_cmpeq_epi32(p_exponent,zero)),_mm256_cmpeq_epi32(any,zero));
+  return _mm256_and_si256(valid,_mm256_or_si256(p_zero,normalized));
+}
+
+// Compare two mantissa in the lanes: masks of the greater and smaller lanes
+template<int Limbs>
+static inline void
+CompareMantissaLanes(const __m256i* p_one,const __m256i* p_two,__m256i& p_greater,__m256i& p_smaller)
+{
+  __m256i equal = _mm256_set1_epi32(-1);
+  p_greater = _mm256_setzero_si256();
+  p_smaller = _mm256_setzero_si256();
+  for(int ind = 0; ind < Limbs; ++ind)
+  {
+    p_greater = _mm256_or_si256(p_greater,_mm256_and_si256(equal,_mm256_cmpgt_epi32(p_one[ind],p_two[ind])));
+    p_smaller = _mm256_or_si256(p_smaller,_mm256_and_si256(equal,_mm256_cmpgt_epi32(p_two[ind],p_one[ind])));
+    equal     = _mm256_and_si256(equal,_mm256_cmpeq_epi32(p_one[ind],p_two[ind]));
+  }
+}
+
+// Shift the mantissa in the lanes one, two or four digits to the right (as Div10)
+// Only in the lanes of the mask. Lanes where non-zero digits fall off are added to p_lost
+template<int Limbs>
+static inline void
+ShiftDigitsLanes(__m256i* p_limbs,const int p_pass,const __m256i p_mask,__m256i& p_lost)
+{
+  const LaneDivisor& divisor = *g_shiftDivisor[p_pass];
+  const __m256i      factor  = _mm256_set1_epi32(g_shiftFactor[p_pass]);
+
+  __m256i carry = _mm256_setzero_si256();
+  for(int ind = 0; ind < Limbs; ++ind)
+  {
+    __m256i quotient  = DivideLanes(p_limbs[ind],divisor);
+    __m256i remainder = RemainderLanes(p_limbs[ind],quotient,divisor);
+    __m256i shifted   = _mm256_add_epi32(quotient,_mm256_mullo_epi32(carry,factor));
+    p_limbs[ind] = SelectLanes(p_mask,shifted,p_limbs[ind]);
+    carry = remainder;
+  }
+  p_lost = _mm256_or_si256(p_lost,_mm256_and_si256(p_mask,NonZeroLanes(carry)));
+}
+
+// Shift the mantissa in the lanes p_digits (0 to bcdDigits * Limbs) to the right
+// Whole limbs in steps of 1, 2, 4,... limbs, then the digits in steps of 1, 2 and 4
+template<int Limbs>
+static inline void
+ShiftRightLanes(__m256i* p_limbs,const __m256i p_digits,__m256i& p_lost)
+{
+  const __m256i zero  = _mm256_setzero_si256();
+  const __m256i limbs = _mm256_srli_epi32(p_digits,3);
+
+  for(int step = 1; step <= Limbs; step *= 2)
+  {
+    __m256i mask = _mm256_cmpgt_epi32(_mm256_and_si256(limbs,_mm256_set1_epi32(step)),zero);
+    for(int ind = Limbs - 1; ind >= 0; --ind)
+    {
+      if(ind >= Limbs - step)
+      {
+        p_lost = _mm256_or_si256(p_lost,_mm256_and_si256(mask,NonZeroLanes(p_limbs[ind])));
+      }
+      __m256i from = (ind >= step) ? p_limbs[ind - step] : zero;
+      p_limbs[ind] = SelectLanes(mask,from,p_limbs[ind]);
+    }
+  }
+  const __m256i digits = _mm256_and_si256(p_digits,_mm256_set1_epi32(bcdDigits - 1));
+  for(int pass = 0; pass < 3; ++pass)
+  {
+    __m256i mask = _mm256_cmpgt_epi32(_mm256_and_si256(digits,_mm256_set1_epi32(1 << pass)),zero);
+    if(!_mm256_testz_si256(mask,mask))
+    {
+      ShiftDigitsLanes<Limbs>(p_limbs,pass,mask,p_lost);
+    }
+  }
+}
+
+// Normalize the mantissa in the lanes of the mask (as Normalize)
+// Gives the number of digits shifted to the left. The lanes must not be zero
+template<int Limbs>
+static inline __m256i
+NormalizeLanes(__m256i* p_limbs,const __m256i p_mask)
+{
+  const __m256i zero = _mm256_setzero_si256();
+  const __m256i one  = _mm256_set1_epi32(1);
+
+  // Leading zero limbs, and the first limb that is not zero
+  __m256i leading = p_mask;
+  __m256i limbs   = zero;
+  __m256i first   = zero;
+  for(int ind = 0; ind < Limbs; ++ind)
+  {
+    __m256i empty = _mm256_cmpeq_epi32(p_limbs[ind],zero);
+    first   = SelectLanes(_mm256_andnot_si256(empty,leading),p_limbs[ind],first);
+    leading = _mm256_and_si256(leading,empty);
+    limbs   = _mm256_add_epi32(limbs,_mm256_and_si256(leading,one));
+  }
+  // Leading zero digits of the first limb
+  __m256i digits = zero;
+  for(int power = 10; power < bcdBase; power *= 10)
+  {
+    digits = _mm256_add_epi32(digits,_mm256_and_si256(_mm256_cmpgt_epi32(_mm256_set1_epi32(power),first),one));
+  }
+  digits = _mm256_and_si256(p_mask,digits);
+  limbs  = _mm256_and_si256(p_mask,limbs);
+
+  // Whole limbs in steps of 1, 2, 4,... limbs
+  for(int step = 1; step < Limbs; step *= 2)
+  {
+    __m256i mask = _mm256_cmpgt_epi32(_mm256_and_si256(limbs,_mm256_set1_epi32(step)),zero);
+    if(_mm256_testz_si256(mask,mask))
+    {
+      continue;
+    }
+    for(int ind = 0; ind < Limbs; ++ind)
+    {
+      __m256i from = (ind + step < Limbs) ? p_limbs[ind + step] : zero;
+      p_limbs[ind] = SelectLanes(mask,from,p_limbs[ind]);
+    }
+  }
+  // Digits in steps of 1, 2 and 4
+  for(int pass = 0; pass < 3; ++pass)
+  {
+    __m256i mask = _mm256_cmpgt_epi32(_mm256_and_si256(digits,_mm256_set1_epi32(1 << pass)),zero);
+    if(_mm256_testz_si256(mask,mask))
+    {
+      continue;
+    }
+    const LaneDivisor& divisor = *g_leftDivisor[pass];
+    const __m256i      factor  = _mm256_set1_epi32(g_leftFactor[pass]);
+    for(int ind = 0; ind < Limbs; ++ind)
+    {
+      __m256i front   = DivideLanes(p_limbs[ind],divisor);
+      __m256i rest    = RemainderLanes(p_limbs[ind],front,divisor);
+      __m256i next    = (ind + 1 < Limbs) ? DivideLanes(p_limbs[ind + 1],divisor) : zero;
+      __m256i shifted = _mm256_add_epi32(_mm256_mullo_epi32(rest,factor),next);
+      p_limbs[ind] = SelectLanes(mask,shifted,p_limbs[ind]);
+    }
+  }
+  return _mm256_add_epi32(_mm256_slli_epi32(limbs,3),digits);
+}
+
+// Mask of the lanes as a bit per number
+static inline int
+LaneBits(const __m256i p_mask)
+{
+  return _mm256_movemask_ps(_mm256_castsi256_ps(p_mask));
+}
+
+#endif // _M_X64
+
+//////////////////////////////////////////////////////////////////////////
+//
+// CONSTRUCTORS/DESTRUCTORS
+//
+//////////////////////////////////////////////////////////////////////////
+
+template<int Limbs>
+basic_bcd_column<Limbs>::basic_bcd_column(size_t p_count /*= 0*/)
+{
+  Allocate(p_count);
+}
+
+template<int Limbs>
+basic_bcd_column<Limbs>::basic_bcd_column(const number* p_numbers,size_t p_count)
+{
+  FromArray(p_numbers,p_count);
+}
+
+template<int Limbs>
+basic_bcd_column<Limbs>::basic_bcd_column(const basic_bcd_column& p_column)
+{
+  *this = p_column;
+}
+
+template<int Limbs>
+basic_bcd_column<Limbs>::~basic_bcd_column()
+{
+  if(m_storage)
+  {
+    _aligned_free(m_storage);
+  }
+}
+
+template<int Limbs>
+basic_bcd_column<Limbs>&
+basic_bcd_column<Limbs>::operator=(const basic_bcd_column& p_column)
+{
+  if(this != &p_column)
+  {
+    Allocate(p_column.m_count);
+    if(m_storage)
+    {
+      memcpy(m_storage,p_column.m_storage,(2 + Limbs) * m_stride * sizeof(int));
+    }
+  }
+  return *this;
+}
+
+// Number of numbers in the column
+template<int Limbs>
+size_t
+basic_bcd_column<Limbs>::GetCount() const
+{
+  return m_count;
+}
+
+// bcd_column::Resize
+// Description: New size of the column
+// Technical:   The numbers up to the new size are kept, new numbers are zero
+template<int Limbs>
+void
+basic_bcd_column<Limbs>::Resize(size_t p_count)
+{
+  if(p_count == m_count)
+  {
+    return;
+  }
+  basic_bcd_column column(p_count);
+  size_t count = min(p_count,m_count);
+  for(int array = 0; count && array < 2 + Limbs; ++array)
+  {
+    memcpy(column.m_storage + array * column.m_stride,m_storage + array * m_stride,count * sizeof(int));
+  }
+  // Take over the storage of the new column
+  int* storage     = m_storage;
+  m_storage        = column.m_storage;
+  m_count          = column.m_count;
+  m_stride         = column.m_stride;
+  column.m_storage = storage;
+}
+
+//////////////////////////////////////////////////////////////////////////
+//
+// CONVERSION TO AND FROM BCD
+//
+//////////////////////////////////////////////////////////////////////////
+
+template<int Limbs>
+typename basic_bcd_column<Limbs>::number
+basic_bcd_column<Limbs>::GetValue(size_t p_index) const
+{
+  if(p_index >= m_count)
+  {
+    throw StdException(_T("BCD column: Index out of range."));
+  }
+  number result;
+  result.m_sign     = (typename number::Sign) Signs()[p_index];
+  result.m_exponent = (short) Exponents()[p_index];
+  for(int ind = 0; ind < Limbs; ++ind)
+  {
+    result.m_mantissa[ind] = (long) Limb(ind)[p_index];
+  }
+  return result;
+}
+
+template<int Limbs>
+void
+basic_bcd_column<Limbs>::SetValue(size_t p_index,const number& p_number)
+{
+  if(p_index >= m_count)
+  {
+    throw StdException(_T("BCD column: Index out of range."));
+  }
+  Signs()    [p_index] = (int) p_number.m_sign;
+  Exponents()[p_index] = (int) p_number.m_exponent;
+  for(int ind = 0; ind < Limbs; ++ind)
+  {
+    Limb(ind)[p_index] = (int) p_number.m_mantissa[ind];
+  }
+}
+
+// All numbers of an array to the column. The column gets the size of the array
+template<int Limbs>
+void
+basic_bcd_column<Limbs>::FromArray(const number* p_numbers,size_t p_count)
+{
+  Allocate(p_count);
+  for(size_t index = 0; index < p_count; ++index)
+  {
+    SetValue(index,p_numbers[index]);
+  }
+}
+
+// All numbers of the column to an array of at least GetCount() numbers
+template<int Limbs>
+void
+basic_bcd_column<Limbs>::ToArray(number* p_numbers) const
+{
+  for(size_t index = 0; index < m_count; ++index)
+  {
+    p_numbers[index] = GetValue(index);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////
+//
+// COLUMN OPERATIONS
+//
+//////////////////////////////////////////////////////////////////////////
+
+// Column addition: p_result[i] = p_one[i] + p_two[i]
+template<int Limbs>
+void
+basic_bcd_column<Limbs>::Add(const basic_bcd_column& p_one,const basic_bcd_column& p_two,basic_bcd_column& p_result)
+{
+  AddColumns(p_one,p_two,p_result,false);
+}
+
+// Column subtraction: p_result[i] = p_one[i] - p_two[i]
+template<int Limbs>
+void
+basic_bcd_column<Limbs>::Sub(const basic_bcd_column& p_one,const basic_bcd_column& p_two,basic_bcd_column& p_result)
+{
+  AddColumns(p_one,p_two,p_result,true);
+}
+
+// Column scaling: p_result[i] = p_numbers[i] * p_factor
+// Technical: The kernel handles a factor with one significant limb (up to 8 digits).
+//            Other factors take the way of the basic_bcd multiplication.
+template<int Limbs>
+void
+basic_bcd_column<Limbs>::Scale(const basic_bcd_column& p_numbers,const number& p_factor,basic_bcd_column& p_result)
+{
+  CheckSize(p_numbers,p_numbers,p_result);
+
+#ifdef _M_X64
+  bool single = p_factor.IsValid() && p_factor.m_mantissa[0] >= bcdBase / 10;
+  for(int ind = 1; ind < Limbs; ++ind)
+  {
+    single &= (p_factor.m_mantissa[ind] == 0);
+  }
+  if(single && ColumnAVX2())
+  {
+    for(size_t index = 0; index < p_numbers.m_count; index += columnLanes)
+    {
+      ScaleLanes(p_numbers,p_factor,p_result,index);
+    }
+    _mm256_zeroupper();
+    return;
+  }
+#endif
+  for(size_t index = 0; index < p_numbers.m_count; ++index)
+  {
+    p_result.SetValue(index,MulNumber(p_numbers,p_factor,index));
+  }
+}
+
+// Column comparison: p_result[i] = -1, 0 or 1 as p_one[i] is smaller, equal or greater
+template<int Limbs>
+void
+basic_bcd_column<Limbs>::Compare(const basic_bcd_column& p_one,const basic_bcd_column& p_two,int* p_result)
+{
+  if(p_one.m_count != p_two.m_count)
+  {
+    throw StdException(_T("BCD column: Columns of different sizes."));
+  }
+#ifdef _M_X64
+  if(ColumnAVX2())
+  {
+    for(size_t index = 0; index < p_one.m_count; index += columnLanes)
+    {
+      CompareLanes(p_one,p_two,p_result,index);
+    }
+    _mm256_zeroupper();
+    return;
+  }
+#endif
+  for(size_t index = 0; index < p_one.m_count; ++index)
+  {
+    p_result[index] = CompareNumber(p_one.GetValue(index),p_two.GetValue(index));
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////
+//
+// INTERNALS
+//
+//////////////////////////////////////////////////////////////////////////
+
+// bcd_column::Allocate
+// Description: Allocate the arrays for p_count numbers
+// Technical:   All arrays in one block, all numbers zero
+template<int Limbs>
+void
+basic_bcd_column<Limbs>::Allocate(size_t p_count)
+{
+  if(m_storage)
+  {
+    _aligned_free(m_storage);
+    m_storage = nullptr;
+  }
+  m_count  = p_count;
+  m_stride = (p_count + columnLanes - 1) / columnLanes * columnLanes;
+  if(m_stride)
+  {
+    size_t size = (2 + Limbs) * m_stride * sizeof(int);
+    m_storage = (int*) _aligned_malloc(size,bcdColumnAlign);
+    if(m_storage == nullptr)
+    {
+      m_count  = 0;
+      m_stride = 0;
+      throw StdException(_T("BCD column: Out of memory."));
+    }
+    memset(m_storage,0,size);
+  }
+}
+
+template<int Limbs>
+int*
+basic_bcd_column<Limbs>::Signs() const
+{
+  return m_storage;
+}
+
+template<int Limbs>
+int*
+basic_bcd_column<Limbs>::Exponents() const
+{
+  return m_storage + m_stride;
+}
+
+template<int Limbs>
+int*
+basic_bcd_column<Limbs>::Limb(int p_limb) const
+{
+  return m_storage + (2 + p_limb) * m_stride;
+}
+
+// Arguments must have the same size. The result gets that size
+template<int Limbs>
+void
+basic_bcd_column<Limbs>::CheckSize(const basic_bcd_column& p_one,const basic_bcd_column& p_two,basic_bcd_column& p_result)
+{
+  if(p_one.m_count != p_two.m_count)
+  {
+    throw StdException(_T("BCD column: Columns of different sizes."));
+  }
+  p_result.Resize(p_one.m_count);
+}
+
+// Addition or subtraction of two columns
+template<int Limbs>
+void
+basic_bcd_column<Limbs>::AddColumns(const basic_bcd_column& p_one,const basic_bcd_column& p_two,basic_bcd_column& p_result,bool p_subtract)
+{
+  CheckSize(p_one,p_two,p_result);
+
+#ifdef _M_X64
+  if(ColumnAVX2())
+  {
+    for(size_t index = 0; index < p_one.m_count; index += columnLanes)
+    {
+      AddLanes(p_one,p_two,p_result,index,p_subtract);
+    }
+    _mm256_zeroupper();
+    return;
+  }
+#endif
+  for(size_t index = 0; index < p_one.m_count; ++index)
+  {
+    p_result.SetValue(index,AddNumber(p_one,p_two,index,p_subtract));
+  }
+}
+
+// One addition or subtraction as in the column operations of basic_bcd
+template<int Limbs>
+typename basic_bcd_column<Limbs>::number
+basic_bcd_column<Limbs>::AddNumber(const basic_bcd_column& p_one,const basic_bcd_column& p_two,size_t p_index,bool p_subtract)
+{
+  number one = p_one.GetValue(p_index);
+  number two = p_two.GetValue(p_index);
+  if(one.IsValid() && two.IsValid())
+  {
+    number result;
+    result.ColumnAddition(one,two,p_subtract);
+    return result;
+  }
+  return p_subtract ? one - two : one + two;
+}
+
+// One multiplication as in the column operations of basic_bcd
+template<int Limbs>
+typename basic_bcd_column<Limbs>::number
+basic_bcd_column<Limbs>::MulNumber(const basic_bcd_column& p_numbers,const number& p_factor,size_t p_index)
+{
+  number value = p_numbers.GetValue(p_index);
+  if(value.IsValid() && p_factor.IsValid())
+  {
+    number result;
+    result.ColumnMultiplication(value,p_factor);
+    return result;
+  }
+  return value * p_factor;
+}
+
+// bcd_column::CompareNumber
+// Description: Three way comparison of two numbers
+// Technical:   Valid numbers are ordered as bcd::Compare
+//              Other numbers (NULL, INF, NaN) get the outcome of the operators
+template<int Limbs>
+int
+basic_bcd_column<Limbs>::CompareNumber(const number& p_one,const number& p_two)
+{
+  if(!p_one.IsValid() || !p_two.IsValid())
+  {
+    if(p_one == p_two)
+    {
+      return 0;
+    }
+    return (p_one < p_two) ? -1 : 1;
+  }
+  return p_one.Compare(p_two);
+}
+
+#ifdef _M_X64
+
+//////////////////////////////////////////////////////////////////////////
+//
+// AVX2 KERNELS
+//
+//////////////////////////////////////////////////////////////////////////
+
+// bcd_column::AddLanes
+// Description: Addition or subtraction of the block of numbers at p_index
+// Technical:   The steps of ColumnAddition of basic_bcd for all lanes at once:
+//              1) A zero argument gives the other number
+//              2) Compare the absolute values: exponent first, then the mantissa
+//              3) Shift the mantissa of the smaller number to the exponent of the greater
+//              4) Add or subtract with carry. A carry out of the first limb
+//                 shifts the sum one digit to the right, a difference is normalized
+//              Lanes with unusable numbers or an exponent at the end of its range
+//              take the way of the operators.
+template<int Limbs>
+void
+basic_bcd_column<Limbs>::AddLanes(const basic_bcd_column& p_one,const basic_bcd_column& p_two,basic_bcd_column& p_result,size_t p_index,bool p_subtract)
+{
+  const __m256i zero = _mm256_setzero_si256();
+  const __m256i one  = _mm256_set1_epi32(1);
+  const __m256i base = _mm256_set1_epi32(bcdBase);
+
+  __m256i signOne = _mm256_load_si256((const __m256i*)(p_one.Signs() + p_index));
+  __m256i signTwo = _mm256_load_si256((const __m256i*)(p_two.Signs() + p_index));
+  __m256i expOne  = _mm256_load_si256((const __m256i*)(p_one.Exponents() + p_index));
+  __m256i expTwo  = _mm256_load_si256((const __m256i*)(p_two.Exponents() + p_index));
+  __m256i limbsOne[Limbs];
+  __m256i limbsTwo[Limbs];
+  for(int ind = 0; ind < Limbs; ++ind)
+  {
+    limbsOne[ind] = _mm256_load_si256((const __m256i*)(p_one.Limb(ind) + p_index));
+    limbsTwo[ind] = _mm256_load_si256((const __m256i*)(p_two.Limb(ind) + p_index));
+  }
+  __m256i zeroOne;
+  __m256i zeroTwo;
+  __m256i usable = _mm256_and_si256(UsableLanes<Limbs>(signOne,expOne,limbsOne,zeroOne)
+                                   ,UsableLanes<Limbs>(signTwo,expTwo,limbsTwo,zeroTwo));
+  // Sign of the second number as it is added
+  __m256i signAdd = p_subtract ? _mm256_xor_si256(signTwo,one) : signTwo;
+
+  // Order on the absolute values
+  __m256i greater;
+  __m256i smaller;
+  CompareMantissaLanes<Limbs>(limbsOne,limbsTwo,greater,smaller);
+  __m256i sameExp = _mm256_cmpeq_epi32(expOne,expTwo);
+  __m256i swap    = _mm256_or_si256(_mm256_cmpgt_epi32(expTwo,expOne),_mm256_and_si256(sameExp,smaller));
+  __m256i equal   = _mm256_andnot_si256(greater,_mm256_andnot_si256(smaller,sameExp));
+
+  __m256i big[Limbs];
+  __m256i small[Limbs];
+  for(int ind = 0; ind < Limbs; ++ind)
+  {
+    big  [ind] = SelectLanes(swap,limbsTwo[ind],limbsOne[ind]);
+    small[ind] = SelectLanes(swap,limbsOne[ind],limbsTwo[ind]);
+  }
+  __m256i expBig   = SelectLanes(swap,expTwo,expOne);
+  __m256i expSmall = SelectLanes(swap,expOne,expTwo);
+  __m256i sign     = SelectLanes(swap,signAdd,signOne);
+
+  // Shift the smaller number to the exponent of the greater one
+  __m256i lost  = zero;
+  __m256i shift = _mm256_min_epi32(_mm256_sub_epi32(expBig,expSmall),_mm256_set1_epi32(bcdDigits * Limbs));
+  ShiftRightLanes<Limbs>(small,shift,lost);
+
+  // Addition and subtraction of the mantissa
+  __m256i adding = _mm256_cmpeq_epi32(signOne,signAdd);
+  __m256i carry  = zero;
+  __m256i borrow = zero;
+  __m256i sum [Limbs];
+  __m256i diff[Limbs];
+  for(int ind = Limbs - 1; ind >= 0; --ind)
+  {
+    __m256i value = _mm256_add_epi32(_mm256_add_epi32(big[ind],small[ind]),carry);
+    __m256i over  = _mm256_cmpgt_epi32(value,_mm256_set1_epi32(bcdBase - 1));
+    sum[ind] = _mm256_sub_epi32(value,_mm256_and_si256(over,base));
+    carry    = _mm256_and_si256(over,one);
+
+    value = _mm256_sub_epi32(_mm256_sub_epi32(big[ind],small[ind]),borrow);
+    __m256i under = _mm256_cmpgt_epi32(zero,value);
+    diff[ind] = _mm256_add_epi32(value,_mm256_and_si256(under,base));
+    borrow    = _mm256_and_si256(under,one);
+  }
+  // Carry out of the first limb: one digit to the right and one up in the exponent
+  __m256i carried = _mm256_and_si256(adding,_mm256_cmpeq_epi32(carry,one));
+  if(!_mm256_testz_si256(carried,carried))
+  {
+    ShiftDigitsLanes<Limbs>(sum,0,carried,lost);
+    sum[0] = _mm256_add_epi32(sum[0],_mm256_and_si256(carried,_mm256_set1_epi32(bcdBase / 10)));
+  }
+  __m256i exponent = _mm256_add_epi32(expBig,_mm256_and_si256(carried,one));
+
+  // Equal numbers subtracted give an exact zero
+  // Other differences can have leading zero digits
+  __m256i cancel    = _mm256_andnot_si256(adding,equal);
+  __m256i normalize = _mm256_andnot_si256(_mm256_or_si256(adding,cancel),_mm256_cmpgt_epi32(_mm256_set1_epi32(bcdBase / 10),diff[0]));
+  __m256i shifted   = zero;
+  if(!_mm256_testz_si256(normalize,normalize))
+  {
+    shifted = NormalizeLanes<Limbs>(diff,normalize);
+  }
+  exponent = _mm256_sub_epi32(exponent,shifted);
+
+  __m256i result[Limbs];
+  for(int ind = 0; ind < Limbs; ++ind)
+  {
+    result[ind] = _mm256_andnot_si256(cancel,SelectLanes(adding,sum[ind],diff[ind]));
+  }
+  sign     = _mm256_andnot_si256(cancel,sign);
+  exponent = _mm256_andnot_si256(cancel,exponent);
+
+  // Lanes for the operators: unusable numbers and an exponent that leaves its range
+  __m256i bothNumbers = _mm256_andnot_si256(_mm256_or_si256(zeroOne,zeroTwo),usable);
+  __m256i range       = _mm256_or_si256(_mm256_cmpeq_epi32(expBig,_mm256_set1_epi32(SHRT_MAX))
+                                       ,_mm256_cmpgt_epi32(_mm256_set1_epi32(SHRT_MIN),exponent));
+  __m256i operators   = _mm256_or_si256(_mm256_xor_si256(usable,_mm256_set1_epi32(-1))
+                                       ,_mm256_and_si256(bothNumbers,range));
+
+  // A zero argument gives the other number, with the sign as it is added
+  for(int ind = 0; ind < Limbs; ++ind)
+  {
+    result[ind] = SelectLanes(zeroTwo,limbsOne[ind],SelectLanes(zeroOne,limbsTwo[ind],result[ind]));
+  }
+  sign     = SelectLanes(zeroTwo,signOne,SelectLanes(zeroOne,signAdd,sign));
+  exponent = SelectLanes(zeroTwo,expOne, SelectLanes(zeroOne,expTwo, exponent));
+
+  // Digits that fell off in the lanes of the kernel
+  if(!_mm256_testz_si256(lost,_mm256_andnot_si256(operators,bothNumbers)))
+  {
+    bcd_context::Current().RaiseStatus(bcd_context::StatusInexact);
+  }
+
+  // Numbers by the operators, before the result overwrites an argument
+  number numbers[columnLanes];
+  int lanes = LaneBits(operators);
+  for(int lane = 0; lane < columnLanes && p_index + lane < p_one.m_count; ++lane)
+  {
+    if(lanes & (1 << lane))
+    {
+      numbers[lane] = AddNumber(p_one,p_two,p_index + lane,p_subtract);
+    }
+  }
+  _mm256_store_si256((__m256i*)(p_result.Signs()     + p_index),sign);
+  _mm256_store_si256((__m256i*)(p_result.Exponents() + p_index),exponent);
+  for(int ind = 0; ind < Limbs; ++ind)
+  {
+    _mm256_store_si256((__m256i*)(p_result.Limb(ind) + p_index),result[ind]);
+  }
+  for(int lane = 0; lane < columnLanes && p_index + lane < p_one.m_count; ++lane)
+  {
+    if(lanes & (1 << lane))
+    {
+      p_result.SetValue(p_index + lane,numbers[lane]);
+    }
+  }
+}
+
+// bcd_column::ScaleLanes
+// Description: Multiplication of the block of numbers at p_index by one factor
+// Technical:   The factor has one significant limb. The steps of PositiveMultiplication:
+//              1) The limbs are split in halves of 4 digits, so every product of
+//                 a half limb and a half of the factor fits a lane
+//              2) The product columns take in their carry from the last to the first
+//              3) The limb after the mantissa falls off (inexact)
+//              4) A first limb below 1E7 is normalized one digit to the left
+//              Lanes with unusable numbers or an exponent out of range take the
+//              way of the operators.
+template<int Limbs>
+void
+basic_bcd_column<Limbs>::ScaleLanes(const basic_bcd_column& p_numbers,const number& p_factor,basic_bcd_column& p_result,size_t p_index)
+{
+  const __m256i zero   = _mm256_setzero_si256();
+  const __m256i one    = _mm256_set1_epi32(1);
+  const __m256i half   = _mm256_set1_epi32(10000);
+  const __m256i high   = _mm256_set1_epi32(p_factor.m_mantissa[0] / 10000);
+  const __m256i low    = _mm256_set1_epi32(p_factor.m_mantissa[0] % 10000);
+  const __m256i factor = _mm256_set1_epi32(p_factor.m_sign == number::Sign::Negative ? 1 : 0);
+
+  __m256i sign     = _mm256_load_si256((const __m256i*)(p_numbers.Signs() + p_index));
+  __m256i exponent = _mm256_load_si256((const __m256i*)(p_numbers.Exponents() + p_index));
+  __m256i limbs[Limbs];
+  for(int ind = 0; ind < Limbs; ++ind)
+  {
+    limbs[ind] = _mm256_load_si256((const __m256i*)(p_numbers.Limb(ind) + p_index));
+  }
+  __m256i zeros;
+  __m256i usable = UsableLanes<Limbs>(sign,exponent,limbs,zeros);
+
+  // Half limbs of the mantissa
+  __m256i halves[2 * Limbs];
+  for(int ind = 0; ind < Limbs; ++ind)
+  {
+    halves[2 * ind]     = DivideLanes(limbs[ind],g_divide10000);
+    halves[2 * ind + 1] = RemainderLanes(limbs[ind],halves[2 * ind],g_divide10000);
+  }
+  // Product columns of half limbs, with the carry taken in
+  __m256i digits[2 * Limbs + 2];
+  __m256i carry = zero;
+  for(int ind = 2 * Limbs + 1; ind >= 0; --ind)
+  {
+    __m256i column = carry;
+    if(ind >= 1 && ind <= 2 * Limbs)
+    {
+      column = _mm256_add_epi32(column,_mm256_mullo_epi32(halves[ind - 1],high));
+    }
+    if(ind >= 2)
+    {
+      column = _mm256_add_epi32(column,_mm256_mullo_epi32(halves[ind - 2],low));
+    }
+    carry       = DivideLanes(column,g_divide10000);
+    digits[ind] = RemainderLanes(column,carry,g_divide10000);
+  }
+  // Back to whole limbs. The limb after the mantissa falls off
+  __m256i product[Limbs + 1];
+  for(int ind = 0; ind <= Limbs; ++ind)
+  {
+    product[ind] = _mm256_add_epi32(_mm256_mullo_epi32(digits[2 * ind],half),digits[2 * ind + 1]);
+  }
+  __m256i lost = NonZeroLanes(product[Limbs]);
+
+  // Normalize one digit to the left
+  __m256i normalize = _mm256_cmpgt_epi32(_mm256_set1_epi32(bcdBase / 10),product[0]);
+  __m256i ten       = _mm256_set1_epi32(10);
+  for(int ind = 0; ind < Limbs; ++ind)
+  {
+    __m256i front   = DivideLanes(product[ind],g_divide1E7);
+    __m256i rest    = RemainderLanes(product[ind],front,g_divide1E7);
+    __m256i next    = (ind + 1 < Limbs) ? DivideLanes(product[ind + 1],g_divide1E7) : zero;
+    __m256i shifted = _mm256_add_epi32(_mm256_mullo_epi32(rest,ten),next);
+    product[ind] = _mm256_andnot_si256(zeros,SelectLanes(normalize,shifted,product[ind]));
+  }
+  // Exponent of the product, that of a zero is checked just the same
+  __m256i sum    = _mm256_add_epi32(_mm256_add_epi32(exponent,_mm256_set1_epi32(p_factor.m_exponent)),one);
+  __m256i range  = _mm256_or_si256(_mm256_cmpgt_epi32(sum,_mm256_set1_epi32(SHRT_MAX))
+                                  ,_mm256_cmpgt_epi32(_mm256_set1_epi32(SHRT_MIN + 1),sum));
+  exponent = _mm256_andnot_si256(zeros,_mm256_sub_epi32(sum,_mm256_and_si256(normalize,one)));
+  sign     = _mm256_andnot_si256(zeros,_mm256_xor_si256(sign,factor));
+
+  __m256i operators = _mm256_or_si256(_mm256_xor_si256(usable,_mm256_set1_epi32(-1)),range);
+  if(!_mm256_testz_si256(lost,_mm256_andnot_si256(_mm256_or_si256(operators,zeros),usable)))
+  {
+    bcd_context::Current().RaiseStatus(bcd_context::StatusInexact);
+  }
+
+  // Numbers by the operators, before the result overwrites an argument
+  number numbers[columnLanes];
+  int lanes = LaneBits(operators);
+  for(int lane = 0; lane < columnLanes && p_index + lane < p_numbers.m_count; ++lane)
+  {
+    if(lanes & (1 << lane))
+    {
+      numbers[lane] = MulNumber(p_numbers,p_factor,p_index + lane);
+    }
+  }
+  _mm256_store_si256((__m256i*)(p_result.Signs()     + p_index),sign);
+  _mm256_store_si256((__m256i*)(p_result.Exponents() + p_index),exponent);
+  for(int ind = 0; ind < Limbs; ++ind)
+  {
+    _mm256_store_si256((__m256i*)(p_result.Limb(ind) + p_index),product[ind]);
+  }
+  for(int lane = 0; lane < columnLanes && p_index + lane < p_numbers.m_count; ++lane)
+  {
+    if(lanes & (1 << lane))
+    {
+      p_result.SetValue(p_index + lane,numbers[lane]);
+    }
+  }
+}
+
+// bcd_column::CompareLanes
+// Description: Three way comparison of the block of numbers at p_index
+// Technical:   Negative, zero and positive numbers first. Then the exponents
+//              and the mantissa, turned around for the negative numbers.
+template<int Limbs>
+void
+basic_bcd_column<Limbs>::CompareLanes(const basic_bcd_column& p_one,const basic_bcd_column& p_two,int* p_result,size_t p_index)
+{
+  const __m256i one = _mm256_set1_epi32(1);
+
+  __m256i signOne = _mm256_load_si256((const __m256i*)(p_one.Signs() + p_index));
+  __m256i signTwo = _mm256_load_si256((const __m256i*)(p_two.Signs() + p_index));
+  __m256i expOne  = _mm256_load_si256((const __m256i*)(p_one.Exponents() + p_index));
+  __m256i expTwo  = _mm256_load_si256((const __m256i*)(p_two.Exponents() + p_index));
+  __m256i limbsOne[Limbs];
+  __m256i limbsTwo[Limbs];
+  for(int ind = 0; ind < Limbs; ++ind)
+  {
+    limbsOne[ind] = _mm256_load_si256((const __m256i*)(p_one.Limb(ind) + p_index));
+    limbsTwo[ind] = _mm256_load_si256((const __m256i*)(p_two.Limb(ind) + p_index));
+  }
+  __m256i zeroOne;
+  __m256i zeroTwo;
+  __m256i usable = _mm256_and_si256(UsableLanes<Limbs>(signOne,expOne,limbsOne,zeroOne)
+                                   ,UsableLanes<Limbs>(signTwo,expTwo,limbsTwo,zeroTwo));
+
+  // Classes: -1 negative, 0 zero, 1 positive
+  __m256i classOne = _mm256_andnot_si256(zeroOne,_mm256_sub_epi32(one,_mm256_add_epi32(signOne,signOne)));
+  __m256i classTwo = _mm256_andnot_si256(zeroTwo,_mm256_sub_epi32(one,_mm256_add_epi32(signTwo,signTwo)));
+
+  // Absolute values
+  __m256i greater;
+  __m256i smaller;
+  CompareMantissaLanes<Limbs>(limbsOne,limbsTwo,greater,smaller);
+  __m256i sameExp  = _mm256_cmpeq_epi32(expOne,expTwo);
+  greater = _mm256_or_si256(_mm256_cmpgt_epi32(expOne,expTwo),_mm256_and_si256(sameExp,greater));
+  smaller = _mm256_or_si256(_mm256_cmpgt_epi32(expTwo,expOne),_mm256_and_si256(sameExp,smaller));
+  __m256i absolute = _mm256_sub_epi32(_mm256_and_si256(greater,one),_mm256_and_si256(smaller,one));
+
+  // Same class: the absolute order times the class (zero for two zeros)
+  __m256i sameClass = _mm256_cmpeq_epi32(classOne,classTwo);
+  __m256i byClass   = _mm256_sub_epi32(_mm256_and_si256(_mm256_cmpgt_epi32(classOne,classTwo),one)
+                                      ,_mm256_and_si256(_mm256_cmpgt_epi32(classTwo,classOne),one));
+  __m256i result    = SelectLanes(sameClass,_mm256_sign_epi32(absolute,classOne),byClass);
+
+  int results[columnLanes];
+  _mm256_storeu_si256((__m256i*)results,result);
+  int lanes = LaneBits(_mm256_xor_si256(usable,_mm256_set1_epi32(-1)));
+  for(int lane = 0; lane < columnLanes && p_index + lane < p_one.m_count; ++lane)
+  {
+    if(lanes & (1 << lane))
+    {
+      results[lane] = CompareNumber(p_one.GetValue(p_index + lane),p_two.GetValue(p_index + lane));
+    }
+    p_result[p_index + lane] = results[lane];
+  }
+}
+
+#endif // _M_X64
+
+//////////////////////////////////////////////////////////////////////////
+//
+// WIDTHS OF THE BCD COLUMN
+// Any other width in use needs its own line here
+//
+//////////////////////////////////////////////////////////////////////////
+
+template class basic_bcd_column< 3>;   // bcd24_column
+template class basic_bcd_column< 5>;   // bcd_column
+template class basic_bcd_column<15>;   // bcd120_column
+template class basic_bcd_column<25>;   // bcd200_column
+
+//////////////////////////////////////////////////////////////////////////
+//
+// END OF BCD COLUMN IMPLEMENTATION
+//
+//////////////////////////////////////////////////////////////////////////
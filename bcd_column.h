@@ -0,0 +1,132 @@
+/////////////////////////////////////////////////////////////////////////////////
+//
+// SourceFile: bcd_column.h
+//
+// BaseLibrary: Indispensable general objects and functions
+//
+// Copyright (c) 2014-2022 ir. W.E. Huisman
+// All rights reserved
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////
+//
+// BCD COLUMN
+//
+// A column of bcd numbers stored as a structure of arrays.
+// The signs, the exponents and every position of the mantissa have an array
+// of their own, so one limb position of many numbers lies side by side in memory.
+// On processors with AVX2 the column operations work on 8 numbers at once.
+// Numbers the vector kernels cannot handle exactly (NULL, INF, NaN, a mantissa
+// that is not normalized or an exponent at the end of its range) take the way of
+// basic_bcd, so the results are always the same as for an array of bcd.
+//
+// Copyright (c) 2014-2022 ir W. E. Huisman
+// Version 1.5 of 03-01-2022
+//
+#pragma once
+#include "bcd.h"
+
+// The widths of the bcd column in use
+using bcd24_column  = basic_bcd_column< 3>;
+using bcd_column    = basic_bcd_column< 5>;
+using bcd120_column = basic_bcd_column<15>;
+using bcd200_column = basic_bcd_column<25>;
+
+template<int Limbs>
+class basic_bcd_column
+{
+public:
+  using number = basic_bcd<Limbs>;
+
+  // Numbers in one step of the vector kernels
+  static const int columnLanes = 8;
+
+  // CONSTRUCTORS/DESTRUCTORS
+
+  // Column of p_count zero numbers
+  explicit basic_bcd_column(size_t p_count = 0);
+  // Column from an array of numbers
+  basic_bcd_column(const number* p_numbers,size_t p_count);
+  // Copy constructor
+  basic_bcd_column(const basic_bcd_column& p_column);
+  // Destructor
+ ~basic_bcd_column();
+
+  // Assignment
+  basic_bcd_column& operator=(const basic_bcd_column& p_column);
+
+  // Number of numbers in the column
+  size_t  GetCount() const;
+  // New size of the column. The numbers up to the new size are kept, new numbers are zero
+  void    Resize(size_t p_count);
+
+  // CONVERSION TO AND FROM BCD
+
+  // Gets or sets one number of the column
+  number  GetValue(size_t p_index) const;
+  void    SetValue(size_t p_index,const number& p_number);
+  // All numbers of the column to and from an array
+  void    FromArray(const number* p_numbers,size_t p_count);
+  void    ToArray(number* p_numbers) const;
+
+  // COLUMN OPERATIONS
+  // Both argument columns must have the same size. The result gets that size
+  // and may be one of the arguments (in place).
+
+  static void Add  (const basic_bcd_column& p_one,const basic_bcd_column& p_two,basic_bcd_column& p_result);
+  static void Sub  (const basic_bcd_column& p_one,const basic_bcd_column& p_two,basic_bcd_column& p_result);
+  // Multiplication of all numbers by one factor
+  static void Scale(const basic_bcd_column& p_numbers,const number& p_factor,basic_bcd_column& p_result);
+  // Three way comparison: -1 (smaller), 0 (equal) or 1 (greater) for every number
+  // Numbers that cannot be compared (NULL, INF, NaN) get the outcome of the operators < and ==
+  static void Compare(const basic_bcd_column& p_one,const basic_bcd_column& p_two,int* p_result);
+
+private:
+  // Allocate the arrays for p_count numbers (all zero)
+  void    Allocate(size_t p_count);
+  // Start of the signs, the exponents and one limb position of all numbers
+  int*    Signs() const;
+  int*    Exponents() const;
+  int*    Limb(int p_limb) const;
+  // Size check of the arguments of a column operation. Sizes the result
+  static void CheckSize(const basic_bcd_column& p_one,const basic_bcd_column& p_two,basic_bcd_column& p_result);
+  // Addition or subtraction of two columns
+  static void AddColumns(const basic_bcd_column& p_one,const basic_bcd_column& p_two,basic_bcd_column& p_result,bool p_subtract);
+  // One number as in the column operations of basic_bcd
+  static number AddNumber(const basic_bcd_column& p_one,const basic_bcd_column& p_two,size_t p_index,bool p_subtract);
+  static number MulNumber(const basic_bcd_column& p_numbers,const number& p_factor,size_t p_index);
+  // Three way comparison of one number
+  static int    CompareNumber(const number& p_one,const number& p_two);
+
+#ifdef _M_X64
+  // AVX2 kernels on the block of columnLanes numbers at p_index
+  static void AddLanes    (const basic_bcd_column& p_one,const basic_bcd_column& p_two,basic_bcd_column& p_result,size_t p_index,bool p_subtract);
+  static void ScaleLanes  (const basic_bcd_column& p_numbers,const number& p_factor,basic_bcd_column& p_result,size_t p_index);
+  static void CompareLanes(const basic_bcd_column& p_one,const basic_bcd_column& p_two,int* p_result,size_t p_index);
+#endif
+
+  // STORAGE OF THE COLUMN
+  // One aligned block: signs, exponents and the Limbs limb positions.
+  // Each array has m_stride elements, a multiple of the lanes, so every
+  // array starts on a 32 bytes boundary. Numbers after m_count are zero.
+  int*    m_storage { nullptr };
+  size_t  m_count   { 0 };
+  size_t  m_stride  { 0 };
+};